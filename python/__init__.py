@@ -7,7 +7,9 @@ from ._jsbsim import (
     FGAircraft,
     FGAtmosphere,
     FGAuxiliary,
+    FGBatchRunner,
     FGEngine,
+    FGEnvelopeSweep,
     FGFDMExec,
     FGGroundReactions,
     FGJSBBase,
@@ -0,0 +1,120 @@
+# binary_output.py
+#
+# Reader for the files written by the BINARY output type of JSBSim.
+#
+# Copyright (c) 2026 The JSBSim team
+#
+# This program is free software; you can redistribute it and/or modify it under
+# the terms of the GNU General Public License as published by the Free Software
+# Foundation; either version 3 of the License, or (at your option) any later
+# version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+# FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+# details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program; if not, see <http://www.gnu.org/licenses/>
+#
+
+"""Reader for the files written by ``<output type="BINARY">``.
+
+The file is made of a header that describes the columns followed by blocks of
+frames where the values are stored column after column as little-endian
+doubles (see FGOutputBinaryFile for the details of the format)::
+
+    from jsbsim.binary_output import read
+
+    log = read('output.bin')
+    altitude = log['/fdm/jsbsim/position/h-sl-ft']
+    df = log.to_dataframe()  # Same layout as pandas.read_csv(..., index_col=0)
+"""
+
+import struct
+
+import numpy as np
+
+MAGIC = b'JSBSIMBO'
+VERSION = 1
+_DOUBLE = 0
+
+
+class BinaryOutput:
+    """Content of a binary output file.
+
+    Attributes:
+        names: the names of the columns, the first one being ``Time``.
+        units: the units of the columns (empty strings when not known).
+        data: a 2D array with one row per frame and one column per name.
+    """
+
+    def __init__(self, names, units, data):
+        self.names = names
+        self.units = units
+        self.data = data
+
+    def __len__(self):
+        return self.data.shape[0]
+
+    def __getitem__(self, name):
+        """Returns the values of the column ``name``."""
+        return self.data[:, self.names.index(name)]
+
+    def to_dataframe(self):
+        """Returns the data as a pandas DataFrame indexed by the time."""
+        import pandas as pd
+        return pd.DataFrame(self.data[:, 1:], index=pd.Index(self.data[:, 0],
+                                                             name=self.names[0]),
+                            columns=self.names[1:])
+
+
+def read(filename):
+    """Reads a binary output file and returns a BinaryOutput instance.
+
+    A block that has not been completely written (for instance if the
+    simulation is still running) is ignored."""
+    with open(filename, 'rb') as f:
+        buffer = f.read()
+
+    if buffer[:len(MAGIC)] != MAGIC:
+        raise ValueError(f'{filename} is not a JSBSim binary output file')
+
+    pos = len(MAGIC)
+    version, num_columns, block_size = struct.unpack_from('<III', buffer, pos)
+    pos += 12
+    if version != VERSION:
+        raise ValueError(f'{filename}: unsupported format version {version}')
+
+    def read_string(pos):
+        length, = struct.unpack_from('<H', buffer, pos)
+        pos += 2
+        return buffer[pos:pos+length].decode('utf-8'), pos+length
+
+    names, units = [], []
+    for _ in range(num_columns):
+        column_type = buffer[pos]
+        if column_type != _DOUBLE:
+            raise ValueError(f'{filename}: unsupported column type {column_type}')
+        name, pos = read_string(pos+1)
+        unit, pos = read_string(pos)
+        names.append(name)
+        units.append(unit)
+
+    blocks = []
+    while pos + 4 <= len(buffer):
+        num_frames, = struct.unpack_from('<I', buffer, pos)
+        size = num_frames * num_columns * 8
+        if num_frames > block_size or pos + 4 + size > len(buffer):
+            break
+        block = np.frombuffer(buffer, dtype='<f8', count=num_frames*num_columns,
+                              offset=pos+4)
+        blocks.append(block.reshape(num_columns, num_frames).T)
+        pos += 4 + size
+
+    if blocks:
+        data = np.concatenate(blocks).astype(np.float64)
+    else:
+        data = np.empty((0, num_columns))
+
+    return BinaryOutput(names, units, data)
@@ -0,0 +1,125 @@
+# envelope_sweep.py
+#
+# Reader for the files written by FGEnvelopeSweep.
+#
+# Copyright (c) 2026 The JSBSim team
+#
+# This program is free software; you can redistribute it and/or modify it under
+# the terms of the GNU General Public License as published by the Free Software
+# Foundation; either version 3 of the License, or (at your option) any later
+# version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+# FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+# details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program; if not, see <http://www.gnu.org/licenses/>
+#
+
+"""Reader for the trim and linearization results of an envelope sweep.
+
+The file is made of a header that describes the grid and the variables
+followed by one record per grid point (see FGEnvelopeSweep for the details of
+the format). The arrays are shaped after the grid so that the results of a
+point are indexed by the indices of its axes values::
+
+    from jsbsim.envelope_sweep import read
+
+    sweep = read('envelope.bin')
+    speeds, altitudes = sweep.axes['ic/vc-kts'], sweep.axes['ic/h-sl-ft']
+    A = sweep.A[2, 1]  # System matrix at speeds[2] and altitudes[1]
+"""
+
+import struct
+
+import numpy as np
+
+MAGIC = b'JSBSIMSW'
+VERSION = 1
+
+
+class EnvelopeSweep:
+    """Content of an envelope sweep file.
+
+    Attributes:
+        axes: a dict which maps the property of each axis to its values (in
+              the order of the axes).
+        control_names: the names of the trim controls.
+        state_names, state_units, input_names, input_units, output_names,
+        output_units: the names and units of the linear model variables.
+        success: a boolean array, True where the point has been trimmed.
+        donor: the flat index of the point which trim solution has been used
+               as the initial guess (-1 if the trim started from scratch).
+        wall_time: the time spent computing each point in seconds.
+        controls, x0, u0, y0, A, B, C, D: the trim controls and the linear
+              models. The values of the failed points are NaNs.
+    """
+
+    @property
+    def shape(self):
+        return tuple(len(values) for values in self.axes.values())
+
+
+def read(filename):
+    """Reads an envelope sweep file and returns an EnvelopeSweep instance."""
+    with open(filename, 'rb') as f:
+        buffer = f.read()
+
+    if buffer[:len(MAGIC)] != MAGIC:
+        raise ValueError(f'{filename} is not a JSBSim envelope sweep file')
+
+    pos = len(MAGIC)
+    version, num_axes, num_points, nc, nx, nu, ny = struct.unpack_from('<7I',
+                                                                       buffer,
+                                                                       pos)
+    pos += 28
+    if version != VERSION:
+        raise ValueError(f'{filename}: unsupported format version {version}')
+
+    def read_string(pos):
+        length, = struct.unpack_from('<H', buffer, pos)
+        pos += 2
+        return buffer[pos:pos+length].decode('utf-8'), pos+length
+
+    def read_names(pos, n, with_units):
+        names, units = [], []
+        for _ in range(n):
+            name, pos = read_string(pos)
+            names.append(name)
+            if with_units:
+                unit, pos = read_string(pos)
+                units.append(unit)
+        return names, units, pos
+
+    sweep = EnvelopeSweep()
+    sweep.axes = {}
+    for _ in range(num_axes):
+        name, pos = read_string(pos)
+        n, = struct.unpack_from('<I', buffer, pos)
+        sweep.axes[name] = np.frombuffer(buffer, dtype='<f8', count=n,
+                                         offset=pos+4).astype(np.float64)
+        pos += 4 + 8*n
+
+    sweep.control_names, _, pos = read_names(pos, nc, False)
+    sweep.state_names, sweep.state_units, pos = read_names(pos, nx, True)
+    sweep.input_names, sweep.input_units, pos = read_names(pos, nu, True)
+    sweep.output_names, sweep.output_units, pos = read_names(pos, ny, True)
+
+    fields = [('controls', (nc,)), ('x0', (nx,)), ('u0', (nu,)), ('y0', (ny,)),
+              ('A', (nx, nx)), ('B', (nx, nu)), ('C', (ny, nx)), ('D', (ny, nu))]
+    record = np.dtype([('success', '<i4'), ('donor', '<i4'),
+                       ('wall_time', '<f8')]
+                      + [(name, '<f8', shape) for name, shape in fields])
+    records = np.frombuffer(buffer, dtype=record, count=num_points,
+                            offset=pos)
+
+    shape = sweep.shape
+    sweep.success = records['success'].astype(bool).reshape(shape)
+    sweep.donor = records['donor'].astype(int).reshape(shape)
+    sweep.wall_time = records['wall_time'].astype(np.float64).reshape(shape)
+    for name, dims in fields:
+        sweep.__dict__[name] = records[name].astype(np.float64).reshape(shape+dims)
+
+    return sweep
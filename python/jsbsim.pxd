@@ -25,8 +25,9 @@
 
 from libcpp cimport bool
 from libcpp.string cimport string
-from libcpp.memory cimport shared_ptr
+from libcpp.memory cimport shared_ptr, unique_ptr
 from libcpp.vector cimport vector
+from libcpp.pair cimport pair
 from cpython.ref cimport PyObject
 
 cdef extern from "ExceptionManagement.h" namespace "JSBSim":
@@ -43,7 +44,7 @@ cdef extern from "initialization/FGInitialCondition.h" namespace "JSBSim":
 
 cdef extern from "initialization/FGLinearization.h" namespace "JSBSim":
     cdef cppclass c_FGLinearization "JSBSim::FGLinearization":
-        c_FGLinearization(c_FGFDMExec* fdme)
+        c_FGLinearization(c_FGFDMExec* fdme, unsigned int threads)
 
         void WriteScicoslab() const
         void WriteScicoslab(string& path) const
@@ -230,11 +231,13 @@ cdef extern from "FGFDMExec.h" namespace "JSBSim":
         bool SetAircraftPath(const c_SGPath& path)
         bool SetSystemsPath(const c_SGPath& path)
         bool SetOutputPath(const c_SGPath& path)
+        void SetModelCachePath(const c_SGPath& path)
         void SetRootDir(const c_SGPath& path)
         const c_SGPath& GetEnginePath()
         const c_SGPath& GetAircraftPath()
         const c_SGPath& GetSystemsPath()
         const c_SGPath& GetOutputPath()
+        const c_SGPath& GetModelCachePath()
         const c_SGPath& GetRootDir()
         const c_SGPath& GetFullAircraftPath()
         double GetPropertyValue(string property) except +convertJSBSimToPyExc
@@ -256,6 +259,9 @@ cdef extern from "FGFDMExec.h" namespace "JSBSim":
         void Resume()
         bool Holding()
         void ResetToInitialConditions(int mode)
+        string SaveState() except +convertJSBSimToPyExc
+        void RestoreState(const string& state) except +convertJSBSimToPyExc
+        unique_ptr[c_FGFDMExec] Clone() except +convertJSBSimToPyExc
         void SetDebugLevel(int level)
         string QueryPropertyCatalog(string check)
         void PrintPropertyCatalog()
@@ -282,3 +288,84 @@ cdef extern from "FGFDMExec.h" namespace "JSBSim":
         shared_ptr[c_FGAircraft] GetAircraft()
         shared_ptr[c_FGAtmosphere] GetAtmosphere()
         shared_ptr[c_FGMassBalance] GetMassBalance()
+
+cdef extern from "FGBatchRunner.h" namespace "JSBSim":
+    cdef cppclass c_FGBatchCase "JSBSim::FGBatchCase":
+        c_FGBatchCase()
+        string name
+        c_SGPath script
+        string aircraft
+        c_SGPath initfile
+        double end_time
+        double dt
+        bool random_seed
+        unsigned int seed
+        string output
+        vector[pair[string, double]] properties
+
+    cdef cppclass c_FGBatchResult "JSBSim::FGBatchResult":
+        string name
+        bool success
+        string message
+        double sim_time
+        unsigned int frames
+        double wall_time
+        vector[double] values
+
+    cdef cppclass c_FGBatchRunner "JSBSim::FGBatchRunner":
+        c_FGBatchRunner(unsigned int threads)
+        void SetRootDir(const c_SGPath& rootDir)
+        const c_SGPath& GetRootDir()
+        void SetOutputPath(const c_SGPath& path)
+        void SetModelCachePath(const c_SGPath& path)
+        void SetThreads(unsigned int threads)
+        unsigned int GetThreads()
+        void SetDefaultEndTime(double end_time)
+        void SetDefaultDeltaT(double dt)
+        void AddResultProperty(const string& property)
+        vector[string] GetResultProperties()
+        void AddCase(const c_FGBatchCase& batchCase)
+        size_t GetNumCases()
+        bool Load(const c_SGPath& caseList) except +convertJSBSimToPyExc
+        const vector[c_FGBatchResult]& Run() nogil
+        vector[c_FGBatchResult] GetResults()
+
+cdef extern from "FGEnvelopeSweep.h" namespace "JSBSim":
+    cdef cppclass c_FGSweepPoint "JSBSim::FGSweepPoint":
+        vector[double] values
+        bool success
+        int donor
+        string message
+        double wall_time
+        vector[double] controls
+        vector[double] x0
+        vector[double] u0
+        vector[double] y0
+        vector[vector[double]] A
+        vector[vector[double]] B
+        vector[vector[double]] C
+        vector[vector[double]] D
+
+    cdef cppclass c_FGEnvelopeSweep "JSBSim::FGEnvelopeSweep":
+        c_FGEnvelopeSweep(unsigned int threads)
+        void SetRootDir(const c_SGPath& rootDir)
+        const c_SGPath& GetRootDir()
+        void SetModelCachePath(const c_SGPath& path)
+        void SetThreads(unsigned int threads)
+        unsigned int GetThreads()
+        void SetAircraft(const string& aircraft)
+        void SetInitFile(const c_SGPath& initfile)
+        void SetTrimMode(int mode)
+        void SetLinearize(bool linearize)
+        void AddAxis(const string& property, const vector[double]& values)
+        size_t GetNumAxes()
+        void AddProperty(const string& property, double value)
+        size_t GetNumPoints()
+        bool Load(const c_SGPath& spec) except +convertJSBSimToPyExc
+        const vector[c_FGSweepPoint]& Run() nogil
+        vector[c_FGSweepPoint] GetResults()
+        vector[string] GetControlNames()
+        vector[string] GetStateNames()
+        vector[string] GetInputNames()
+        vector[string] GetOutputNames()
+        bool Write(const c_SGPath& path)
@@ -0,0 +1,343 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       FGBatchRunner.cpp
+ Author:       The JSBSim team
+ Date started: 10/16/26
+ Purpose:      Executes a list of simulation cases on a pool of threads.
+
+ ------------- Copyright (C) 2026 The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc.,
+ 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/16/26         Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <chrono>
+#include <deque>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <thread>
+
+#include "FGBatchRunner.h"
+#include "FGFDMExec.h"
+#include "initialization/FGInitialCondition.h"
+#include "initialization/FGTrim.h"
+#include "input_output/FGLog.h"
+#include "input_output/FGXMLFileRead.h"
+
+using namespace std;
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS IMPLEMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+// Queue of the cases allocated to a worker thread. The owner pops the cases
+// from the front while the other workers steal them from the back.
+struct FGBatchQueue {
+  mutex lock;
+  deque<size_t> cases;
+
+  bool PopFront(size_t& i) {
+    lock_guard<mutex> guard(lock);
+    if (cases.empty()) return false;
+    i = cases.front();
+    cases.pop_front();
+    return true;
+  }
+
+  bool PopBack(size_t& i) {
+    lock_guard<mutex> guard(lock);
+    if (cases.empty()) return false;
+    i = cases.back();
+    cases.pop_back();
+    return true;
+  }
+};
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGBatchRunner::FGBatchRunner(unsigned int threads)
+  : DefaultEndTime(-1.0), DefaultDeltaT(0.0)
+{
+  SetThreads(threads);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGBatchRunner::SetThreads(unsigned int threads)
+{
+  if (threads == 0) threads = thread::hardware_concurrency();
+  nThreads = max(threads, 1U);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGBatchRunner::Load(const SGPath& caseList)
+{
+  SGPath path = caseList;
+  if (path.isRelative()) path = RootDir/caseList.utf8Str();
+
+  FGXMLFileRead XMLFileRead;
+  Element* document = XMLFileRead.LoadXMLDocument(path);
+
+  if (!document) {
+    FGLogging log(LogLevel::ERROR);
+    log << "Failed to read the batch file " << path << "\n";
+    return false;
+  }
+
+  if (document->GetName() != "batch") {
+    FGXMLLogging log(document, LogLevel::ERROR);
+    log << "File " << path << " is not a batch file.\n";
+    return false;
+  }
+
+  Element* results = document->FindElement("results");
+  if (results) {
+    Element* property = results->FindElement("property");
+    while (property) {
+      AddResultProperty(property->GetDataLine());
+      property = results->FindNextElement("property");
+    }
+  }
+
+  Element* case_element = document->FindElement("case");
+  while (case_element) {
+    if (!ReadCase(case_element)) return false;
+    case_element = document->FindNextElement("case");
+  }
+
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGBatchRunner::ReadCase(Element* el)
+{
+  FGBatchCase batchCase;
+
+  batchCase.name = el->GetAttributeValue("name");
+  if (batchCase.name.empty())
+    batchCase.name = "case" + to_string(Cases.size());
+
+  if (el->HasAttribute("end"))
+    batchCase.end_time = el->GetAttributeValueAsNumber("end");
+  if (el->HasAttribute("dt"))
+    batchCase.dt = el->GetAttributeValueAsNumber("dt");
+  if (el->HasAttribute("seed")) {
+    batchCase.random_seed = true;
+    batchCase.seed = static_cast<unsigned int>(el->GetAttributeValueAsNumber("seed"));
+  }
+
+  if (el->FindElement("script"))
+    batchCase.script = SGPath::fromLocal8Bit(el->FindElementValue("script").c_str());
+  batchCase.aircraft = el->FindElementValue("aircraft");
+  if (el->FindElement("initfile"))
+    batchCase.initfile = SGPath::fromLocal8Bit(el->FindElementValue("initfile").c_str());
+  batchCase.output = el->FindElementValue("output");
+
+  if (batchCase.script.isNull() && batchCase.aircraft.empty()) {
+    FGXMLLogging log(el, LogLevel::ERROR);
+    log << "The case " << batchCase.name
+        << " specifies neither a script nor an aircraft.\n";
+    return false;
+  }
+
+  Element* property = el->FindElement("property");
+  while (property) {
+    if (!property->HasAttribute("value")) {
+      FGXMLLogging log(property, LogLevel::ERROR);
+      log << "The property " << property->GetDataLine()
+          << " has no value attribute.\n";
+      return false;
+    }
+    batchCase.properties.push_back({property->GetDataLine(),
+                                    property->GetAttributeValueAsNumber("value")});
+    property = el->FindNextElement("property");
+  }
+
+  AddCase(batchCase);
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+const vector<FGBatchResult>& FGBatchRunner::Run(void)
+{
+  Results.assign(Cases.size(), FGBatchResult());
+  if (Cases.empty()) return Results;
+
+  size_t nWorkers = min<size_t>(nThreads, Cases.size());
+  vector<FGBatchQueue> queues(nWorkers);
+
+  for (size_t i=0; i<Cases.size(); ++i)
+    queues[i % nWorkers].cases.push_back(i);
+
+  // No case is added once the workers are started so a worker can exit as
+  // soon as all the queues are found empty.
+  auto worker = [this, &queues, nWorkers](size_t w) {
+    size_t i;
+
+    for(;;) {
+      bool found = queues[w].PopFront(i);
+      for (size_t k=1; !found && k<nWorkers; ++k)
+        found = queues[(w+k) % nWorkers].PopBack(i);
+      if (!found) break;
+
+      Results[i] = RunCase(Cases[i]);
+    }
+  };
+
+  if (nWorkers == 1) {
+    // Run in the calling thread but still keep its logger untouched.
+    auto logger = GetLogger();
+    worker(0);
+    SetLogger(logger);
+  } else {
+    vector<thread> pool;
+    pool.reserve(nWorkers);
+    for (size_t w=0; w<nWorkers; ++w)
+      pool.emplace_back(worker, w);
+    for (auto& t: pool)
+      t.join();
+  }
+
+  return Results;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGBatchResult FGBatchRunner::RunCase(const FGBatchCase& batchCase) const
+{
+  FGBatchResult result;
+  auto logger = make_shared<FGErrorLogger>();
+  auto start = chrono::steady_clock::now();
+
+  result.name = batchCase.name;
+  result.values.assign(ResultProperties.size(),
+                       numeric_limits<double>::quiet_NaN());
+  SetLogger(logger);
+
+  try {
+    FGFDMExec fdmex;
+    double end_time = batchCase.end_time >= 0.0 ? batchCase.end_time
+                                                : DefaultEndTime;
+    double dt = batchCase.dt > 0.0 ? batchCase.dt : DefaultDeltaT;
+
+    fdmex.SetRootDir(RootDir);
+    fdmex.SetAircraftPath(SGPath("aircraft"));
+    fdmex.SetEnginePath(SGPath("engine"));
+    fdmex.SetSystemsPath(SGPath("systems"));
+    if (!OutputPath.isNull()) fdmex.SetOutputPath(OutputPath);
+    if (!ModelCachePath.isNull()) fdmex.SetModelCachePath(ModelCachePath);
+
+    bool loaded = false;
+
+    if (!batchCase.script.isNull()) {
+      loaded = fdmex.LoadScript(batchCase.script, dt, batchCase.initfile);
+    } else if (end_time < 0.0) {
+      FGLogging log(LogLevel::ERROR);
+      log << "No end time is specified for the case " << batchCase.name << "\n";
+    } else if (fdmex.LoadModel(batchCase.aircraft)) {
+      if (dt > 0.0) fdmex.Setdt(dt);
+      loaded = fdmex.GetIC()->Load(batchCase.initfile);
+    }
+
+    if (loaded && !batchCase.output.empty()
+        && !fdmex.SetOutputFileName(0, batchCase.output))
+      loaded = false;
+
+    if (loaded && batchCase.random_seed)
+      fdmex.SetPropertyValue("simulation/randomseed", batchCase.seed);
+
+    for (auto& [property, value]: batchCase.properties) {
+      if (!loaded) break;
+      if (!fdmex.GetPropertyManager()->GetNode(property)) {
+        FGLogging log(LogLevel::ERROR);
+        log << "No property by the name " << property << "\n";
+        loaded = false;
+      } else
+        fdmex.SetPropertyValue(property, value);
+    }
+
+    if (loaded) {
+      fdmex.RunIC();
+
+      TrimMode icTrimRequested = (TrimMode)fdmex.GetIC()->TrimRequested();
+      if (icTrimRequested != TrimMode::tNone) {
+        FGTrim trimmer(&fdmex, icTrimRequested);
+        trimmer.DoTrim();
+      }
+
+      bool running = true;
+      while (running && (end_time < 0.0 || fdmex.GetSimTime() <= end_time))
+        running = fdmex.Run();
+
+      result.sim_time = fdmex.GetSimTime();
+      result.frames = fdmex.GetFrame();
+
+      auto PropertyManager = fdmex.GetPropertyManager();
+      for (size_t i=0; i<ResultProperties.size(); ++i) {
+        auto node = PropertyManager->GetNode(ResultProperties[i]);
+        if (node) result.values[i] = node->getDoubleValue();
+      }
+      result.success = true;
+    }
+  } catch (const exception& e) {
+    FGLogging log(LogLevel::ERROR);
+    log << e.what() << "\n";
+    result.success = false;
+  }
+
+  chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+  result.wall_time = elapsed.count();
+  result.message = logger->GetMessages();
+
+  return result;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGBatchRunner::PrintResults(ostream& out) const
+{
+  out << "name,success,sim_time,frames,wall_time";
+  for (auto& property: ResultProperties)
+    out << "," << property;
+  out << endl;
+
+  auto precision = out.precision(12);
+  for (auto& result: Results) {
+    out << result.name << "," << (result.success ? 1 : 0) << ","
+        << result.sim_time << "," << result.frames << "," << result.wall_time;
+    for (double value: result.values)
+      out << "," << value;
+    out << endl;
+  }
+  out.precision(precision);
+}
+}
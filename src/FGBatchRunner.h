@@ -0,0 +1,223 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Header:       FGBatchRunner.h
+ Author:       The JSBSim team
+ Date started: 10/16/26
+
+ ------------- Copyright (C) 2026 The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc.,
+ 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/16/26         Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+SENTRY
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#ifndef FGBATCHRUNNER_H
+#define FGBATCHRUNNER_H
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <iosfwd>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "JSBSim_API.h"
+#include "simgear/misc/sg_path.hxx"
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+FORWARD DECLARATIONS
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace JSBSim {
+
+class Element;
+
+/** Description of a single run executed by FGBatchRunner.
+    A case either runs a script (which loads the aircraft and the initial
+    conditions by itself) or an aircraft with an initialization file. */
+struct JSBSIM_API FGBatchCase {
+  /// Name of the case, used to identify its result.
+  std::string name;
+  /// Script to run. Relative paths are taken from the root directory.
+  SGPath script;
+  /// Aircraft to load when no script is given.
+  std::string aircraft;
+  /// Initialization file (overrides the one specified in the script, if any).
+  SGPath initfile;
+  /// Time at which the run is stopped. A negative value means no limit.
+  double end_time = -1.0;
+  /// Integration time step. A value of zero keeps the default time step.
+  double dt = 0.0;
+  /// Set to true to override the random seed of the executive.
+  bool random_seed = false;
+  /// Value of the random seed when random_seed is true.
+  unsigned int seed = 0;
+  /// Name of the file to which the first output of the model is written.
+  std::string output;
+  /// Property values that are set before the initial conditions are applied.
+  std::vector<std::pair<std::string, double>> properties;
+};
+
+/** Result of a case executed by FGBatchRunner. */
+struct JSBSIM_API FGBatchResult {
+  /// Name of the case.
+  std::string name;
+  /// true if the case has been loaded and executed without errors.
+  bool success = false;
+  /// Error messages issued while the case was executed.
+  std::string message;
+  /// Simulation time at the end of the run.
+  double sim_time = 0.0;
+  /// Number of frames that have been executed.
+  unsigned int frames = 0;
+  /// Wall clock time spent executing the case (in seconds).
+  double wall_time = 0.0;
+  /// Final values of the result properties (NaN if a property does not exist).
+  std::vector<double> values;
+};
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DOCUMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/** Executes a list of cases concurrently on a pool of threads.
+    Each case is run by its own FGFDMExec instance which is created, executed
+    and destroyed by one of the worker threads. The cases are dealt to the
+    workers round robin and a worker which has exhausted its own queue steals
+    the remaining cases from the back of the other queues so that all the
+    threads are kept busy until the whole list has been processed.
+
+    The list of cases can be built programmatically with AddCase() or read
+    from an XML file:
+
+    @code{.xml}
+    <batch>
+      <results>
+        <property> position/h-sl-ft </property>
+        <property> velocities/vc-kts </property>
+      </results>
+      <case name="nominal">
+        <script> scripts/c1722.xml </script>
+      </case>
+      <case name="dispersed" seed="12" end="10.0" dt="0.01">
+        <aircraft> c172x </aircraft>
+        <initfile> reset01 </initfile>
+        <output> dispersed.csv </output>
+        <property value="0.5"> fcs/throttle-cmd-norm </property>
+      </case>
+    </batch>
+    @endcode
+
+    The executives do not share any state, so the results of a case do not
+    depend on the number of threads nor on the order in which the cases are
+    executed. The debug level being common to the whole process, it is
+    recommended to set it to zero before calling Run().
+
+    @author The JSBSim team
+*/
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DECLARATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+class JSBSIM_API FGBatchRunner
+{
+public:
+  /** Constructor
+      @param threads number of worker threads. If zero, the number of
+                     hardware threads is used. */
+  explicit FGBatchRunner(unsigned int threads = 0);
+
+  /** Set the root directory from which the relative paths are resolved.
+      The aircraft, engine and systems directories are expected to be located
+      in this root directory. */
+  void SetRootDir(const SGPath& rootDir) { RootDir = rootDir; }
+  const SGPath& GetRootDir(void) const { return RootDir; }
+
+  /// Set the directory where the output files will be written.
+  void SetOutputPath(const SGPath& path) { OutputPath = path; }
+  const SGPath& GetOutputPath(void) const { return OutputPath; }
+
+  /// Set the directory where the parsed XML files are cached.
+  void SetModelCachePath(const SGPath& path) { ModelCachePath = path; }
+  const SGPath& GetModelCachePath(void) const { return ModelCachePath; }
+
+  /// Set the number of worker threads (0 selects the hardware concurrency).
+  void SetThreads(unsigned int threads);
+  unsigned int GetThreads(void) const { return nThreads; }
+
+  /// Set the end time of the cases that do not specify one.
+  void SetDefaultEndTime(double end_time) { DefaultEndTime = end_time; }
+
+  /// Set the integration time step of the cases that do not specify one.
+  void SetDefaultDeltaT(double dt) { DefaultDeltaT = dt; }
+
+  /// Add a property which final value is collected at the end of each case.
+  void AddResultProperty(const std::string& property)
+  { ResultProperties.push_back(property); }
+  const std::vector<std::string>& GetResultProperties(void) const
+  { return ResultProperties; }
+
+  /// Append a case to the list of cases to execute.
+  void AddCase(const FGBatchCase& batchCase) { Cases.push_back(batchCase); }
+  size_t GetNumCases(void) const { return Cases.size(); }
+  const FGBatchCase& GetCase(size_t i) const { return Cases[i]; }
+
+  /** Read a list of cases from an XML file.
+      @param caseList path to the file. Relative paths are taken from the root
+                      directory.
+      @return true if the file has been successfully read. */
+  bool Load(const SGPath& caseList);
+
+  /** Executes all the cases.
+      The call blocks until all the cases have been executed.
+      @return the results, in the same order as the cases. */
+  const std::vector<FGBatchResult>& Run(void);
+
+  /// Returns the results of the last call to Run().
+  const std::vector<FGBatchResult>& GetResults(void) const { return Results; }
+
+  /** Print the results in CSV format: one line per case with the case name,
+      its status, the simulation time, the number of frames, the wall clock
+      time and the values of the result properties. */
+  void PrintResults(std::ostream& out) const;
+
+private:
+  unsigned int nThreads;
+  double DefaultEndTime;
+  double DefaultDeltaT;
+  SGPath RootDir;
+  SGPath OutputPath;
+  SGPath ModelCachePath;
+  std::vector<std::string> ResultProperties;
+  std::vector<FGBatchCase> Cases;
+  std::vector<FGBatchResult> Results;
+
+  bool ReadCase(Element* el);
+  FGBatchResult RunCase(const FGBatchCase& batchCase) const;
+};
+}
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+#endif
@@ -0,0 +1,579 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       FGEnvelopeSweep.cpp
+ Author:       The JSBSim team
+ Date started: 10/16/26
+ Purpose:      Trims and linearizes an aircraft over a grid of flight
+               conditions on a pool of threads.
+
+ ------------- Copyright (C) 2026 The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc.,
+ 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/16/26         Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <thread>
+
+#include "FGEnvelopeSweep.h"
+#include "FGFDMExec.h"
+#include "initialization/FGInitialCondition.h"
+#include "initialization/FGLinearization.h"
+#include "initialization/FGTrim.h"
+#include "input_output/FGLog.h"
+#include "input_output/FGXMLFileRead.h"
+#include "input_output/string_utilities.h"
+
+using namespace std;
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+LOCAL DECLARATIONS
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace {
+
+const char Magic[8] = {'J', 'S', 'B', 'S', 'I', 'M', 'S', 'W'};
+const uint32_t FormatVersion = 1;
+
+bool IsLittleEndian(void)
+{
+  const uint16_t one = 1;
+  uint8_t first;
+  memcpy(&first, &one, 1);
+  return first == 1;
+}
+
+template<typename T>
+void WriteLittleEndian(ostream& out, T value)
+{
+  uint8_t bytes[sizeof(T)];
+  memcpy(bytes, &value, sizeof(T));
+  if (!IsLittleEndian()) {
+    for (size_t i=0; i < sizeof(T)/2; ++i)
+      swap(bytes[i], bytes[sizeof(T)-1-i]);
+  }
+  out.write(reinterpret_cast<const char*>(bytes), sizeof(T));
+}
+
+void WriteString(ostream& out, const string& str)
+{
+  size_t length = min(str.size(), size_t(UINT16_MAX));
+  WriteLittleEndian(out, static_cast<uint16_t>(length));
+  out.write(str.data(), length);
+}
+
+// Writes the values of a vector, padded with NaNs up to the size n so that all
+// the records of the file have the same size.
+void WriteValues(ostream& out, const vector<double>& values, size_t n)
+{
+  const double NaN = numeric_limits<double>::quiet_NaN();
+  for (size_t i=0; i<n; ++i)
+    WriteLittleEndian(out, i < values.size() ? values[i] : NaN);
+}
+
+void WriteMatrix(ostream& out, const vector<vector<double>>& matrix, size_t rows,
+                 size_t cols)
+{
+  static const vector<double> empty;
+  for (size_t i=0; i<rows; ++i)
+    WriteValues(out, i < matrix.size() ? matrix[i] : empty, cols);
+}
+}
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS IMPLEMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+FGEnvelopeSweep::FGEnvelopeSweep(unsigned int threads)
+  : Mode(tLongitudinal), Linearize(true)
+{
+  SetThreads(threads);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGEnvelopeSweep::SetThreads(unsigned int threads)
+{
+  if (threads == 0) threads = thread::hardware_concurrency();
+  nThreads = max(threads, 1U);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+size_t FGEnvelopeSweep::GetNumPoints(void) const
+{
+  if (Axes.empty()) return 0;
+
+  size_t n = 1;
+  for (auto& axis: Axes)
+    n *= axis.values.size();
+  return n;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGEnvelopeSweep::Load(const SGPath& spec)
+{
+  SGPath path = spec;
+  if (path.isRelative()) path = RootDir/spec.utf8Str();
+
+  FGXMLFileRead XMLFileRead;
+  Element* document = XMLFileRead.LoadXMLDocument(path);
+
+  if (!document) {
+    FGLogging log(LogLevel::ERROR);
+    log << "Failed to read the sweep file " << path << "\n";
+    return false;
+  }
+
+  if (document->GetName() != "sweep") {
+    FGXMLLogging log(document, LogLevel::ERROR);
+    log << "File " << path << " is not a sweep file.\n";
+    return false;
+  }
+
+  Aircraft = document->FindElementValue("aircraft");
+  if (Aircraft.empty()) {
+    FGXMLLogging log(document, LogLevel::ERROR);
+    log << "The sweep file " << path << " does not specify an aircraft.\n";
+    return false;
+  }
+
+  if (document->FindElement("initfile"))
+    InitFile = SGPath::fromLocal8Bit(document->FindElementValue("initfile").c_str());
+  if (document->FindElement("output"))
+    OutputFile = SGPath::fromLocal8Bit(document->FindElementValue("output").c_str());
+  if (document->FindElement("trim"))
+    Mode = static_cast<int>(document->FindElementValueAsNumber("trim"));
+  if (document->FindElement("linearize"))
+    Linearize = document->FindElementValueAsNumber("linearize") != 0.0;
+
+  Element* axis = document->FindElement("axis");
+  while (axis) {
+    if (!ReadAxis(axis)) return false;
+    axis = document->FindNextElement("axis");
+  }
+
+  Element* property = document->FindElement("property");
+  while (property) {
+    if (!property->HasAttribute("value")) {
+      FGXMLLogging log(property, LogLevel::ERROR);
+      log << "The property " << property->GetDataLine()
+          << " has no value attribute.\n";
+      return false;
+    }
+    AddProperty(property->GetDataLine(),
+                property->GetAttributeValueAsNumber("value"));
+    property = document->FindNextElement("property");
+  }
+
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGEnvelopeSweep::ReadAxis(Element* el)
+{
+  string property = el->GetAttributeValue("property");
+  vector<double> values;
+
+  if (property.empty()) {
+    FGXMLLogging log(el, LogLevel::ERROR);
+    log << "An axis has no property attribute.\n";
+    return false;
+  }
+
+  if (el->HasAttribute("points")) {
+    if (!el->HasAttribute("min") || !el->HasAttribute("max")) {
+      FGXMLLogging log(el, LogLevel::ERROR);
+      log << "The axis " << property << " needs the attributes min and max.\n";
+      return false;
+    }
+    double vmin = el->GetAttributeValueAsNumber("min");
+    double vmax = el->GetAttributeValueAsNumber("max");
+    int points = static_cast<int>(el->GetAttributeValueAsNumber("points"));
+    if (points == 1)
+      values.push_back(vmin);
+    for (int i=0; points > 1 && i<points; ++i)
+      values.push_back(vmin + (vmax-vmin)*i/(points-1));
+  } else {
+    for (unsigned int i=0; i<el->GetNumDataLines(); ++i)
+      read_numbers_locale_c(el->GetDataLine(i), values);
+  }
+
+  if (values.empty()) {
+    FGXMLLogging log(el, LogLevel::ERROR);
+    log << "The axis " << property << " has no values.\n";
+    return false;
+  }
+
+  AddAxis(property, values);
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// The trim of a point is started from the solution of the point which index
+// along its first non zero axis is one less. This builds a spanning tree of the
+// grid rooted at the first point in which each point is the neighbor of its
+// parent.
+
+int FGEnvelopeSweep::GetDonor(size_t point) const
+{
+  size_t stride = GetNumPoints();
+
+  for (auto& axis: Axes) {
+    size_t n = axis.values.size();
+    stride /= n;
+    if ((point / stride) % n != 0)
+      return static_cast<int>(point - stride);
+  }
+
+  return -1;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+const vector<FGSweepPoint>& FGEnvelopeSweep::Run(void)
+{
+  size_t nPoints = GetNumPoints();
+  Results.assign(nPoints, FGSweepPoint());
+  ControlNames.clear();
+  StateNames.clear(); StateUnits.clear();
+  InputNames.clear(); InputUnits.clear();
+  OutputNames.clear(); OutputUnits.clear();
+  if (nPoints == 0) return Results;
+
+  vector<vector<size_t>> children(nPoints);
+
+  for (size_t i=0; i<nPoints; ++i) {
+    size_t index = i;
+    for (size_t k=Axes.size(); k-- > 0;) {
+      size_t n = Axes[k].values.size();
+      Results[i].values.insert(Results[i].values.begin(),
+                               Axes[k].values[index % n]);
+      index /= n;
+    }
+    int donor = GetDonor(i);
+    if (donor >= 0) children[donor].push_back(i);
+  }
+
+  // The model is loaded once and its state right after the initial conditions
+  // file has been read is used as the starting point of every grid point.
+  auto callerLogger = GetLogger();
+  auto logger = make_shared<FGErrorLogger>();
+  FGFDMExec prototype;
+  string state;
+  bool loaded = false;
+
+  SetLogger(logger);
+
+  try {
+    prototype.SetRootDir(RootDir);
+    prototype.SetAircraftPath(SGPath("aircraft"));
+    prototype.SetEnginePath(SGPath("engine"));
+    prototype.SetSystemsPath(SGPath("systems"));
+    if (!ModelCachePath.isNull()) prototype.SetModelCachePath(ModelCachePath);
+
+    if (prototype.LoadModel(Aircraft))
+      loaded = InitFile.isNull() || prototype.GetIC()->Load(InitFile);
+
+    auto PropertyManager = prototype.GetPropertyManager();
+    for (auto& [property, value]: Properties) {
+      if (loaded && !PropertyManager->GetNode(property)) {
+        FGLogging log(LogLevel::ERROR);
+        log << "No property by the name " << property << "\n";
+        loaded = false;
+      }
+    }
+    for (auto& axis: Axes) {
+      if (loaded && !PropertyManager->GetNode(axis.property)) {
+        FGLogging log(LogLevel::ERROR);
+        log << "No property by the name " << axis.property << "\n";
+        loaded = false;
+      }
+    }
+
+    if (loaded) {
+      state = prototype.SaveState();
+      FGTrim trimmer(&prototype, static_cast<JSBSim::TrimMode>(Mode));
+      ControlNames = trimmer.GetControlNames();
+    }
+  } catch (const exception& e) {
+    FGLogging log(LogLevel::ERROR);
+    log << e.what() << "\n";
+    loaded = false;
+  }
+
+  SetLogger(callerLogger);
+
+  if (!loaded) {
+    for (auto& point: Results)
+      point.message = logger->GetMessages();
+    return Results;
+  }
+
+  // A point is scheduled once the point from which its trim is started has
+  // been computed. The scheduling order therefore does not alter the results.
+  mutex lock;
+  condition_variable ready;
+  deque<size_t> queue = {0};
+  size_t remaining = nPoints;
+  size_t nWorkers = min<size_t>(nThreads, nPoints);
+
+  auto worker = [&]() {
+    unique_ptr<FGFDMExec> fdmex;
+    string error;
+
+    try {
+      fdmex = prototype.Clone();
+    } catch (const exception& e) {
+      error = e.what();
+    }
+
+    for (;;) {
+      size_t i;
+      {
+        unique_lock<mutex> guard(lock);
+        ready.wait(guard, [&]() { return !queue.empty() || remaining == 0; });
+        if (queue.empty()) break;
+        i = queue.front();
+        queue.pop_front();
+      }
+
+      if (fdmex)
+        RunPoint(*fdmex, state, i, lock);
+      else
+        Results[i].message = error;
+
+      {
+        lock_guard<mutex> guard(lock);
+        for (size_t child: children[i])
+          queue.push_back(child);
+        --remaining;
+      }
+      ready.notify_all();
+    }
+  };
+
+  if (nWorkers == 1) {
+    worker();
+    SetLogger(callerLogger);
+  } else {
+    vector<thread> pool;
+    pool.reserve(nWorkers);
+    for (size_t w=0; w<nWorkers; ++w)
+      pool.emplace_back(worker);
+    for (auto& t: pool)
+      t.join();
+  }
+
+  return Results;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGEnvelopeSweep::SetPointProperties(FGFDMExec& fdmex,
+                                         const FGSweepPoint& point) const
+{
+  for (auto& [property, value]: Properties)
+    fdmex.SetPropertyValue(property, value);
+  for (size_t k=0; k<Axes.size(); ++k)
+    fdmex.SetPropertyValue(Axes[k].property, point.values[k]);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGEnvelopeSweep::RunPoint(FGFDMExec& fdmex, const string& state,
+                               size_t i, mutex& lock)
+{
+  FGSweepPoint& point = Results[i];
+  shared_ptr<FGErrorLogger> logger;
+  auto start = chrono::steady_clock::now();
+
+  // The nearest trimmed predecessor has been computed before this point was
+  // scheduled.
+  int donor = GetDonor(i);
+  while (donor >= 0 && !Results[donor].success)
+    donor = GetDonor(donor);
+
+  // The trim is started from the solution of the donor if any. If it fails,
+  // it is attempted again from the middle of the control ranges.
+  auto trim = [&](int from) {
+    logger = make_shared<FGErrorLogger>();
+    SetLogger(logger);
+
+    fdmex.RestoreState(state);
+    SetPointProperties(fdmex, point);
+    fdmex.RunIC();
+
+    FGTrim trimmer(&fdmex, static_cast<JSBSim::TrimMode>(Mode));
+    if (from >= 0) trimmer.SetInitialControls(Results[from].controls);
+    bool trimmed = trimmer.DoTrim();
+    point.controls = trimmer.GetControls();
+    point.donor = from;
+    return trimmed;
+  };
+
+  try {
+    bool trimmed = trim(donor);
+    if (!trimmed && donor >= 0) trimmed = trim(-1);
+
+    if (trimmed && Linearize) {
+      FGLinearization linearization(&fdmex);
+
+      point.x0 = linearization.GetInitialState();
+      point.u0 = linearization.GetInitialInput();
+      point.y0 = linearization.GetInitialOutput();
+      point.A = linearization.GetSystemMatrix();
+      point.B = linearization.GetInputMatrix();
+      point.C = linearization.GetOutputMatrix();
+      point.D = linearization.GetFeedforwardMatrix();
+
+      lock_guard<mutex> guard(lock);
+      if (StateNames.empty()) {
+        StateNames = linearization.GetStateNames();
+        StateUnits = linearization.GetStateUnits();
+        InputNames = linearization.GetInputNames();
+        InputUnits = linearization.GetInputUnits();
+        OutputNames = linearization.GetOutputNames();
+        OutputUnits = linearization.GetOutputUnits();
+      }
+    }
+
+    point.success = trimmed;
+  } catch (const exception& e) {
+    FGLogging log(LogLevel::ERROR);
+    log << e.what() << "\n";
+    point.success = false;
+  }
+
+  chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+  point.wall_time = elapsed.count();
+  point.message = logger->GetMessages();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGEnvelopeSweep::Write(const SGPath& path) const
+{
+  ofstream out(path.utf8Str(), ios::binary);
+
+  if (!out) {
+    FGLogging log(LogLevel::ERROR);
+    log << "Could not open the file " << path << " for writing.\n";
+    return false;
+  }
+
+  size_t nControls = ControlNames.size();
+  size_t nX = StateNames.size();
+  size_t nU = InputNames.size();
+  size_t nY = OutputNames.size();
+
+  out.write(Magic, sizeof(Magic));
+  WriteLittleEndian(out, FormatVersion);
+  WriteLittleEndian(out, static_cast<uint32_t>(Axes.size()));
+  WriteLittleEndian(out, static_cast<uint32_t>(Results.size()));
+  WriteLittleEndian(out, static_cast<uint32_t>(nControls));
+  WriteLittleEndian(out, static_cast<uint32_t>(nX));
+  WriteLittleEndian(out, static_cast<uint32_t>(nU));
+  WriteLittleEndian(out, static_cast<uint32_t>(nY));
+
+  for (auto& axis: Axes) {
+    WriteString(out, axis.property);
+    WriteLittleEndian(out, static_cast<uint32_t>(axis.values.size()));
+    WriteValues(out, axis.values, axis.values.size());
+  }
+
+  for (auto& name: ControlNames)
+    WriteString(out, name);
+  for (size_t i=0; i<nX; ++i) {
+    WriteString(out, StateNames[i]);
+    WriteString(out, StateUnits[i]);
+  }
+  for (size_t i=0; i<nU; ++i) {
+    WriteString(out, InputNames[i]);
+    WriteString(out, InputUnits[i]);
+  }
+  for (size_t i=0; i<nY; ++i) {
+    WriteString(out, OutputNames[i]);
+    WriteString(out, OutputUnits[i]);
+  }
+
+  // One record of fixed size per point. The values of a point that could not
+  // be trimmed are NaNs.
+  static const vector<double> empty;
+  for (auto& point: Results) {
+    WriteLittleEndian(out, static_cast<int32_t>(point.success ? 1 : 0));
+    WriteLittleEndian(out, static_cast<int32_t>(point.donor));
+    WriteLittleEndian(out, point.wall_time);
+    WriteValues(out, point.success ? point.controls : empty, nControls);
+    WriteValues(out, point.x0, nX);
+    WriteValues(out, point.u0, nU);
+    WriteValues(out, point.y0, nY);
+    WriteMatrix(out, point.A, nX, nX);
+    WriteMatrix(out, point.B, nX, nU);
+    WriteMatrix(out, point.C, nY, nX);
+    WriteMatrix(out, point.D, nY, nU);
+  }
+
+  return out.good();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGEnvelopeSweep::PrintResults(ostream& out) const
+{
+  out << "point";
+  for (auto& axis: Axes)
+    out << "," << axis.property;
+  out << ",success,donor,wall_time";
+  for (auto& name: ControlNames)
+    out << "," << name;
+  out << endl;
+
+  auto precision = out.precision(12);
+  for (size_t i=0; i<Results.size(); ++i) {
+    auto& point = Results[i];
+    out << i;
+    for (double value: point.values)
+      out << "," << value;
+    out << "," << (point.success ? 1 : 0) << "," << point.donor << ","
+        << point.wall_time;
+    for (size_t k=0; k<ControlNames.size(); ++k)
+      out << "," << (point.success ? point.controls[k]
+                                   : numeric_limits<double>::quiet_NaN());
+    out << endl;
+  }
+  out.precision(precision);
+}
+}
@@ -0,0 +1,260 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Header:       FGEnvelopeSweep.h
+ Author:       The JSBSim team
+ Date started: 10/16/26
+
+ ------------- Copyright (C) 2026 The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc.,
+ 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/16/26         Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+SENTRY
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#ifndef FGENVELOPESWEEP_H
+#define FGENVELOPESWEEP_H
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <iosfwd>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "JSBSim_API.h"
+#include "simgear/misc/sg_path.hxx"
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+FORWARD DECLARATIONS
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace JSBSim {
+
+class Element;
+class FGFDMExec;
+
+/** Axis of the grid swept by FGEnvelopeSweep: a property and its values. */
+struct JSBSIM_API FGSweepAxis {
+  /// Name of the property set to the values of the axis.
+  std::string property;
+  /// Values taken by the property.
+  std::vector<double> values;
+};
+
+/** Trimmed state and linear model of a grid point computed by
+    FGEnvelopeSweep. */
+struct JSBSIM_API FGSweepPoint {
+  /// Values of the axes properties at this point.
+  std::vector<double> values;
+  /// true if the point has been trimmed (and linearized if requested).
+  bool success = false;
+  /// Index of the point which trim solution has been used as the initial
+  /// guess of this trim (-1 if the trim started from scratch).
+  int donor = -1;
+  /// Error messages issued while the point was computed.
+  std::string message;
+  /// Wall clock time spent computing the point (in seconds).
+  double wall_time = 0.0;
+  /// Values of the trim controls (see FGEnvelopeSweep::GetControlNames()).
+  std::vector<double> controls;
+  /// Trimmed state, input and output of the linear model.
+  std::vector<double> x0, u0, y0;
+  /// Matrices of the linear model (see FGLinearization).
+  std::vector<std::vector<double>> A, B, C, D;
+};
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DOCUMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/** Trims and linearizes an aircraft over a grid of flight conditions.
+    The grid is the cartesian product of a list of axes, each axis being a
+    property and the values it takes: an airspeed (ic/vc-kts), an altitude
+    (ic/h-sl-ft), the weight or the location of a point mass
+    (inertia/pointmass-weight-lbs[i], inertia/pointmass-location-X-inches[i]),
+    etc. The points are numbered with the last axis varying the fastest.
+
+    The aircraft is loaded once. Each worker thread then computes the points
+    on its own clone of the executive (see FGFDMExec::Clone()) which state is
+    reset before each point. The trim of a point is started from the solution
+    of a neighbor, the one that differs from it by a single step along its
+    first axis which index is not zero (or, if that neighbor could not be
+    trimmed, its nearest trimmed predecessor). A point is thus only scheduled
+    once its neighbor has been solved and if the warm started trim fails, it
+    is attempted again from scratch. Since the neighbor used to warm start a
+    point does not depend on the scheduling, the results do not depend on the
+    number of threads.
+
+    The grid can be built programmatically or read from an XML file:
+
+    @code{.xml}
+    <sweep>
+      <aircraft> c172x </aircraft>
+      <initfile> reset01 </initfile>
+      <trim> 0 </trim>
+      <linearize> 1 </linearize>
+      <output> c172x_envelope.bin </output>
+      <axis property="ic/vc-kts" min="70" max="120" points="6"/>
+      <axis property="ic/h-sl-ft"> 1000 4000 8000 </axis>
+      <property value="0"> fcs/flap-cmd-norm </property>
+    </sweep>
+    @endcode
+
+    The trim mode takes the same values as the property
+    simulation/do_simple_trim (0: longitudinal, 1: full, etc.) The properties
+    are set before the axes properties at every point.
+
+    The results are written by Write() to a compact binary file: a header
+    holding the axes, the names of the controls and of the linear model
+    variables followed by one fixed size record of little-endian values per
+    point. The Python module jsbsim.envelope_sweep reads them back.
+
+    @author The JSBSim team
+*/
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DECLARATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+class JSBSIM_API FGEnvelopeSweep
+{
+public:
+  /** Constructor
+      @param threads number of worker threads. If zero, the number of
+                     hardware threads is used. */
+  explicit FGEnvelopeSweep(unsigned int threads = 0);
+
+  /** Set the root directory from which the relative paths are resolved.
+      The aircraft, engine and systems directories are expected to be located
+      in this root directory. */
+  void SetRootDir(const SGPath& rootDir) { RootDir = rootDir; }
+  const SGPath& GetRootDir(void) const { return RootDir; }
+
+  /// Set the directory where the parsed XML files are cached.
+  void SetModelCachePath(const SGPath& path) { ModelCachePath = path; }
+  const SGPath& GetModelCachePath(void) const { return ModelCachePath; }
+
+  /// Set the number of worker threads (0 selects the hardware concurrency).
+  void SetThreads(unsigned int threads);
+  unsigned int GetThreads(void) const { return nThreads; }
+
+  /// Set the aircraft to trim.
+  void SetAircraft(const std::string& aircraft) { Aircraft = aircraft; }
+  const std::string& GetAircraft(void) const { return Aircraft; }
+
+  /// Set the initialization file from which the grid points are derived.
+  void SetInitFile(const SGPath& initfile) { InitFile = initfile; }
+  const SGPath& GetInitFile(void) const { return InitFile; }
+
+  /** Set the trim mode.
+      @param mode same values as the property simulation/do_simple_trim. */
+  void SetTrimMode(int mode) { Mode = mode; }
+  int GetTrimMode(void) const { return Mode; }
+
+  /// Set to false to trim the points without computing their linear model.
+  void SetLinearize(bool linearize) { Linearize = linearize; }
+  bool GetLinearize(void) const { return Linearize; }
+
+  /** Set the file where the standalone program writes the results (read from
+      the \<output> element by Load()). */
+  void SetOutputFile(const SGPath& path) { OutputFile = path; }
+  const SGPath& GetOutputFile(void) const { return OutputFile; }
+
+  /// Append an axis to the grid.
+  void AddAxis(const std::string& property, const std::vector<double>& values)
+  { Axes.push_back({property, values}); }
+  size_t GetNumAxes(void) const { return Axes.size(); }
+  const FGSweepAxis& GetAxis(size_t i) const { return Axes[i]; }
+
+  /// Add a property which value is set at every point of the grid.
+  void AddProperty(const std::string& property, double value)
+  { Properties.push_back({property, value}); }
+
+  /// Returns the number of points of the grid.
+  size_t GetNumPoints(void) const;
+
+  /** Read the grid specification from an XML file.
+      @param spec path to the file. Relative paths are taken from the root
+                  directory.
+      @return true if the file has been successfully read. */
+  bool Load(const SGPath& spec);
+
+  /** Trims and linearizes all the points of the grid.
+      The call blocks until all the points have been computed.
+      @return the results, in the same order as the points. */
+  const std::vector<FGSweepPoint>& Run(void);
+
+  /// Returns the results of the last call to Run().
+  const std::vector<FGSweepPoint>& GetResults(void) const { return Results; }
+
+  /// Names of the trim controls (available once Run() has been called).
+  const std::vector<std::string>& GetControlNames(void) const
+  { return ControlNames; }
+  /// Names and units of the linear model variables.
+  const std::vector<std::string>& GetStateNames(void) const { return StateNames; }
+  const std::vector<std::string>& GetStateUnits(void) const { return StateUnits; }
+  const std::vector<std::string>& GetInputNames(void) const { return InputNames; }
+  const std::vector<std::string>& GetInputUnits(void) const { return InputUnits; }
+  const std::vector<std::string>& GetOutputNames(void) const { return OutputNames; }
+  const std::vector<std::string>& GetOutputUnits(void) const { return OutputUnits; }
+
+  /** Write the results of the last call to Run() to a binary file.
+      @param path path to the file.
+      @return true if the file has been successfully written. */
+  bool Write(const SGPath& path) const;
+
+  /** Print a summary of the results in CSV format: one line per point with
+      its index, the values of the axes, its status, the index of the point
+      used as the initial guess of its trim, the wall clock time and the
+      values of the trim controls. */
+  void PrintResults(std::ostream& out) const;
+
+private:
+  unsigned int nThreads;
+  int Mode;
+  bool Linearize;
+  SGPath RootDir;
+  SGPath ModelCachePath;
+  SGPath InitFile;
+  SGPath OutputFile;
+  std::string Aircraft;
+  std::vector<FGSweepAxis> Axes;
+  std::vector<std::pair<std::string, double>> Properties;
+  std::vector<FGSweepPoint> Results;
+  std::vector<std::string> ControlNames;
+  std::vector<std::string> StateNames, StateUnits;
+  std::vector<std::string> InputNames, InputUnits;
+  std::vector<std::string> OutputNames, OutputUnits;
+
+  bool ReadAxis(Element* el);
+  int GetDonor(size_t point) const;
+  void SetPointProperties(FGFDMExec& fdmex, const FGSweepPoint& point) const;
+  void RunPoint(FGFDMExec& fdmex, const std::string& state, size_t point,
+                std::mutex& lock);
+};
+}
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+#endif
@@ -43,6 +43,7 @@ INCLUDES
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
 #include <iomanip>
+#include <numeric>
 
 #include "FGFDMExec.h"
 #include "models/atmosphere/FGStandardAtmosphere.h"
@@ -64,18 +65,97 @@ INCLUDES
 #include "initialization/FGLinearization.h"
 #include "input_output/FGScript.h"
 #include "input_output/FGXMLFileRead.h"
+#include "input_output/FGModelLoader.h"
 #include "input_output/string_utilities.h"
 #include "initialization/FGInitialCondition.h"
 #include "input_output/FGLog.h"
+#include "input_output/FGStateStream.h"
 
 using namespace std;
 
 namespace JSBSim {
 
+// Names of the models in the properties simulation/models/<name> and
+// simulation/profile/models/<name> (in the order of the eModels enum).
+static const char* const ModelNames[FGFDMExec::eNumStandardModels] = {
+  "propagate", "input", "inertial", "atmosphere", "winds", "systems",
+  "mass-balance", "auxiliary", "propulsion", "aerodynamics",
+  "ground-reactions", "external-reactions", "buoyant-forces", "aircraft",
+  "accelerations", "output"
+};
+
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 CLASS IMPLEMENTATION
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// The rigid body equations of motion seen as a system of ODEs by the adaptive
+// integrator. Each evaluation of the derivatives sets the vehicle state then
+// updates the ground reactions, the total forces and the accelerations.
+// The ground reactions have an internal state (strut compression, distances
+// traveled, etc.) that must only be advanced by the accepted steps so it is
+// restored before each evaluation.
+
+class FGFDMExec::FGRigidBodySystem : public FGRungeKuttaSystem
+{
+public:
+  explicit FGRigidBodySystem(FGFDMExec* fdmex)
+    : FDMExec(fdmex), x_accepted(0.0), last_step(0.0) {}
+
+  void Run(void) {
+    auto& Propagate = FDMExec->Propagate;
+
+    Propagate->GetStateVector(y);
+    Propagate->GetStateVectorDerivatives(dydx);
+    x_accepted = 0.0;
+    last_step = FDMExec->dT;
+    Save(accepted);
+    previous = accepted;
+
+    Propagate->GetStepper().evolve(0.0, FDMExec->dT, y, dydx, this);
+
+    // The ground reactions at the end of the time step are computed by the
+    // main loop of FGFDMExec::Run() once the other forces are updated.
+    Restore(previous);
+    Propagate->SetStateVector(y);
+    FDMExec->dTsubstep = last_step;
+  }
+
+  void pFunc(double x, const vector<double>& state,
+             vector<double>& deriv) override {
+    Restore(accepted);
+    FDMExec->Propagate->SetStateVector(state);
+    FDMExec->dTsubstep = x - x_accepted;
+    FDMExec->RunSubstepModels();
+    FDMExec->LoadInputs(ePropagate);
+    FDMExec->Propagate->GetStateVectorDerivatives(deriv);
+  }
+
+  void pAccept(double x) override {
+    last_step = x - x_accepted;
+    x_accepted = x;
+    previous.swap(accepted);
+    Save(accepted);
+  }
+
+private:
+  FGFDMExec* FDMExec;
+  double x_accepted, last_step;
+  vector<double> y, dydx;
+  string accepted, previous;
+
+  void Save(string& snapshot) const {
+    FGStateWriter state;
+    FDMExec->GroundReactions->SaveState(state);
+    snapshot = state.GetBuffer();
+  }
+
+  void Restore(const string& snapshot) const {
+    FGStateReader state(snapshot);
+    FDMExec->GroundReactions->RestoreState(state);
+  }
+};
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 // Constructor
 
@@ -87,6 +167,8 @@ FGFDMExec::FGFDMExec(FGPropertyManager* root, std::shared_ptr<unsigned int> fdmc
   disperse        = 0;
 
   RootDir = "";
+  PlanetLoadedFirst = false;
+  Documents = std::make_shared<FGDocumentCache>();
 
   modelLoaded = false;
   IsChild = false;
@@ -100,6 +182,11 @@ FGFDMExec::FGFDMExec(FGPropertyManager* root, std::shared_ptr<unsigned int> fdmc
   sim_time = 0.0;
   dT = 1.0/120.0; // a default timestep size. This is needed for when JSBSim is
                   // run in standalone mode with no initialization file.
+  dTsubstep = dT;
+
+  ScheduleValid = false;
+  Cycle = 0;
+  FrameProfile = nullptr;
 
   AircraftPath = "aircraft";
   EnginePath = "engine";
@@ -126,6 +213,7 @@ FGFDMExec::FGFDMExec(FGPropertyManager* root, std::shared_ptr<unsigned int> fdmc
 
   SGPropertyNode* instanceRoot = Root->getNode("fdm/jsbsim", IdFDM, true);
   instance = std::make_shared<FGPropertyManager>(instanceRoot);
+  Profiler = std::make_shared<FGProfiler>(instance);
 
   if (const char* num = getenv("JSBSIM_DISPERSE");
       num != nullptr && strtol(num, nullptr, 0) != 0)
@@ -161,6 +249,7 @@ FGFDMExec::FGFDMExec(FGPropertyManager* root, std::shared_ptr<unsigned int> fdmc
   instance->Tie("simulation/frame", reinterpret_cast<int*>(&Frame));
   instance->Tie("simulation/trim-completed", &trim_completed);
   instance->Tie("forces/hold-down", this, &FGFDMExec::GetHoldDown, &FGFDMExec::SetHoldDown);
+  BindModelsSchedule();
 
   Constructing = false;
 }
@@ -252,6 +341,13 @@ bool FGFDMExec::Allocate(void)
   Accelerations     = static_cast<FGAccelerations*>(Models[eAccelerations].get());
   Output            = static_cast<FGOutput*>(Models[eOutput].get());
 
+  Profiler->Clear();
+  FrameProfile = Profiler->Register("frame");
+  ModelProfiles.clear();
+  for (const char* name: ModelNames)
+    ModelProfiles.push_back(Profiler->Register(string("models/") + name));
+  ScheduleValid = false;
+
   // Initialize planet (environment) constants
   LoadPlanetConstants();
 
@@ -406,6 +502,7 @@ bool FGFDMExec::DeAllocate(void)
 bool FGFDMExec::Run(void)
 {
   bool success=true;
+  FGProfileScope profile(FrameProfile);
 
   Debug(2);
 
@@ -419,11 +516,21 @@ bool FGFDMExec::Run(void)
   // returns true if success, false if complete
   if (Script && !IntegrationSuspended()) success = Script->RunScript();
 
-  for (unsigned int i = 0; i < Models.size(); i++) {
-    LoadInputs(i);
-    Models[i]->Run(holding);
+  dTsubstep = dT;
+
+  if (!ScheduleValid) BuildSchedule();
+
+  if (!Schedule.empty()) {
+    for (unsigned int i: Schedule[Cycle % Schedule.size()])
+      RunModel(i);
+  }
+  else {
+    for (unsigned int i = 0; i < Models.size(); i++)
+      if (IsScheduled(i, Cycle)) RunModel(i);
   }
 
+  Cycle++;
+
   if (Terminate) success = false;
 
   return success;
@@ -431,13 +538,131 @@ bool FGFDMExec::Run(void)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGFDMExec::RunModel(unsigned int idx)
+{
+  FGProfileScope profile(ModelProfiles[idx]);
+
+  LoadInputs(idx);
+  if (idx == ePropagate)
+    RunPropagate();
+  else
+    Models[idx]->Run(holding);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGFDMExec::IsScheduled(unsigned int idx, uint64_t cycle) const
+{
+  unsigned int rate = Models[idx]->GetRate();
+
+  // A rate of 0 disables the model.
+  if (rate <= 1) return rate == 1;
+
+  return cycle % rate == Models[idx]->GetPhase() % rate;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Builds the list of the models to run at each frame of a cycle which period is
+// the least common multiple of the models rates.
+
+void FGFDMExec::BuildSchedule(void)
+{
+  // Beyond that period, the models are checked one by one at each frame.
+  constexpr uint64_t MaxSchedulePeriod = 1024;
+  uint64_t period = 1;
+
+  for (auto& model: Models) {
+    model->scheduled = true;
+    if (period <= MaxSchedulePeriod)
+      period = std::lcm(period, static_cast<uint64_t>(max(model->GetRate(), 1u)));
+  }
+
+  Schedule.clear();
+
+  if (period <= MaxSchedulePeriod) {
+    Schedule.resize(period);
+    for (unsigned int frame = 0; frame < period; frame++) {
+      for (unsigned int i = 0; i < Models.size(); i++)
+        if (IsScheduled(i, frame)) Schedule[frame].push_back(i);
+    }
+  }
+
+  ScheduleValid = true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGFDMExec::BindModelsSchedule(void)
+{
+  // The timing properties are aliases of the profiler statistics.
+  instance->Tie("simulation/models/timing", this, &FGFDMExec::GetModelTiming,
+                &FGFDMExec::SetModelTiming);
+
+  for (int i = 0; i < eNumStandardModels; i++) {
+    string base = string("simulation/models/") + ModelNames[i];
+    instance->Tie(base + "/rate", this, i, &FGFDMExec::GetModelRate,
+                  &FGFDMExec::SetModelRate);
+    instance->Tie(base + "/phase", this, i, &FGFDMExec::GetModelPhase,
+                  &FGFDMExec::SetModelPhase);
+    instance->Tie(base + "/exec-time-us", this, i, &FGFDMExec::GetModelExecTime);
+    instance->Tie(base + "/total-time-sec", this, i,
+                  &FGFDMExec::GetModelTotalTime);
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Integrates the rigid body equations of motion over the time step. When the
+// integration is sub-stepped, the forces that depend the most on the vehicle
+// state are updated between the sub-steps.
+
+void FGFDMExec::RunPropagate(void)
+{
+  if (holding || IntegrationSuspended()
+      || (Propagate->GetSubsteps() == 1 && !Propagate->GetAdaptive())) {
+    Propagate->Run(holding);
+    return;
+  }
+
+  if (Propagate->GetAdaptive()) {
+    if (!RigidBodySystem)
+      RigidBodySystem = std::make_unique<FGRigidBodySystem>(this);
+    RigidBodySystem->Run();
+    return;
+  }
+
+  int substeps = Propagate->GetSubsteps();
+  dTsubstep = dT / substeps;
+
+  for (int n = 1; n <= substeps; n++) {
+    LoadInputs(ePropagate);
+    Propagate->Run(false);
+    // The last update is made by the main loop of Run()
+    if (n < substeps) RunSubstepModels();
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGFDMExec::RunSubstepModels(void)
+{
+  // The models which are not scheduled at this frame (or disabled) keep their
+  // outputs constant over the time step like the other models.
+  for (unsigned int i: {eGroundReactions, eAircraft, eAccelerations}) {
+    if (!IsScheduled(i, Cycle)) continue;
+    LoadInputs(i);
+    Models[i]->Run(false);
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 void FGFDMExec::LoadInputs(unsigned int idx)
 {
   switch(idx) {
   case ePropagate:
     Propagate->in.vPQRidot     = Accelerations->GetPQRidot();
     Propagate->in.vUVWidot     = Accelerations->GetUVWidot();
-    Propagate->in.DeltaT       = dT;
+    Propagate->in.DeltaT       = dTsubstep;
     break;
   case eInput:
     break;
@@ -541,7 +766,7 @@ void FGFDMExec::LoadInputs(unsigned int idx)
     GroundReactions->in.UVW             = Propagate->GetUVW();
     GroundReactions->in.DistanceAGL     = Propagate->GetDistanceAGL();
     GroundReactions->in.DistanceASL     = Propagate->GetAltitudeASL();
-    GroundReactions->in.TotalDeltaT     = dT * GroundReactions->GetRate();
+    GroundReactions->in.TotalDeltaT     = dTsubstep * GroundReactions->GetRate();
     GroundReactions->in.WOW             = GroundReactions->GetWOW();
     GroundReactions->in.Location        = Propagate->GetLocation();
     GroundReactions->in.vXYZcg          = MassBalance->GetXYZcg();
@@ -592,7 +817,7 @@ void FGFDMExec::LoadInputs(unsigned int idx)
     Accelerations->in.vPQR     = Propagate->GetPQR();
     Accelerations->in.vUVW     = Propagate->GetUVW();
     Accelerations->in.vInertialPosition = Propagate->GetInertialPosition();
-    Accelerations->in.DeltaT   = dT;
+    Accelerations->in.DeltaT   = dTsubstep;
     Accelerations->in.Mass     = MassBalance->GetMass();
     Accelerations->in.MultipliersList = GroundReactions->GetMultipliersList();
     Accelerations->in.TerrainVelocity = Propagate->GetTerrainVelocity();
@@ -636,6 +861,7 @@ void FGFDMExec::LoadModelConstants(void)
 bool FGFDMExec::RunIC(void)
 {
   SuspendIntegration(); // saves the integration rate, dt, then sets it to 0.0.
+  Cycle = 0;
   Initialize(IC.get());
 
   Models[eInput]->InitModel();
@@ -701,6 +927,252 @@ void FGFDMExec::ResetToInitialConditions(int mode)
     RunIC();
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Collects the values of the properties that are not tied to a model. The tied
+// properties are restored by the models themselves and calling their setters
+// could have side effects (reset, trim, etc.)
+
+static void CollectUntiedProperties(const SGPropertyNode* node,
+                                    const string& path,
+                                    vector<const SGPropertyNode*>& nodes,
+                                    vector<string>& paths)
+{
+  for (int i=0; i<node->nChildren(); i++) {
+    const SGPropertyNode* child = node->getChild(i);
+    string child_path = path + child->getNameString();
+    if (child->getIndex() != 0)
+      child_path += "[" + to_string(child->getIndex()) + "]";
+
+    if (child->nChildren() > 0)
+      CollectUntiedProperties(child, child_path + "/", nodes, paths);
+    else if (!child->isTied()) {
+      switch (child->getType()) {
+      case simgear::props::BOOL:
+      case simgear::props::INT:
+      case simgear::props::LONG:
+      case simgear::props::FLOAT:
+      case simgear::props::DOUBLE:
+        nodes.push_back(child);
+        paths.push_back(child_path);
+        break;
+      default:
+        break;
+      }
+    }
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+static const string StateMagic = "JSBSim state";
+static const uint32_t StateVersion = 2;
+
+string FGFDMExec::SaveState(void) const
+{
+  return SaveState(true);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+string FGFDMExec::SaveState(bool withScript) const
+{
+  FGStateWriter state;
+
+  state.Write(StateMagic);
+  state.Write(StateVersion);
+  state.Write(modelName);
+
+  state.Section("FGFDMExec");
+  state.Write(sim_time);
+  state.Write(dT);
+  state.Write(saved_dT);
+  state.Write(Frame);
+  state.Write(Cycle);
+  state.Write(holding);
+  state.Write(IncrementThenHolding);
+  state.Write(TimeStepsUntilHold);
+  state.Write(Terminate);
+  state.Write(HoldDown);
+  state.Write(RandomSeed);
+  state.Write(RandomGenerator->GetState());
+
+  state.Section("FGInitialCondition");
+  IC->SaveState(state);
+
+  vector<const SGPropertyNode*> nodes;
+  vector<string> paths;
+  CollectUntiedProperties(instance->GetNode(), "", nodes, paths);
+
+  state.Section("Properties");
+  state.Write(static_cast<uint32_t>(nodes.size()));
+  for (size_t i=0; i<nodes.size(); i++) {
+    simgear::props::Type type = nodes[i]->getType();
+    state.Write(paths[i]);
+    state.Write(type);
+    // The integers are saved as such since a double cannot hold all the values
+    // of a long.
+    switch (type) {
+    case simgear::props::BOOL:
+    case simgear::props::INT:
+    case simgear::props::LONG:
+      state.Write(static_cast<int64_t>(nodes[i]->getLongValue()));
+      break;
+    default:
+      state.Write(nodes[i]->getDoubleValue());
+      break;
+    }
+  }
+
+  state.Write(withScript && Script);
+  if (withScript && Script) {
+    state.Section("FGScript");
+    Script->SaveState(state);
+  }
+
+  for (auto& model: Models) {
+    state.Section(model->GetName());
+    model->SaveState(state);
+  }
+
+  return state.GetBuffer();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGFDMExec::RestoreState(const string& blob)
+{
+  FGStateReader state(blob);
+  string magic, name, generator;
+  uint32_t version, count;
+
+  state.Read(magic);
+  if (magic != StateMagic)
+    throw BaseException("The data is not a JSBSim simulation state.");
+  state.Read(version);
+  if (version != StateVersion)
+    throw BaseException("Unsupported simulation state version: "
+                        + to_string(version));
+  state.Read(name);
+  if (name != modelName)
+    throw BaseException("The simulation state has been saved for the model "
+                        + name + " but the model " + modelName
+                        + " is loaded.");
+
+  state.Section("FGFDMExec");
+  state.Read(sim_time);
+  state.Read(dT);
+  state.Read(saved_dT);
+  state.Read(Frame);
+  state.Read(Cycle);
+  state.Read(holding);
+  state.Read(IncrementThenHolding);
+  state.Read(TimeStepsUntilHold);
+  state.Read(Terminate);
+  state.Read(HoldDown);
+  state.Read(RandomSeed);
+  state.Read(generator);
+  RandomGenerator->SetState(generator);
+
+  state.Section("FGInitialCondition");
+  IC->RestoreState(state);
+
+  state.Section("Properties");
+  state.Read(count);
+  for (uint32_t i=0; i<count; i++) {
+    string path;
+    simgear::props::Type type;
+    int64_t integer = 0;
+    double value = 0.0;
+    state.Read(path);
+    state.Read(type);
+
+    switch (type) {
+    case simgear::props::BOOL:
+    case simgear::props::INT:
+    case simgear::props::LONG:
+      state.Read(integer);
+      break;
+    default:
+      state.Read(value);
+      break;
+    }
+
+    SGPropertyNode* node = instance->GetNode(path, true);
+    if (node->isTied()) continue;
+
+    switch (type) {
+    case simgear::props::BOOL:
+      node->setBoolValue(integer != 0);
+      break;
+    case simgear::props::INT:
+      node->setIntValue(static_cast<int>(integer));
+      break;
+    case simgear::props::LONG:
+      node->setLongValue(static_cast<long>(integer));
+      break;
+    case simgear::props::FLOAT:
+      node->setFloatValue(static_cast<float>(value));
+      break;
+    default:
+      node->setDoubleValue(value);
+      break;
+    }
+  }
+
+  bool hasScript;
+  state.Read(hasScript);
+  if (hasScript != (Script != nullptr))
+    throw BaseException("The simulation state does not match the script.");
+  if (Script) {
+    state.Section("FGScript");
+    Script->RestoreState(state);
+  }
+
+  for (auto& model: Models) {
+    state.Section(model->GetName());
+    model->RestoreState(state);
+  }
+
+  ScheduleValid = false;
+
+  if (!state.AtEnd())
+    throw BaseException("The simulation state does not match the model.");
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+unique_ptr<FGFDMExec> FGFDMExec::Clone(void)
+{
+  if (!modelLoaded)
+    throw BaseException("An executive can be cloned only after its model is loaded.");
+
+  auto clone = make_unique<FGFDMExec>();
+
+  clone->RootDir = RootDir;
+  clone->EnginePath = EnginePath;
+  clone->SystemsPath = SystemsPath;
+  clone->OutputPath = OutputPath;
+  clone->Documents = Documents;
+
+  if (!PlanetFile.isNull() && PlanetLoadedFirst)
+    clone->LoadPlanet(PlanetFile, false);
+
+  // FullAircraftPath already contains the model directory if it was required.
+  clone->AircraftPath = FullAircraftPath;
+  bool result = clone->LoadModel(modelName, false);
+  clone->AircraftPath = AircraftPath;
+
+  if (!result)
+    throw BaseException("The model " + modelName + " could not be cloned.");
+
+  if (!PlanetFile.isNull() && !PlanetLoadedFirst)
+    clone->LoadPlanet(PlanetFile, false);
+
+  clone->RestoreState(SaveState(false));
+
+  return clone;
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
 void FGFDMExec::SetHoldDown(bool hd)
@@ -738,6 +1210,14 @@ bool FGFDMExec::LoadScript(const SGPath& script, double deltaT,
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGFDMExec::SetModelCachePath(const SGPath& path)
+{
+  ModelCachePath = path.isNull() ? path : GetFullPath(path);
+  Documents->SetCachePath(ModelCachePath);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 bool FGFDMExec::LoadPlanet(const SGPath& PlanetPath, bool useAircraftPath)
 {
   SGPath PlanetFileName;
@@ -748,8 +1228,8 @@ bool FGFDMExec::LoadPlanet(const SGPath& PlanetPath, bool useAircraftPath)
     PlanetFileName = PlanetPath;
   }
 
-  FGXMLFileRead XMLFileRead;
-  Element* document = XMLFileRead.LoadXMLDocument(PlanetFileName);
+  std::lock_guard<std::mutex> lock(Documents->GetMutex());
+  Element_ptr document = Documents->Load(PlanetFileName);
 
   // Make sure that the document is valid
   if (!document) {
@@ -766,7 +1246,12 @@ bool FGFDMExec::LoadPlanet(const SGPath& PlanetPath, bool useAircraftPath)
 
   bool result = LoadPlanet(document);
 
-  if (!result) {
+  if (result) {
+    // Keep track of the planet file so that it is loaded by the clones.
+    PlanetFile = PlanetFileName;
+    PlanetLoadedFirst = !modelLoaded;
+  }
+  else {
     FGXMLLogging log(document, LogLevel::ERROR);
     log << endl << "Planet element has problems in file " << PlanetFileName << endl;
   }
@@ -805,6 +1290,7 @@ bool FGFDMExec::LoadPlanet(Element* element)
       if (newAtmosphere) {
         Models[eAtmosphere] = newAtmosphere;
         Atmosphere = static_cast<FGAtmosphere*>(Models[eAtmosphere].get());
+        ScheduleValid = false;
 
         // Model initialization sequence
         LoadInputs(eAtmosphere);
@@ -859,11 +1345,15 @@ bool FGFDMExec::LoadModel(const string& model, bool addModelToPath)
   if (modelLoaded) {
     DeAllocate();
     Allocate();
+    // The files are read again when the model is reloaded.
+    Documents = std::make_shared<FGDocumentCache>();
+    Documents->SetCachePath(ModelCachePath);
+    PlanetFile = SGPath();
   }
 
   int saved_debug_lvl = debug_lvl;
-  FGXMLFileRead XMLFileRead;
-  Element *document = XMLFileRead.LoadXMLDocument(aircraftCfgFileName); // "document" is a class member
+  std::lock_guard<std::mutex> lock(Documents->GetMutex());
+  Element_ptr document = Documents->Load(aircraftCfgFileName);
 
   if (document) {
     if (IsChild) debug_lvl = 0;
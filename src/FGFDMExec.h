@@ -41,12 +41,15 @@ SENTRY
 INCLUDES
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
+#include <algorithm>
+#include <cstdint>
 #include <memory>
 
 #include "models/FGPropagate.h"
 #include "models/FGOutput.h"
 #include "models/FGInput.h"
 #include "math/FGTemplateFunc.h"
+#include "input_output/FGProfiler.h"
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 FORWARD DECLARATIONS
@@ -70,6 +73,7 @@ class FGInertial;
 class FGPropulsion;
 class FGMassBalance;
 class FGLogger;
+class FGDocumentCache;
 
 class TrimFailureException : public BaseException {
   public:
@@ -144,6 +148,37 @@ CLASS DOCUMENTATION
     tests that reveal some aspects of simulated aircraft performance, such as
     range, time-to-climb, takeoff distance, etc.
 
+    <h3>Models scheduling</h3>
+
+    Each model runs at its own rate and phase (see FGModel::SetRate() and
+    FGModel::SetPhase()): a model which rate is N frames runs at the frames
+    which index modulo N equals its phase, the frames being counted from the
+    last call to RunIC(). From these rates, the executive builds a cyclic
+    schedule which period is the least common multiple of the rates and that
+    lists, for each frame of the cycle, the models that must run. The models
+    that are not scheduled for a frame are not called at all and their inputs
+    are not copied. By default all the models run at every frame.
+
+    The rate and phase of each model can be set with the properties
+    simulation/models/<name>/rate and simulation/models/<name>/phase, the
+    names being propagate, input, inertial, atmosphere, winds, systems,
+    mass-balance, auxiliary, propulsion, aerodynamics, ground-reactions,
+    external-reactions, buoyant-forces, aircraft, accelerations and output.
+    The channels of the FCS and the outputs have their own rates and phases
+    (see FGFCSChannel and FGOutputType).
+
+    The time spent in each frame, in each model, in each FCS channel and
+    component and in each aerodynamic function can be measured by the profiler
+    of the executive (see FGProfiler and GetProfiler()). The statistics of the
+    frame and of the models are exposed under simulation/profile/frame and
+    simulation/profile/models/<name>, those of the FCS channels and components
+    under simulation/profile/systems/<channel>/<component> and those of the
+    aerodynamic functions under simulation/profile/aerodynamics/<function>.
+    The properties simulation/models/timing (enables the profiler),
+    simulation/models/<name>/exec-time-us (the duration of the last execution
+    of the model in microseconds) and simulation/models/<name>/total-time-sec
+    (the total time spent in the model) are also provided.
+
     <h3>JSBSim Debugging Directives</h3>
 
     This describes to any interested entity the debug level
@@ -244,6 +279,12 @@ public:
   void Unbind(void) {instance->Unbind();}
 
   /** This function executes each scheduled model in succession.
+      When the rigid body equations of motion are sub-stepped (see
+      FGPropagate), the ground reactions, the total forces and the
+      accelerations are updated at each sub-step, the other models being run
+      once per time step. At a frame where one of these 3 models is not
+      scheduled (see the simulation/models/<name>/rate and phase properties),
+      it is not run at the sub-steps either.
       @return true if successful, false if sim should be ended  */
   bool Run(void);
 
@@ -350,6 +391,14 @@ public:
     return true;
   }
 
+  /** Set the directory where the parsed XML files of the models are cached.
+      The cache is disabled if the path is empty (the default).
+      Relative paths are taken from the root directory.
+      @param path path to an existing directory.
+      @see FGModelCache
+      @see GetModelCachePath */
+  void SetModelCachePath(const SGPath& path);
+
   /// @name Top-level executive State and Model retrieval mechanism
   ///@{
   /// Returns the FGAtmosphere pointer.
@@ -402,6 +451,8 @@ public:
   const SGPath& GetFullAircraftPath(void) { return FullAircraftPath; }
   /// Retrieves the path to the output files.
   const SGPath& GetOutputPath(void) { return OutputPath; }
+  /// Retrieves the directory where the parsed XML files are cached.
+  const SGPath& GetModelCachePath(void) { return ModelCachePath; }
 
   /** Retrieves the value of a property.
       @param property the name of the property
@@ -510,6 +561,52 @@ public:
       surface deflections which would've been reset.
       @param mode Sets the reset mode.*/
   void ResetToInitialConditions(int mode);
+
+  /** Saves the complete state of the simulation in a binary blob.
+      The blob contains the executive state (time, frame counter, random
+      number generator), the values of all the properties that are not tied
+      to a model, the state of the script events and the internal state of
+      every model (integrator history, FCS components, engines, tanks,
+      landing gears, turbulence, etc.)
+
+      Restoring the blob with RestoreState() in this executive or in another
+      executive that has loaded the same aircraft (and the same script if
+      any) allows to branch a simulation: the runs that are resumed from the
+      blob are bit for bit identical to the original run.
+
+      The child FDMs are not included in the blob. The blob is saved in the
+      native binary format of the machine and is not meant to be exchanged
+      between different builds of JSBSim.
+      @return the binary blob. */
+  std::string SaveState(void) const;
+  /** Restores the state of the simulation saved by SaveState().
+      A BaseException is thrown if the blob has not been produced by the same
+      aircraft model. In that case the state of the simulation is undefined.
+      @param state the binary blob returned by SaveState(). */
+  void RestoreState(const std::string& state);
+
+  /** Creates a new executive that runs the same model as this one.
+      The clone gets its own property tree and its own models but it shares
+      the XML documents of the aircraft, engines and systems with this
+      executive so that no file is read nor parsed again. The state of this
+      executive (including the initial conditions) is then copied to the
+      clone with SaveState() and RestoreState() so that both simulations
+      continue from the same point.
+
+      The script, the child FDMs and the output directives that have been
+      added after the model was loaded are not copied. The outputs defined in
+      the aircraft file are duplicated so the name of their files should be
+      changed with SetOutputFileName() before the clone is run.
+
+      The clones of an executive can be created from several threads
+      concurrently but the executive itself must not be running while it is
+      cloned.
+      @return the new executive. */
+  std::unique_ptr<FGFDMExec> Clone(void);
+
+  /// Returns the cache of the XML documents shared with the clones.
+  std::shared_ptr<FGDocumentCache> GetDocumentCache(void) const
+  { return Documents; }
   /// Sets the debug level.
   void SetDebugLevel(int level) {debug_lvl = level;}
 
@@ -602,6 +699,13 @@ public:
   /** Retrieves the current frame count. */
   unsigned int GetFrame(void) const {return Frame;}
 
+  /// Returns the profiler that measures the time spent in the models.
+  std::shared_ptr<FGProfiler> GetProfiler(void) const { return Profiler; }
+
+  /** Requests the schedule of the models to be rebuilt before the next frame.
+      This is called by the models when their rate or phase is modified. */
+  void InvalidateSchedule(void) { ScheduleValid = false; }
+
   /** Retrieves the current debug level setting. */
   int GetDebugLevel(void) const {return debug_lvl;};
 
@@ -639,6 +743,7 @@ private:
   bool Terminate;
   double dT;
   double saved_dT;
+  double dTsubstep;
   double sim_time;
   bool holding;
   bool IncrementThenHolding;
@@ -652,9 +757,13 @@ private:
   SGPath EnginePath;
   SGPath SystemsPath;
   SGPath OutputPath;
+  SGPath ModelCachePath;
   std::string CFGVersion;
   std::string Release;
   SGPath RootDir;
+  SGPath PlanetFile;
+  bool PlanetLoadedFirst;
+  std::shared_ptr<FGDocumentCache> Documents;
 
   // Standard Model pointers - shortcuts for internal executive use only.
   // DO NOT TRY TO DELETE THEM !!!
@@ -700,11 +809,41 @@ private:
   std::vector <std::shared_ptr<FGModel>> Models;
   std::map<std::string, FGTemplateFunc_ptr> TemplateFunctions;
 
+  class FGRigidBodySystem;
+  std::unique_ptr<FGRigidBodySystem> RigidBodySystem;
+
+  // Indices of the models to run at each frame of the schedule cycle. The
+  // schedule is left empty when its period is too large, the models being then
+  // checked one by one at each frame.
+  std::vector<std::vector<unsigned int>> Schedule;
+  bool ScheduleValid;
+  // Number of frames run since the last call to RunIC()
+  uint64_t Cycle;
+
+  std::shared_ptr<FGProfiler> Profiler;
+  FGProfileEntry* FrameProfile;
+  std::vector<FGProfileEntry*> ModelProfiles;
+
+  std::string SaveState(bool withScript) const;
   bool ReadFileHeader(Element*);
   bool ReadChild(Element*);
   bool ReadPrologue(Element*);
   void SRand(int sr);
   void LoadInputs(unsigned int idx);
+  void BuildSchedule(void);
+  bool IsScheduled(unsigned int idx, uint64_t cycle) const;
+  void RunModel(unsigned int idx);
+  void BindModelsSchedule(void);
+  int GetModelRate(int idx) const { return Models[idx]->GetRate(); }
+  void SetModelRate(int idx, int rate) { Models[idx]->SetRate(std::max(rate, 0)); }
+  int GetModelPhase(int idx) const { return Models[idx]->GetPhase(); }
+  void SetModelPhase(int idx, int phase) { Models[idx]->SetPhase(std::max(phase, 0)); }
+  bool GetModelTiming(void) const { return Profiler->IsEnabled(); }
+  void SetModelTiming(bool timing) { Profiler->SetEnabled(timing); }
+  double GetModelExecTime(int idx) const { return ModelProfiles[idx]->last * 1E6; }
+  double GetModelTotalTime(int idx) const { return ModelProfiles[idx]->total; }
+  void RunPropagate(void);
+  void RunSubstepModels(void);
   void LoadPlanetConstants(void);
   bool LoadPlanet(Element* el);
   void LoadModelConstants(void);
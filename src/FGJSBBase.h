@@ -42,6 +42,9 @@ INCLUDES
 #include <stdexcept>
 #include <random>
 #include <chrono>
+#include <atomic>
+#include <sstream>
+#include <string>
 
 #include "JSBSim_API.h"
 
@@ -91,6 +94,21 @@ class JSBSIM_API RandomNumberGenerator {
     /** Get a random number which probability of occurrence is following Gauss
      * normal distribution with a mean of 0.0 and a standard deviation of 1.0 */
     double GetNormalRandomNumber(void) { return normal_random(generator); }
+    /** Get the internal state of the generator and of its distributions. The
+     * state is returned as a string that can be passed to SetState(). */
+    std::string GetState(void) const {
+      std::ostringstream state;
+      state << generator << ' ' << uniform_random << ' ' << normal_random;
+      return state.str();
+    }
+    /** Restore the internal state of the generator and of its distributions
+     * from a string returned by GetState(). */
+    void SetState(const std::string& value) {
+      std::istringstream state(value);
+      state >> generator >> uniform_random >> normal_random;
+      if (state.fail())
+        throw BaseException("Invalid random number generator state.");
+    }
   private:
     std::default_random_engine generator;
     std::uniform_real_distribution<double> uniform_random;
@@ -145,7 +163,10 @@ public:
   *   @return The version number of JSBSim. */
   static const std::string& GetVersion(void) {return JSBSim_version;}
 
-  static short debug_lvl;
+  /** The debug level is shared by all the FGFDMExec instances of the process.
+      It is atomic so that executives running in separate threads can read and
+      modify it without data races. */
+  static std::atomic<short> debug_lvl;
 
   /** Converts from degrees Kelvin to degrees Fahrenheit.
   *   @param kelvin The temperature in degrees Kelvin.
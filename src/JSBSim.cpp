@@ -40,9 +40,12 @@ INCLUDES
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
 #include "initialization/FGTrim.h"
+#include "FGBatchRunner.h"
+#include "FGEnvelopeSweep.h"
 #include "initialization/FGInitialCondition.h"
 #include "FGFDMExec.h"
 #include "input_output/FGXMLFileRead.h"
+#include "input_output/FGScript.h"
 #include "input_output/string_utilities.h"
 
 #if !defined(__GNUC__) && !defined(sgi) && !defined(_MSC_VER)
@@ -86,11 +89,14 @@ GLOBAL DATA
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
 SGPath RootDir;
+SGPath ModelCachePath;
 SGPath OutputPath;
 SGPath ScriptName;
 string AircraftName;
 SGPath ResetName;
 SGPath PlanetName;
+SGPath BatchName;
+SGPath SweepName;
 vector <string> LogOutputName;
 vector <SGPath> LogDirectiveName;
 vector <string> CommandLineProperties;
@@ -103,11 +109,15 @@ bool play_nice;
 bool suspend;
 bool catalog;
 bool nohighlight;
+bool script_summary;
+bool profile;
 
 double end_time = 1e99;
 double simulation_rate = 1./120.;
 bool override_sim_rate = false;
 double sleep_period=0.01;
+unsigned int batch_threads = 0;
+bool override_end_time = false;
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 FORWARD DECLARATIONS
@@ -115,6 +125,8 @@ FORWARD DECLARATIONS
 
 bool options(int, char**);
 int real_main(int argc, char* argv[]);
+int run_batch(void);
+int run_sweep(void);
 void PrintHelp(void);
 
 #if defined(__BORLANDC__) || defined(_MSC_VER) || defined(__MINGW32__)
@@ -336,7 +348,7 @@ int main(int argc, char* argv[])
 #endif
 
   try {
-    real_main(argc, argv);
+    return real_main(argc, argv);
   } catch (string& msg) {
     std::cerr << "FATAL ERROR: JSBSim terminated with an exception."
               << std::endl << "The message was: " << msg << std::endl;
@@ -382,6 +394,8 @@ int real_main(int argc, char* argv[])
   suspend = false;
   catalog = false;
   nohighlight = false;
+  script_summary = false;
+  profile = false;
 
   // *** PARSE OPTIONS PASSED INTO THIS SPECIFIC APPLICATION: JSBSim *** //
   success = options(argc, argv);
@@ -390,6 +404,9 @@ int real_main(int argc, char* argv[])
     exit(-1);
   }
 
+  if (!BatchName.isNull()) return run_batch();
+  if (!SweepName.isNull()) return run_sweep();
+
   // *** SET UP JSBSIM *** //
   FDMExec = new JSBSim::FGFDMExec();
   FDMExec->SetRootDir(RootDir);
@@ -397,6 +414,7 @@ int real_main(int argc, char* argv[])
   FDMExec->SetEnginePath(SGPath("engine"));
   FDMExec->SetSystemsPath(SGPath("systems"));
   FDMExec->SetOutputPath(OutputPath);
+  if (!ModelCachePath.isNull()) FDMExec->SetModelCachePath(ModelCachePath);
   FDMExec->GetPropertyManager()->Tie("simulation/frame_start_time", &actual_elapsed_time);
   FDMExec->GetPropertyManager()->Tie("simulation/cycle_duration", &cycle_duration);
 
@@ -556,6 +574,10 @@ int real_main(int argc, char* argv[])
     }
   }
 
+  // The profiling starts with the execution: the initialization and the trim
+  // are not accounted for.
+  if (profile) FDMExec->GetProfiler()->SetEnabled(true);
+
   {
     // Using FGLogging class so that the parameter --nohighlight can disable the formatting
     JSBSim::FGLogging out(JSBSim::LogLevel::STDOUT);
@@ -634,6 +656,11 @@ int real_main(int argc, char* argv[])
 
   }
 
+  if (script_summary && !ScriptName.isNull())
+    FDMExec->GetScript()->PrintSummary();
+
+  if (profile) FDMExec->GetProfiler()->PrintReport(cout);
+
   // PRINT ENDING CLOCK TIME
   time(&tod);
 #if defined(_MSC_VER) || defined(__MINGW32__)
@@ -687,6 +714,10 @@ bool options(int count, char **arg)
       exit (0);
     } else if (keyword == "--realtime") {
       realtime = true;
+    } else if (keyword == "--script-summary") {
+      script_summary = true;
+    } else if (keyword == "--profile") {
+      profile = true;
     } else if (keyword == "--nice") {
       play_nice = true;
       if (n != string::npos) {
@@ -728,6 +759,13 @@ bool options(int count, char **arg)
         gripe;
         exit(1);
       }
+    } else if (keyword == "--modelcache") {
+      if (n != string::npos) {
+        ModelCachePath = SGPath::fromLocal8Bit(value.c_str());
+      } else {
+        gripe;
+        exit(1);
+      }
     } else if (keyword == "--aircraft") {
       if (n != string::npos) {
         AircraftName = value;
@@ -742,6 +780,32 @@ bool options(int count, char **arg)
         gripe;
         exit(1);
       }
+    } else if (keyword == "--batch") {
+      if (n != string::npos) {
+        BatchName = SGPath::fromLocal8Bit(value.c_str());
+      } else {
+        gripe;
+        exit(1);
+      }
+    } else if (keyword == "--sweep") {
+      if (n != string::npos) {
+        SweepName = SGPath::fromLocal8Bit(value.c_str());
+      } else {
+        gripe;
+        exit(1);
+      }
+    } else if (keyword == "--threads") {
+      if (n != string::npos) {
+        try {
+          batch_threads = static_cast<unsigned int>(JSBSim::atof_locale_c(value.c_str()));
+        } catch (...) {
+          cerr << endl << "  Invalid number of threads given!" << endl << endl;
+          result = false;
+        }
+      } else {
+        gripe;
+        exit(1);
+      }
     } else if (keyword == "--initfile") {
       if (n != string::npos) {
         ResetName = SGPath::fromLocal8Bit(value.c_str());
@@ -778,6 +842,7 @@ bool options(int count, char **arg)
       if (n != string::npos) {
         try {
           end_time = JSBSim::atof_locale_c( value.c_str() );
+          override_end_time = true;
         } catch (...) {
           cerr << endl << "  Invalid end time given!" << endl << endl;
           result = false;
@@ -844,6 +909,15 @@ bool options(int count, char **arg)
     cerr << "You cannot specify an aircraft file with a script." << endl;
     result = false;
   }
+  if (!BatchName.isNull() && (!ScriptName.isNull() || !AircraftName.empty())) {
+    cerr << "You cannot specify a script or an aircraft with a batch file." << endl;
+    result = false;
+  }
+  if (!SweepName.isNull() && (!ScriptName.isNull() || !AircraftName.empty()
+                              || !BatchName.isNull())) {
+    cerr << "You cannot specify a script, an aircraft or a batch file with a sweep file." << endl;
+    result = false;
+  }
 
   return result;
 
@@ -867,8 +941,13 @@ void PrintHelp(void)
     cout << "    --logdirectivefile=<filename>  specifies the name of a data logging directives file" << endl;
     cout << "                                   (can appear multiple times)" << endl;
     cout << "    --outputpath=<path> specifies the directory where the output files will be written." << endl;
+    cout << "    --modelcache=<path> specifies an existing directory where the parsed model files are cached" << endl;
     cout << "    --realtime  specifies to run in actual real world time" << endl;
     cout << "    --nice  specifies to run at lower CPU usage" << endl;
+    cout << "    --script-summary  specifies to print how many times the condition of each script" << endl;
+    cout << "                      event has been tested and the event executed at the end of the run" << endl;
+    cout << "    --profile  specifies to measure the time spent in the models, the FCS channels and" << endl;
+    cout << "               components and the aerodynamic functions and to print a report at the end" << endl;
     cout << "    --nohighlight  specifies that console output should be pure text only (no color)" << endl;
     cout << "    --suspend  specifies to suspend the simulation after initialization" << endl;
     cout << "    --catalog specifies that all properties for this aircraft model should be printed" << endl;
@@ -877,8 +956,91 @@ void PrintHelp(void)
     cout << "    --simulation-rate=<rate (double)> specifies the sim dT time or frequency" << endl;
     cout << "                      If rate specified is less than 1, it is interpreted as" << endl;
     cout << "                      a time step size, otherwise it is assumed to be a rate in Hertz." << endl;
-    cout << "    --end=<time (double)> specifies the sim end time" << endl << endl;
+    cout << "    --end=<time (double)> specifies the sim end time" << endl;
+    cout << "    --batch=<filename>  runs the cases listed in a batch file concurrently and" << endl;
+    cout << "                        prints their results in CSV format" << endl;
+    cout << "    --sweep=<filename>  trims and linearizes an aircraft over the grid of flight conditions" << endl;
+    cout << "                        described in a sweep file and prints a summary in CSV format" << endl;
+    cout << "    --threads=<number>  specifies the number of threads used to run a batch or a sweep file" << endl;
+    cout << "                        (defaults to the number of hardware threads)" << endl << endl;
 
     cout << "  NOTE: There can be no spaces around the = sign when" << endl;
     cout << "        an option is followed by a filename" << endl << endl;
 }
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+int run_batch(void)
+{
+  JSBSim::FGBatchRunner runner(batch_threads);
+
+  // The executives are running concurrently so their console output would be
+  // interleaved: only the errors are reported, case by case, once the batch
+  // is completed.
+  JSBSim::FGJSBBase::debug_lvl = 0;
+
+  runner.SetRootDir(RootDir);
+  runner.SetOutputPath(OutputPath);
+  runner.SetModelCachePath(ModelCachePath);
+  if (override_end_time) runner.SetDefaultEndTime(end_time);
+
+  if (!runner.Load(BatchName)) {
+    cerr << "Batch file " << BatchName << " was not successfully loaded" << endl;
+    return 1;
+  }
+
+  if (override_sim_rate)
+    runner.SetDefaultDeltaT(simulation_rate < 1.0 ? simulation_rate
+                                                  : 1.0/simulation_rate);
+
+  auto& results = runner.Run();
+  runner.PrintResults(cout);
+
+  int failures = 0;
+  for (auto& result: results) {
+    if (!result.success) {
+      cerr << "Case " << result.name << " failed:" << endl << result.message;
+      ++failures;
+    }
+  }
+
+  return failures == 0 ? 0 : 1;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+int run_sweep(void)
+{
+  JSBSim::FGEnvelopeSweep sweep(batch_threads);
+
+  // Same as run_batch(): only the errors are reported once the sweep is
+  // completed.
+  JSBSim::FGJSBBase::debug_lvl = 0;
+
+  sweep.SetRootDir(RootDir);
+  sweep.SetModelCachePath(ModelCachePath);
+
+  if (!sweep.Load(SweepName)) {
+    cerr << "Sweep file " << SweepName << " was not successfully loaded" << endl;
+    return 1;
+  }
+
+  auto& results = sweep.Run();
+  sweep.PrintResults(cout);
+
+  int failures = 0;
+  for (size_t i=0; i<results.size(); ++i) {
+    if (!results[i].success) {
+      cerr << "Point " << i << " failed:" << endl << results[i].message;
+      ++failures;
+    }
+  }
+
+  if (!sweep.GetOutputFile().isNull()) {
+    SGPath output = sweep.GetOutputFile();
+    if (output.isRelative()) output = OutputPath/output.utf8Str();
+    if (!sweep.Write(output)) return 1;
+  }
+
+  return failures == 0 ? 0 : 1;
+}
@@ -54,6 +54,7 @@ INCLUDES
 #include "FGFDMExec.h"
 #include "input_output/string_utilities.h"
 #include "input_output/FGLog.h"
+#include "input_output/FGStateStream.h"
 
 using namespace std;
 
@@ -1596,6 +1597,50 @@ void FGInitialCondition::bind(FGPropertyManager* PropertyManager)
                        &FGInitialCondition::SetTargetNlfIC);
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGInitialCondition::SaveState(FGStateWriter& state) const
+{
+  state.Write(vUVW_NED);
+  state.Write(vPQR_body);
+  state.Write(position);
+  state.Write(orientation);
+  state.Write(vt);
+  state.Write(targetNlfIC);
+  state.Write(Tw2b);
+  state.Write(Tb2w);
+  state.Write(alpha);
+  state.Write(beta);
+  state.Write(epa);
+  state.Write(lastSpeedSet);
+  state.Write(lastAltitudeSet);
+  state.Write(lastLatitudeSet);
+  state.Write(enginesRunning);
+  state.Write(trimRequested);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGInitialCondition::RestoreState(FGStateReader& state)
+{
+  state.Read(vUVW_NED);
+  state.Read(vPQR_body);
+  state.Read(position);
+  state.Read(orientation);
+  state.Read(vt);
+  state.Read(targetNlfIC);
+  state.Read(Tw2b);
+  state.Read(Tb2w);
+  state.Read(alpha);
+  state.Read(beta);
+  state.Read(epa);
+  state.Read(lastSpeedSet);
+  state.Read(lastAltitudeSet);
+  state.Read(lastLatitudeSet);
+  state.Read(enginesRunning);
+  state.Read(trimRequested);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
@@ -66,6 +66,8 @@ class FGAircraft;
 class FGAuxiliary;
 class FGPropertyManager;
 class Element;
+class FGStateWriter;
+class FGStateReader;
 
 typedef enum { setvt, setvc, setve, setmach, setuvw, setned, setvg } speedset;
 typedef enum { setasl, setagl } altitudeset;
@@ -689,6 +691,13 @@ public:
 
   void bind(FGPropertyManager* pm);
 
+  /** Saves the initial conditions in a simulation state.
+      @see FGFDMExec::SaveState */
+  void SaveState(FGStateWriter& state) const;
+  /** Restores the initial conditions from a simulation state.
+      @see FGFDMExec::RestoreState */
+  void RestoreState(FGStateReader& state);
+
 private:
   FGColumnVector3 vUVW_NED;
   FGColumnVector3 vPQR_body;
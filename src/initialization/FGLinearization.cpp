@@ -23,10 +23,11 @@
 
 namespace JSBSim {
 
-FGLinearization::FGLinearization(FGFDMExec * fdm)
+FGLinearization::FGLinearization(FGFDMExec * fdm, unsigned int threads)
     : aircraft_name(fdm->GetAircraft()->GetAircraftName())
 {
     FGStateSpace ss(fdm);
+    ss.setThreads(threads);
     ss.x.add(new FGStateSpace::Vt);
     ss.x.add(new FGStateSpace::Alpha);
     ss.x.add(new FGStateSpace::Theta);
@@ -71,9 +72,12 @@ FGLinearization::FGLinearization(FGFDMExec * fdm)
     u0 = ss.u.get();
     y0 = x0; // state feedback
 
+    // The components suspend and resume the integration by themselves which
+    // overwrites the time step saved by SuspendIntegration().
+    double dt = fdm->GetDeltaT();
     fdm->SuspendIntegration();
     ss.linearize(x0, u0, y0, A, B, C, D);
-    fdm->ResumeIntegration();
+    fdm->Setdt(dt);
 
     x_names = ss.x.getName();
     u_names = ss.u.getName();
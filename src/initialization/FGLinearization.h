@@ -45,8 +45,10 @@ class JSBSIM_API FGLinearization
 public:
     /**
      * @param fdmPtr Already configured FGFDMExec instance used to create the new linear model.
+     * @param threads Number of threads computing the matrices, each on a clone of
+     *                fdmPtr (0 selects the hardware concurrency).
      */
-    FGLinearization(FGFDMExec * fdmPtr);
+    FGLinearization(FGFDMExec * fdmPtr, unsigned int threads=1);
 
     /**
      * Write Scicoslab source file with the state space model to a
@@ -127,6 +127,24 @@ void FGTrim::Report(void) {
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+vector<double> FGTrim::GetControls(void) {
+  vector<double> controls;
+  for (auto& axis: TrimAxes)
+    controls.push_back(axis.GetControl());
+  return controls;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+vector<string> FGTrim::GetControlNames(void) {
+  vector<string> names;
+  for (auto& axis: TrimAxes)
+    names.push_back(axis.GetControlName());
+  return names;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 void FGTrim::ClearStates(void) {
     mode=tCustom;
     TrimAxes.clear();
@@ -227,6 +245,11 @@ bool FGTrim::DoTrim(void) {
     TrimAxes[2].SetControlLimits(phi - 30.0 * degtorad, phi + 30.0 * degtorad);
   }
 
+  // A warm start begins with a search of the solution around the initial
+  // controls (findInterval) rather than over the whole control range.
+  bool warm_start = !initial_controls.empty()
+                    && initial_controls.size() == TrimAxes.size();
+
   //clear the sub iterations counts & zero out the controls
   for(unsigned int current_axis=0;current_axis<TrimAxes.size();current_axis++) {
     //FGLogging log(LogLevel::INFO);
@@ -234,12 +257,15 @@ bool FGTrim::DoTrim(void) {
     //<< "  " << TrimAxes[current_axis]->GetControlName()<< "\n";
     xlo=TrimAxes[current_axis].GetControlMin();
     xhi=TrimAxes[current_axis].GetControlMax();
-    TrimAxes[current_axis].SetControl((xlo+xhi)/2);
+    if (warm_start)
+      TrimAxes[current_axis].SetControl(Constrain(xlo, initial_controls[current_axis], xhi));
+    else
+      TrimAxes[current_axis].SetControl((xlo+xhi)/2);
     TrimAxes[current_axis].Run();
     //TrimAxes[current_axis].AxisReport();
     sub_iterations[current_axis]=0;
     successful[current_axis]=0;
-    solution[current_axis]=false;
+    solution[current_axis]=warm_start;
   }
 
   if(mode == tPullup ) {
@@ -131,6 +131,7 @@ class JSBSIM_API FGTrim : public FGJSBBase
   double Tolerance, A_Tolerance;
   std::vector<double> sub_iterations, successful;
   std::vector<bool> solution;
+  std::vector<double> initial_controls;
   unsigned int max_sub_iterations;
   unsigned int max_iterations;
   unsigned int total_its;
@@ -288,6 +289,27 @@ public:
   inline void SetTargetNlf(double nlf) { targetNlf=nlf; }
   inline double GetTargetNlf(void) { return targetNlf; }
 
+  /** Set the control values from which DoTrim() starts, one per axis in the
+      order of the state-control pairs (as returned by GetControls()). When
+      the values come from the solution of a nearby trim point, the solver
+      looks for the solution around them instead of bracketing it over the
+      whole range of each control. A vector which size does not match the
+      number of axes is ignored and the controls start at the middle of their
+      range.
+      @param controls the initial control values.
+  */
+  inline void SetInitialControls(const std::vector<double>& controls) {
+    initial_controls = controls;
+  }
+
+  /** @return the control values of the axes (the trim solution once DoTrim()
+      has succeeded).
+  */
+  std::vector<double> GetControls(void);
+
+  /// @return the names of the controls of the axes.
+  std::vector<std::string> GetControlNames(void);
+
 };
 }
 
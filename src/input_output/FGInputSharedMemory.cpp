@@ -0,0 +1,152 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       FGInputSharedMemory.cpp
+ Author:       The JSBSim team
+ Date started: 10/16/26
+ Purpose:      Manage input of sim parameters from shared memory
+ Called by:    FGInput
+
+ ------------- Copyright (C) 2026 The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc., 59
+ Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+FUNCTIONAL DESCRIPTION
+--------------------------------------------------------------------------------
+Reads the values of properties from a POSIX shared memory segment.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/16/26         Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include "FGInputSharedMemory.h"
+#include "FGXMLElement.h"
+#include "FGLog.h"
+
+using namespace std;
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS IMPLEMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+bool FGInputSharedMemory::Load(Element* el)
+{
+  if (!FGInputType::Load(el))
+    return false;
+
+  SetInputName(el->GetAttributeValue("name"));
+
+  if (Name.empty()) {
+    FGXMLLogging log(el, LogLevel::ERROR);
+    log << LogFormat::RED << LogFormat::BOLD
+        << "  The shared memory input requires a name.\n" << LogFormat::RESET;
+    return false;
+  }
+
+  Element *property_element = el->FindElement("property");
+
+  while (property_element) {
+    string property_str = property_element->GetDataLine();
+    SGPropertyNode* node = PropertyManager->GetNode(property_str);
+    if (!node) {
+      FGXMLLogging log(property_element, LogLevel::ERROR);
+      log << LogFormat::RED << LogFormat::BOLD << "\n  No property by the name "
+          << property_str << " can be found.\n" << LogFormat::RESET;
+    } else {
+      InputProperties.push_back(node);
+      InputNames.push_back(property_str);
+    }
+    property_element = el->FindNextElement("property");
+  }
+
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGInputSharedMemory::InitModel(void)
+{
+  if (!FGInputType::InitModel())
+    return false;
+
+  if (enabled)
+    return CreateSegment();
+
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGInputSharedMemory::CreateSegment(void)
+{
+  if (!Segment || !Segment->IsOpen()
+      || Segment->GetName() != FGSharedMemory::GetSegmentName(Name)) {
+    // The previous segment is removed before its replacement is created since
+    // they may have the same name.
+    Segment.reset();
+    Segment = make_unique<FGSharedMemory>(Name, JSBSIM_SHM_INPUT, InputNames);
+    LastSequence = 0;
+  }
+  Record.resize(InputNames.size());
+
+  return Segment->IsOpen();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGInputSharedMemory::Read(bool Holding)
+{
+  if (!Segment) return;
+
+  uint64_t sequence;
+  if (!Segment->Read(Record.data(), sequence)) return;
+
+  // Nothing new since the previous frame.
+  if (sequence == LastSequence) return;
+  LastSequence = sequence;
+
+  for (size_t i=0; i<InputProperties.size(); ++i)
+    InputProperties[i]->setDoubleValue(Record[i]);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGInputSharedMemory::Disable(void)
+{
+  FGInputType::Disable();
+  Segment.reset();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGInputSharedMemory::Toggle(void)
+{
+  bool enabled_status = FGInputType::Toggle();
+  if (enabled_status)
+    CreateSegment();
+  else
+    Segment.reset();
+
+  return enabled_status;
+}
+}
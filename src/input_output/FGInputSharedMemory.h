@@ -0,0 +1,119 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Header:       FGInputSharedMemory.h
+ Author:       The JSBSim team
+ Date started: 10/16/26
+
+ ------------- Copyright (C) 2026 The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc., 59
+ Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/16/26         Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+SENTRY
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#ifndef FGINPUTSHAREDMEMORY_H
+#define FGINPUTSHAREDMEMORY_H
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <memory>
+#include <vector>
+
+#include "FGInputType.h"
+#include "FGSharedMemory.h"
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+FORWARD DECLARATIONS
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DOCUMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/** Implements the input from a shared memory segment. An external process
+    running on the same host writes the values of the properties directly to
+    memory, without any copy through the kernel nor any system call:
+
+    @code
+    <input name="jsbsim_in" type="SHM">
+      <property> fcs/throttle-cmd-norm[0] </property>
+      <property> fcs/elevator-cmd-norm </property>
+    </input>
+    @endcode
+
+    The name of the input is the name of the POSIX shared memory segment
+    (a leading '/' is added if missing). The record contains the values of
+    the properties in the order of the property elements. The segment is
+    created by FGFDMExec::RunIC() and removed when the input is destroyed.
+    Its layout and the functions to write it are given by the C header
+    jsbsim_shm.h.
+
+    The properties are only modified when the external process has written a
+    new record since the previous frame. If the record is being written when
+    JSBSim reads it, the frame is skipped rather than waiting for the writer.
+    @see FGOutputSharedMemory
+ */
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DECLARATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+class FGInputSharedMemory : public FGInputType
+{
+public:
+  /** Constructor. */
+  FGInputSharedMemory(FGFDMExec* fdmex, bool isEnabled=true)
+    : FGInputType(fdmex, isEnabled) {}
+
+  /** Reads the property names from an XML file.
+      @param el The root XML Element of the input file. */
+  bool Load(Element* el) override;
+
+  /** Creates the shared memory segment. The segment is kept if the simulation
+      is reset so that the writer remains attached to it.
+      @result true if the execution succeeded. */
+  bool InitModel(void) override;
+
+  /// Reads the shared memory segment and updates the properties accordingly.
+  void Read(bool Holding) override;
+
+  /// Disables the input and removes the segment.
+  void Disable(void) override;
+  bool Toggle(void) override;
+
+private:
+  std::vector<SGPropertyNode_ptr> InputProperties;
+  std::vector<std::string> InputNames;
+  std::unique_ptr<FGSharedMemory> Segment;
+  std::vector<double> Record;
+  uint64_t LastSequence = 0;
+
+  bool CreateSegment(void);
+};
+}
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+#endif
@@ -98,6 +98,16 @@ bool FGInputSocket::InitModel(void)
 
 bool FGInputSocket::CreateSocket()
 {
+  if (SockProtocol == FGfdmSocket::ptTCP) {
+    // The clients stay connected when the simulation is reset.
+    if (server && server->IsListening()) return true;
+
+    server = std::make_unique<FGSocketServer>(SockPort,
+                                              "Connected to JSBSim server\r\nJSBSim> ");
+    Clients.clear();
+    return server->IsListening();
+  }
+
   socket = std::make_unique<FGfdmSocket>(SockPort, SockProtocol);
 
   if (!socket) return false;
@@ -121,6 +131,7 @@ void FGInputSocket::Disable()
 {
   FGInputType::Disable();
   socket.reset();
+  server.reset();
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -130,8 +141,10 @@ bool FGInputSocket::Toggle()
   bool enabled_status = FGInputType::Toggle();
   if (enabled_status)
     CreateSocket();
-  else
+  else {
     socket.reset();
+    server.reset();
+  }
 
   return enabled_status;
 }
@@ -140,175 +153,294 @@ bool FGInputSocket::Toggle()
 
 void FGInputSocket::Read(bool Holding)
 {
-  if (!socket) return;
-  if (!socket->GetConnectStatus()) return;
-
-  if (BlockingInput)
-    socket->WaitUntilReadable(); // block until a transmission is received
-
-  string raw_data = socket->Receive(); // read data
-
-  if (!raw_data.empty()) {
-    size_t start = 0;
-
-    data += raw_data;
-
-    // parse lines
-    while (1) {
-      size_t string_start = data.find_first_not_of("\r\n", start);
-      if (string_start == string::npos) break;
-      size_t string_end = data.find_first_of("\r\n", string_start);
-      if (string_end == string::npos) break;
-      string line = data.substr(string_start, string_end-string_start);
-      if (line.empty()) break;
-
-      // now parse individual line
-      vector <string> tokens = split(line,' ');
-
-      string command, argument, str_value;
-      if (!tokens.empty()) {
-        command = to_lower(tokens[0]);
-        if (tokens.size() > 1) {
-          argument = trim(tokens[1]);
-          if (tokens.size() > 2) {
-            str_value = trim(tokens[2]);
-          }
-        }
+  if (!server) return;
+  if (!server->IsListening()) return;
+
+  if (BlockingInput && !server->GetConnections().empty()) {
+    // block until a transmission is received
+    while (!server->Poll(-1) && !server->GetConnections().empty());
+  } else
+    server->Poll(0);
+
+  // Forget the subscriptions of the clients that have disconnected.
+  for (auto it = Clients.begin(); it != Clients.end();) {
+    if (server->IsConnected(it->first))
+      ++it;
+    else
+      it = Clients.erase(it);
+  }
+
+  // Execute all the commands received during this frame before the replies
+  // are sent.
+  string line;
+  for (auto& connection: server->GetConnections()) {
+    while (connection->GetLine(line))
+      ProcessCommand(*connection, line);
+  }
+
+  SendSubscriptions();
+  server->Flush();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGInputSocket::Reply(FGSocketServer::Connection& connection,
+                          const string& text)
+{
+  connection.Send(text);
+  connection.Send("JSBSim> ");
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+SGPropertyNode* FGInputSocket::GetLeafNode(FGSocketServer::Connection& connection,
+                                           const string& argument)
+{
+  SGPropertyNode* node = nullptr;
+
+  if (argument.empty()) {
+    Reply(connection, "No property argument supplied.\r\n");
+    return nullptr;
+  }
+  try {
+    node = PropertyManager->GetNode(argument);
+  } catch(...) {
+    Reply(connection, "Badly formed property query\r\n");
+    return nullptr;
+  }
+
+  if (!node) {
+    Reply(connection, "Unknown property\r\n");
+    return nullptr;
+  }
+  return node;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGInputSocket::ProcessCommand(FGSocketServer::Connection& connection,
+                                   const string& line)
+{
+  // now parse individual line
+  vector <string> tokens = split(line,' ');
+
+  string command, argument, str_value;
+  if (!tokens.empty()) {
+    command = to_lower(tokens[0]);
+    if (tokens.size() > 1) {
+      argument = trim(tokens[1]);
+      if (tokens.size() > 2) {
+        str_value = trim(tokens[2]);
       }
+    }
+  }
 
-      if (command == "set") {                       // SET PROPERTY
-        SGPropertyNode* node = nullptr;
-
-        if (argument.empty()) {
-          socket->Reply("No property argument supplied.\r\n");
-          break;
-        }
-        try {
-          node = PropertyManager->GetNode(argument);
-        } catch(...) {
-          socket->Reply("Badly formed property query\r\n");
-          break;
-        }
-
-        if (!node) {
-          socket->Reply("Unknown property\r\n");
-          break;
-        } else if (!node->hasValue()) {
-          socket->Reply("Not a leaf property\r\n");
-          break;
-        } else {
-          try {
-            double value = atof_locale_c(str_value);
-            node->setDoubleValue(value);
-          } catch(InvalidNumber& e) {
-            string msg(e.what());
-            msg += "\r\n";
-            socket->Reply(msg);
-            break;
-          }
-        }
-        socket->Reply("set successful\r\n");
-
-      } else if (command == "get") {             // GET PROPERTY
-        SGPropertyNode* node = nullptr;
-
-        if (argument.empty()) {
-          socket->Reply("No property argument supplied.\r\n");
-          break;
-        }
-        try {
-          node = PropertyManager->GetNode(argument);
-        } catch(...) {
-          socket->Reply("Badly formed property query\r\n");
-          break;
-        }
-
-        if (!node) {
-          socket->Reply("Unknown property\r\n");
-          break;
-        } else if (!node->hasValue()) {
-          // Not a leaf: return the matching entries from the (static) property
-          // catalog. This is a read-only lookup, so it no longer requires the
-          // client to place the sim in HOLD first.
-          socket->Reply(FDMExec->QueryPropertyCatalog(argument, "\r\n"));
-        } else {
-          ostringstream buf;
-          buf << argument << " = " << setw(12) << setprecision(6) << node->getDoubleValue() << '\r' << endl;
-          socket->Reply(buf.str());
-        }
-
-      } else if (command == "hold") {               // PAUSE
-
-        FDMExec->Hold();
-        socket->Reply("Holding\r\n");
-
-      } else if (command == "resume") {             // RESUME
-
-        FDMExec->Resume();
-        socket->Reply("Resuming\r\n");
-
-      } else if (command == "iterate") {            // ITERATE
-
-        int argumentInt;
-        istringstream (argument) >> argumentInt;
-        if (argument.empty()) {
-          socket->Reply("No argument supplied for number of iterations.\r\n");
-          break;
-        }
-        if ( !(argumentInt > 0) ){
-          socket->Reply("Required argument must be a positive Integer.\r\n");
-          break;
-        }
-        FDMExec->EnableIncrementThenHold( argumentInt );
-        FDMExec->Resume();
-        socket->Reply("Iterations performed\r\n");
-
-      } else if (command == "quit") {               // QUIT
-
-        // close the socket connection
-        socket->Send("Closing connection\r\n");
-        socket->Close();
-
-      } else if (command == "info") {               // INFO
-
-        // get info about the sim run and/or aircraft, etc.
-        ostringstream info;
-        info << "JSBSim version: " << JSBSim_version << "\r\n";
-        info << "Config File version: " << needed_cfg_version << "\r\n";
-        info << "Aircraft simulated: " << FDMExec->GetAircraft()->GetAircraftName() << "\r\n";
-        info << "Simulation time: " << setw(8) << setprecision(3) << FDMExec->GetSimTime() << '\r' << endl;
-        socket->Reply(info.str());
-
-      } else if (command == "help") {               // HELP
-
-        socket->Reply(
-        " JSBSim Server commands:\r\n\r\n"
-        "   get {property name}\r\n"
-        "   set {property name} {value}\r\n"
-        "   hold\r\n"
-        "   resume\r\n"
-        "   iterate {value}\r\n"
-        "   help\r\n"
-        "   quit\r\n"
-        "   info\r\n\r\n");
-
-      } else {
-        socket->Reply(string("Unknown command: ") + command + "\r\n");
+  if (command == "set") {                       // SET PROPERTY
+    SGPropertyNode* node = GetLeafNode(connection, argument);
+    if (!node) return;
+
+    if (!node->hasValue()) {
+      Reply(connection, "Not a leaf property\r\n");
+      return;
+    }
+    try {
+      double value = atof_locale_c(str_value);
+      node->setDoubleValue(value);
+    } catch(InvalidNumber& e) {
+      string msg(e.what());
+      msg += "\r\n";
+      Reply(connection, msg);
+      return;
+    }
+    Reply(connection, "set successful\r\n");
+
+  } else if (command == "get") {             // GET PROPERTY
+    SGPropertyNode* node = GetLeafNode(connection, argument);
+    if (!node) return;
+
+    if (!node->hasValue()) {
+      // Not a leaf: return the matching entries from the (static) property
+      // catalog. This is a read-only lookup, so it no longer requires the
+      // client to place the sim in HOLD first.
+      Reply(connection, FDMExec->QueryPropertyCatalog(argument, "\r\n"));
+    } else {
+      ostringstream buf;
+      buf << argument << " = " << setw(12) << setprecision(6) << node->getDoubleValue() << '\r' << endl;
+      Reply(connection, buf.str());
+    }
+
+  } else if (command == "subscribe") {       // SUBSCRIBE
+    Subscribe(connection, tokens);
+
+  } else if (command == "unsubscribe") {     // UNSUBSCRIBE
+    auto& subscriptions = Clients[connection.GetID()].Subscriptions;
+
+    if (argument.empty()) {
+      Reply(connection, "No subscription argument supplied.\r\n");
+      return;
+    }
+    if (to_lower(argument) == "all") {
+      subscriptions.clear();
+      Reply(connection, "Unsubscribed\r\n");
+      return;
+    }
+
+    unsigned int id = atoi(argument.c_str());
+    for (auto it = subscriptions.begin(); it != subscriptions.end(); ++it) {
+      if (it->ID == id) {
+        subscriptions.erase(it);
+        Reply(connection, "Unsubscribed\r\n");
+        return;
       }
+    }
+    Reply(connection, "Unknown subscription\r\n");
+
+  } else if (command == "hold") {               // PAUSE
 
-      start = string_end;
+    FDMExec->Hold();
+    Reply(connection, "Holding\r\n");
+
+  } else if (command == "resume") {             // RESUME
+
+    FDMExec->Resume();
+    Reply(connection, "Resuming\r\n");
+
+  } else if (command == "iterate") {            // ITERATE
+
+    int argumentInt;
+    istringstream (argument) >> argumentInt;
+    if (argument.empty()) {
+      Reply(connection, "No argument supplied for number of iterations.\r\n");
+      return;
     }
+    if ( !(argumentInt > 0) ){
+      Reply(connection, "Required argument must be a positive Integer.\r\n");
+      return;
+    }
+    FDMExec->EnableIncrementThenHold( argumentInt );
+    FDMExec->Resume();
+    Reply(connection, "Iterations performed\r\n");
+
+  } else if (command == "quit") {               // QUIT
+
+    // close the socket connection
+    connection.Send("Closing connection\r\n");
+    connection.Close();
+
+  } else if (command == "info") {               // INFO
+
+    // get info about the sim run and/or aircraft, etc.
+    ostringstream info;
+    info << "JSBSim version: " << JSBSim_version << "\r\n";
+    info << "Config File version: " << needed_cfg_version << "\r\n";
+    info << "Aircraft simulated: " << FDMExec->GetAircraft()->GetAircraftName() << "\r\n";
+    info << "Simulation time: " << setw(8) << setprecision(3) << FDMExec->GetSimTime() << '\r' << endl;
+    Reply(connection, info.str());
+
+  } else if (command == "help") {               // HELP
+
+    Reply(connection,
+    " JSBSim Server commands:\r\n\r\n"
+    "   get {property name}\r\n"
+    "   set {property name} {value}\r\n"
+    "   subscribe {rate in Hz} {property name} [{property name} ...]\r\n"
+    "   unsubscribe {subscription number | all}\r\n"
+    "   hold\r\n"
+    "   resume\r\n"
+    "   iterate {value}\r\n"
+    "   help\r\n"
+    "   quit\r\n"
+    "   info\r\n\r\n");
+
+  } else {
+    Reply(connection, string("Unknown command: ") + command + "\r\n");
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGInputSocket::Subscribe(FGSocketServer::Connection& connection,
+                              const vector<string>& tokens)
+{
+  if (tokens.size() < 3) {
+    Reply(connection, "Usage: subscribe {rate in Hz} {property name} [{property name} ...]\r\n");
+    return;
+  }
+
+  double rate;
+  try {
+    rate = atof_locale_c(tokens[1]);
+  } catch(InvalidNumber& e) {
+    string msg(e.what());
+    msg += "\r\n";
+    Reply(connection, msg);
+    return;
+  }
+  if (!(rate > 0.0)) {
+    Reply(connection, "The rate must be a positive number.\r\n");
+    return;
+  }
+
+  Subscription subscription;
+  ostringstream buf;
 
-    // Remove processed commands.
-    size_t last_crlf = data.find_last_of("\r\n");
-    if (last_crlf != string::npos) {
-      if (last_crlf < data.length()-1)
-        data = data.substr(last_crlf+1);
-      else
-        data.clear();
+  for (size_t i=2; i<tokens.size(); ++i) {
+    SGPropertyNode* node = GetLeafNode(connection, tokens[i]);
+    if (!node) return;
+    if (!node->hasValue()) {
+      Reply(connection, "Not a leaf property\r\n");
+      return;
     }
+    subscription.Nodes.push_back(node);
+    buf << ',' << tokens[i];
   }
 
+  ClientState& client = Clients[connection.GetID()];
+  subscription.ID = client.NextSubscriptionID++;
+  subscription.Period = 1.0 / rate;
+  subscription.NextTime = FDMExec->GetSimTime();
+  client.Subscriptions.push_back(subscription);
+
+  ostringstream reply;
+  reply << "Subscription " << subscription.ID << ": time" << buf.str() << "\r\n";
+  Reply(connection, reply.str());
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGInputSocket::SendSubscriptions(void)
+{
+  if (Clients.empty()) return;
+
+  double time = FDMExec->GetSimTime();
+
+  for (auto& connection: server->GetConnections()) {
+    auto it = Clients.find(connection->GetID());
+    if (it == Clients.end()) continue;
+
+    for (auto& subscription: it->second.Subscriptions) {
+      // Restart the stream if the simulation time has been reset.
+      if (subscription.NextTime - subscription.Period > time)
+        subscription.NextTime = time;
+      if (time < subscription.NextTime) continue;
+
+      // Skip the samples that have been missed rather than sending them in a
+      // burst.
+      subscription.NextTime += subscription.Period;
+      if (subscription.NextTime <= time)
+        subscription.NextTime = time + subscription.Period;
+
+      // Drop the sample if the client does not read its data.
+      if (connection->GetPendingOutput() > MaxPendingOutput) continue;
+
+      DataBuffer.str("");
+      DataBuffer << "DATA " << subscription.ID << ' ' << setprecision(10) << time;
+      for (auto& node: subscription.Nodes)
+        DataBuffer << ',' << node->getDoubleValue();
+      DataBuffer << "\r\n";
+      connection->Send(DataBuffer.str());
+    }
+  }
 }
 
 }
@@ -38,8 +38,13 @@ SENTRY
 INCLUDES
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
+#include <map>
+#include <sstream>
+#include <vector>
+
 #include "FGInputType.h"
 #include "input_output/FGfdmSocket.h"
+#include "input_output/FGSocketServer.h"
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 FORWARD DECLARATIONS
@@ -51,8 +56,28 @@ namespace JSBSim {
 CLASS DOCUMENTATION
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
-/** Implements the input from a socket. This class inputs data from a telnet
-    session. This is a leaf class.
+/** Implements the input from a socket. This class inputs data from telnet
+    sessions. Several clients can be connected at the same time: the
+    connections are multiplexed by FGSocketServer and the commands received by
+    all the clients during a frame are executed before their replies are sent.
+
+    In addition to the get/set commands, a client can subscribe to properties
+    which are then streamed to it at the requested rate (in Hz of simulation
+    time) without further requests:
+
+    @code
+    JSBSim> subscribe 10 position/h-sl-ft velocities/vc-kts
+    Subscription 0: time,position/h-sl-ft,velocities/vc-kts
+    JSBSim> DATA 0 12.5,1523.12,98.2
+    DATA 0 12.6,1524.03,98.21
+    ...
+    @endcode
+
+    Each streamed line starts with "DATA" and the number of the subscription
+    followed by the simulation time and the values of the properties
+    separated by commas. A subscription is cancelled with
+    "unsubscribe {number}" or "unsubscribe all". The samples are dropped
+    rather than queued when a client does not read its data.
  */
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -93,6 +118,35 @@ protected:
   FGfdmSocket::ProtocolType SockProtocol;
   std::string data;
   bool BlockingInput;
+
+private:
+  struct Subscription {
+    unsigned int ID;
+    double Period;
+    double NextTime;
+    std::vector<SGPropertyNode_ptr> Nodes;
+  };
+
+  struct ClientState {
+    unsigned int NextSubscriptionID = 0;
+    std::vector<Subscription> Subscriptions;
+  };
+
+  /// Size of the unsent data above which the streamed samples are dropped.
+  static constexpr size_t MaxPendingOutput = 1 << 20;
+
+  std::unique_ptr<FGSocketServer> server;
+  std::map<unsigned int, ClientState> Clients;
+  std::ostringstream DataBuffer;
+
+  void Reply(FGSocketServer::Connection& connection, const std::string& text);
+  SGPropertyNode* GetLeafNode(FGSocketServer::Connection& connection,
+                              const std::string& argument);
+  void ProcessCommand(FGSocketServer::Connection& connection,
+                      const std::string& line);
+  void Subscribe(FGSocketServer::Connection& connection,
+                 const std::vector<std::string>& tokens);
+  void SendSubscriptions(void);
 };
 }
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -217,6 +217,33 @@ protected:
   LogLevel min_level = LogLevel::BULK;
 };
 
+/**
+ * Logger that keeps the errors so that they can be reported later on and
+ * discards everything else. It is installed in the worker threads that run
+ * several executives concurrently to avoid interleaving their output.
+ */
+class JSBSIM_API FGErrorLogger : public FGLogger
+{
+public:
+  void SetLevel(LogLevel level) override {
+    log_level = level;
+    keep = level == LogLevel::ERROR || level == LogLevel::FATAL;
+  }
+  void Message(const std::string& message) override {
+    if (keep) buffer << message;
+  }
+  void Flush(void) override {
+    if (keep) buffer << std::endl;
+    keep = false;
+  }
+  /// Returns the errors logged so far.
+  std::string GetMessages(void) const { return buffer.str(); }
+
+private:
+  bool keep = false;
+  std::ostringstream buffer;
+};
+
 class JSBSIM_API LogException : public BaseException, public FGLogging
 {
 public:
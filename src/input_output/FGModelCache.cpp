@@ -0,0 +1,312 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       FGModelCache.cpp
+ Author:       The JSBSim team
+ Date started: 10/16/26
+ Purpose:      Binary cache of the parsed XML files
+ Called by:    FGDocumentCache
+
+ ------------- Copyright (C) 2026 The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc., 59
+ Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+FUNCTIONAL DESCRIPTION
+--------------------------------------------------------------------------------
+Stores the documents built by the XML parser in a binary form. A cache file is
+made of a header followed by the elements of the document, depth first:
+- the 8 characters "JSBSIMXC",
+- the format version (uint32),
+- the size (uint64) and the hash (uint64) of the XML file,
+- for each element: its name, its line number (int32), its number of
+  attributes (uint32) followed by their names and values, its number of data
+  lines (uint32) followed by the lines, and its number of children (uint32)
+  followed by the children.
+The strings are stored as their length (uint32) followed by their characters.
+The integers are stored in the byte order of the machine which wrote the file:
+the version would not match on a machine with a different byte order.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/16/26         Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <random>
+#include <sstream>
+#include <thread>
+
+#include "FGJSBBase.h"
+#include "FGModelCache.h"
+#include "FGXMLParse.h"
+#include "FGLog.h"
+#include "simgear/io/iostreams/sgstream.hxx"
+
+using namespace std;
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS IMPLEMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace {
+
+const char Magic[8] = {'J', 'S', 'B', 'S', 'I', 'M', 'X', 'C'};
+const uint32_t FormatVersion = 1;
+
+template<typename T>
+void Write(string& out, T value)
+{
+  out.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+void WriteString(string& out, const string& str)
+{
+  Write(out, static_cast<uint32_t>(str.size()));
+  out.append(str);
+}
+
+void WriteElement(string& out, Element* el)
+{
+  WriteString(out, el->GetName());
+  Write(out, static_cast<int32_t>(el->GetLineNumber()));
+
+  const auto& attributes = el->GetAttributes();
+  Write(out, static_cast<uint32_t>(attributes.size()));
+  for (const auto& attr: attributes) {
+    WriteString(out, attr.first);
+    WriteString(out, attr.second);
+  }
+
+  Write(out, static_cast<uint32_t>(el->GetNumDataLines()));
+  for (unsigned int i=0; i<el->GetNumDataLines(); ++i)
+    WriteString(out, el->GetDataLine(i));
+
+  Write(out, static_cast<uint32_t>(el->GetNumElements()));
+  for (unsigned int i=0; i<el->GetNumElements(); ++i)
+    WriteElement(out, el->GetElement(i));
+}
+
+// Reads the data of a cache file. All the reads are checked against the end of
+// the buffer so that a truncated or corrupted file is detected.
+class Reader
+{
+public:
+  Reader(const string& buffer)
+    : pos(buffer.data()), end(buffer.data() + buffer.size()) {}
+
+  template<typename T>
+  bool Read(T& value) {
+    if (size_t(end - pos) < sizeof(T)) return false;
+    memcpy(&value, pos, sizeof(T));
+    pos += sizeof(T);
+    return true;
+  }
+
+  bool ReadString(string& str) {
+    uint32_t length;
+    if (!Read(length) || size_t(end - pos) < length) return false;
+    str.assign(pos, length);
+    pos += length;
+    return true;
+  }
+
+  bool ReadMagic(void) {
+    if (size_t(end - pos) < sizeof(Magic)) return false;
+    if (memcmp(pos, Magic, sizeof(Magic)) != 0) return false;
+    pos += sizeof(Magic);
+    return true;
+  }
+
+  // The depth is limited to protect the stack against a corrupted file.
+  Element_ptr ReadElement(const string& filename, unsigned int depth=0) {
+    string name, key, value;
+    int32_t line;
+    uint32_t count;
+
+    if (depth > 1000 || !ReadString(name) || !Read(line)) return nullptr;
+
+    Element_ptr el = new Element(name);
+    el->SetLineNumber(line);
+    el->SetFileName(filename);
+
+    if (!Read(count)) return nullptr;
+    for (uint32_t i=0; i<count; ++i) {
+      if (!ReadString(key) || !ReadString(value)) return nullptr;
+      el->AddAttribute(key, value);
+    }
+
+    if (!Read(count)) return nullptr;
+    for (uint32_t i=0; i<count; ++i) {
+      if (!ReadString(value)) return nullptr;
+      el->AddData(value);
+    }
+
+    if (!Read(count)) return nullptr;
+    for (uint32_t i=0; i<count; ++i) {
+      Element_ptr child = ReadElement(filename, depth+1);
+      if (!child) return nullptr;
+      child->SetParent(el);
+      el->AddChildElement(child);
+    }
+
+    return el;
+  }
+
+  bool AtEnd(void) const { return pos == end; }
+
+private:
+  const char* pos;
+  const char* end;
+};
+
+bool ReadFile(const SGPath& path, string& content)
+{
+  sg_ifstream file(path, ios::in | ios::binary);
+  if (!file.is_open()) return false;
+
+  content.assign(istreambuf_iterator<char>(file), istreambuf_iterator<char>());
+  return !file.bad();
+}
+
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+uint64_t FGModelCache::Hash(const string& content)
+{
+  uint64_t hash = 0xcbf29ce484222325ULL;
+
+  for (unsigned char c: content) {
+    hash ^= c;
+    hash *= 0x100000001b3ULL;
+  }
+
+  return hash;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+SGPath FGModelCache::GetCacheFile(const string& content) const
+{
+  char name[32];
+  snprintf(name, sizeof(name), "%016llx.jsbc",
+           static_cast<unsigned long long>(Hash(content)));
+  return CacheDir/name;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+Element_ptr FGModelCache::Load(const SGPath& filename) const
+{
+  SGPath path(filename);
+  if (path.extension().empty())
+    path.concat(".xml");
+
+  string content;
+  if (!ReadFile(path, content)) {
+    FGLogging log(LogLevel::ERROR);
+    log << "Could not open file: " << path << "\n";
+    return nullptr;
+  }
+
+  SGPath cacheFile = GetCacheFile(content);
+  Element_ptr document = ReadCache(cacheFile, content, path.utf8Str());
+  if (document) return document;
+
+  FGXMLParse parser;
+  istringstream input(content);
+  readXML(input, parser, path.utf8Str());
+  document = parser.GetDocument();
+
+  if (document) WriteCache(cacheFile, content, document);
+
+  return document;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+Element_ptr FGModelCache::ReadCache(const SGPath& cacheFile,
+                                    const string& content,
+                                    const string& filename) const
+{
+  string buffer;
+  if (!ReadFile(cacheFile, buffer)) return nullptr;
+
+  Reader reader(buffer);
+  uint32_t version;
+  uint64_t size, hash;
+
+  if (!reader.ReadMagic() || !reader.Read(version) || version != FormatVersion
+      || !reader.Read(size) || size != content.size()
+      || !reader.Read(hash) || hash != Hash(content))
+    return nullptr;
+
+  Element_ptr document = reader.ReadElement(filename);
+  if (!document || !reader.AtEnd()) return nullptr;
+
+  return document;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGModelCache::WriteCache(const SGPath& cacheFile, const string& content,
+                              Element* document) const
+{
+  string buffer(Magic, sizeof(Magic));
+  Write(buffer, FormatVersion);
+  Write(buffer, static_cast<uint64_t>(content.size()));
+  Write(buffer, Hash(content));
+  WriteElement(buffer, document);
+
+  // The file is written under a temporary name so that the other processes
+  // never read a partially written file.
+  random_device seed;
+  SGPath tmpFile(cacheFile);
+  tmpFile.concat("." + to_string(seed()) + "."
+                 + to_string(hash<thread::id>()(this_thread::get_id())));
+
+  {
+    sg_ofstream file(tmpFile, ios::out | ios::binary | ios::trunc);
+    if (!file.is_open()) {
+      if (FGJSBBase::debug_lvl > 0) {
+        FGLogging log(LogLevel::WARN);
+        log << "Unable to write the model cache file " << tmpFile << "\n";
+      }
+      return;
+    }
+    file.write(buffer.data(), buffer.size());
+    if (!file) {
+      file.close();
+      remove(tmpFile.utf8Str().c_str());
+      return;
+    }
+  }
+
+  // Another process may have created the cache file meanwhile in which case
+  // the rename can fail on some platforms: the file is then left as it is.
+  if (rename(tmpFile.utf8Str().c_str(), cacheFile.utf8Str().c_str()) != 0)
+    remove(tmpFile.utf8Str().c_str());
+}
+}
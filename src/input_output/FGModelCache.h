@@ -0,0 +1,110 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Header:       FGModelCache.h
+ Author:       The JSBSim team
+ Date started: 10/16/26
+
+ ------------- Copyright (C) 2026 The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc., 59
+ Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/16/26         Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+SENTRY
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#ifndef FGMODELCACHE_H
+#define FGMODELCACHE_H
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <cstdint>
+#include <string>
+
+#include "FGXMLElement.h"
+#include "simgear/misc/sg_path.hxx"
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+FORWARD DECLARATIONS
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DOCUMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/** On-disk cache of the parsed XML files of the models. The first time a file
+    is read, its document (the tree of Element built by the XML parser) is
+    written in a binary form to the cache directory. The following runs read
+    the binary file instead of parsing the XML file again, which avoids the
+    cost of expat and of the construction of the data lines.
+
+    The cache files are named after a hash of the content of the XML file so a
+    modified file is parsed again, whatever its modification time, and the
+    files that have the same content share the same cache file. Each cache
+    file also stores the size and the hash of the XML file and is ignored if
+    they do not match or if it is truncated or corrupted.
+
+    The cache files are written to a temporary file then renamed so that
+    several processes can share the same cache directory concurrently. The
+    cache directory must exist: if it does not, or if the cache files cannot be
+    written, the XML files are simply parsed each time.
+
+    The cache is enabled with FGFDMExec::SetModelCachePath() or with the
+    option --modelcache of the JSBSim executable.
+    @see FGDocumentCache
+ */
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DECLARATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+class FGModelCache
+{
+public:
+  /// Constructor
+  explicit FGModelCache(const SGPath& dir) : CacheDir(dir) {}
+
+  /** Returns the document read from an XML file.
+      @param filename the full path name of the XML file.
+      @return the document or a null pointer if the file could not be read. */
+  Element_ptr Load(const SGPath& filename) const;
+
+  /// Returns the cache file of an XML file which content is given.
+  SGPath GetCacheFile(const std::string& content) const;
+
+  /// Returns the 64 bits FNV-1a hash of a buffer.
+  static uint64_t Hash(const std::string& content);
+
+private:
+  SGPath CacheDir;
+
+  Element_ptr ReadCache(const SGPath& cacheFile, const std::string& content,
+                        const std::string& filename) const;
+  void WriteCache(const SGPath& cacheFile, const std::string& content,
+                  Element* document) const;
+};
+}
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+#endif
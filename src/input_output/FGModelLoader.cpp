@@ -39,6 +39,7 @@ INCLUDES
 
 #include "FGFDMExec.h"
 #include "FGModelLoader.h"
+#include "FGModelCache.h"
 #include "FGXMLFileRead.h"
 #include "models/FGModel.h"
 #include "input_output/FGLog.h"
@@ -51,33 +52,136 @@ namespace JSBSim {
 CLASS IMPLEMENTATION
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
+std::mutex FGDocumentStore::mutex;
+std::map<std::string, FGDocumentStore::Entry> FGDocumentStore::entries;
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+Element_ptr FGDocumentStore::Parse(const SGPath& path, const SGPath& cachePath)
+{
+  if (cachePath.isNull()) {
+    FGXMLFileRead XMLFileRead;
+    return XMLFileRead.LoadXMLDocument(path);
+  }
+
+  return FGModelCache(cachePath).Load(path);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+string FGDocumentStore::GetKey(const SGPath& path)
+{
+  SGPath filename(path);
+  if (filename.extension().empty())
+    filename.concat(".xml");
+
+  return filename.utf8Str();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+Element_ptr FGDocumentStore::Load(const SGPath& path, const SGPath& cachePath)
+{
+  string key = GetKey(path);
+  SGPath filename = SGPath::fromUtf8(key);
+  time_t modTime = filename.modTime();
+  size_t size = filename.sizeInBytes();
+
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = entries.find(key);
+    if (it != entries.end()) {
+      Entry& entry = it->second;
+      if (entry.modTime == modTime && entry.size == size
+          && entry.modTime < entry.loadTime) {
+        entry.users++;
+        return entry.document->Copy();
+      }
+    }
+  }
+
+  // The file is parsed outside of the lock so that several threads can parse
+  // different files concurrently.
+  time_t loadTime = time(nullptr);
+  Element_ptr document = Parse(path, cachePath);
+  if (!document) return nullptr;
+
+  std::lock_guard<std::mutex> lock(mutex);
+  // The users of an outdated document are kept since they release it by name.
+  Entry& entry = entries[key];
+  entry = {document, modTime, size, loadTime, entry.users + 1};
+  return document->Copy();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGDocumentStore::Release(const SGPath& path)
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  auto it = entries.find(GetKey(path));
+  // The document is missing if the store has been cleared in the meantime.
+  if (it != entries.end() && --it->second.users == 0)
+    entries.erase(it);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGDocumentStore::Clear(void)
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  entries.clear();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGDocumentCache::~FGDocumentCache()
+{
+  for (auto& document: documents)
+    FGDocumentStore::Release(SGPath::fromUtf8(document.first));
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+Element_ptr FGDocumentCache::Load(const SGPath& path)
+{
+  auto it = documents.find(path.utf8Str());
+  if (it != documents.end())
+    return it->second;
+
+  Element_ptr document = FGDocumentStore::Load(path, CachePath);
+
+  if (document)
+    documents[path.utf8Str()] = document;
+
+  return document;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 Element_ptr FGModelLoader::Open(Element *el)
 {
   Element_ptr document = el;
   string fname = el->GetAttributeValue("file");
 
   if (!fname.empty()) {
-    FGXMLFileRead XMLFileRead;
     SGPath path(SGPath::fromUtf8(fname.c_str()));
 
     if (path.isRelative())
       path = model->FindFullPathName(path);
 
-    if (CachedFiles.find(path.utf8Str()) != CachedFiles.end())
-      document = CachedFiles[path.utf8Str()];
-    else {
-      document = XMLFileRead.LoadXMLDocument(path);
-      if (document == 0L) {
-        FGXMLLogging log(el, LogLevel::ERROR);
-        log << "Could not open file: " << fname << endl;
-        return NULL;
-      }
-      CachedFiles[path.utf8Str()] = document;
+    document = model->GetExec()->GetDocumentCache()->Load(path);
+    if (document == 0L) {
+      FGXMLLogging log(el, LogLevel::ERROR);
+      log << "Could not open file: " << fname << endl;
+      return NULL;
     }
 
     if (document->GetName() != el->GetName()) {
       document->SetParent(el);
-      el->AddChildElement(document);
+      // The element already owns the document when the model is built again
+      // from a cached document (see FGFDMExec::Clone).
+      if (!el->HasChildElement(document))
+        el->AddChildElement(document);
     }
   }
 
@@ -38,6 +38,9 @@ SENTRY
 INCLUDES
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
+#include <ctime>
+#include <map>
+#include <mutex>
 #include <string>
 
 #include "FGXMLElement.h"
@@ -59,6 +62,91 @@ CLASS DOCUMENTATION
 CLASS DECLARATION
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
+/** Process-wide store of the XML documents that have been parsed. It is shared
+    by all the executives so that a file that is used by several of them (the
+    aircraft, engines and systems of a Monte Carlo study for instance) is
+    parsed only once.
+
+    The documents of the store are never handed out: each request returns a
+    copy of the document which the executive is free to modify. A document is
+    parsed again when the modification time or the size of its file has
+    changed. A document read less than a second after its file has been
+    modified is not reused, since a later modification within that second
+    could not be detected from the modification time.
+
+    The store keeps a document only as long as it is used by an executive: each
+    FGDocumentCache that has requested a document releases it when it is
+    destroyed and the document is removed from the store when it is no longer
+    used by any of them.
+
+    The store is thread safe. */
+class FGDocumentStore
+{
+public:
+  /** Returns a copy of the document read from a file.
+      @param path the full path name of the file.
+      @param cachePath the directory of the on-disk cache of the parsed files
+                       (see FGModelCache) or an empty path.
+      @return the document or a null pointer if the file could not be read. */
+  static Element_ptr Load(const SGPath& path, const SGPath& cachePath);
+
+  /** Releases a document which has been obtained from Load. The document is
+      removed from the store when it is no longer used.
+      @param path the full path name of the file. */
+  static void Release(const SGPath& path);
+
+  /// Removes all the documents from the store.
+  static void Clear(void);
+
+private:
+  struct Entry {
+    Element_ptr document;
+    time_t modTime;
+    size_t size;
+    time_t loadTime;
+    /// Number of the FGDocumentCache which use the document.
+    unsigned int users;
+  };
+
+  static std::mutex mutex;
+  static std::map<std::string, Entry> entries;
+
+  static Element_ptr Parse(const SGPath& path, const SGPath& cachePath);
+  static std::string GetKey(const SGPath& path);
+};
+
+/** Cache of the XML documents that have been read while loading a model.
+    The cache is owned by the executive and shared with its clones (see
+    FGFDMExec::Clone) so that the aircraft, engines and systems files are
+    read only once. The documents are copies obtained from FGDocumentStore.
+    They keep track of the children being iterated so they must not be used
+    by several threads at the same time: the mutex must be locked while a model
+    is built from them. */
+class FGDocumentCache
+{
+public:
+  /// Destructor. Releases the documents to FGDocumentStore.
+  ~FGDocumentCache();
+
+  /** Returns the document read from a file. The document is requested from
+      FGDocumentStore the first time the file is needed.
+      @param path the full path name of the file.
+      @return the document or a null pointer if the file could not be read. */
+  Element_ptr Load(const SGPath& path);
+
+  /** Sets the directory of the on-disk cache of the parsed files. The files
+      are parsed without being cached if the path is empty.
+      @see FGModelCache */
+  void SetCachePath(const SGPath& path) { CachePath = path; }
+
+  std::mutex& GetMutex(void) { return mutex; }
+
+private:
+  std::mutex mutex;
+  std::map<std::string, Element_ptr> documents;
+  SGPath CachePath;
+};
+
 class FGModelLoader
 {
 public:
@@ -67,7 +155,6 @@ public:
 
 private:
   const FGModel* model;
-  std::map<std::string, Element_ptr> CachedFiles;
 };
 
 SGPath CheckPathName(const SGPath& path, const SGPath& filename);
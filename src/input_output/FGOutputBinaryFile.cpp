@@ -0,0 +1,228 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       FGOutputBinaryFile.cpp
+ Author:       The JSBSim team
+ Date started: 10/16/26
+ Purpose:      Manage output of sim parameters to a binary file
+ Called by:    FGOutput
+
+ ------------- Copyright (C) 2026 The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc., 59
+ Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+FUNCTIONAL DESCRIPTION
+--------------------------------------------------------------------------------
+Writes the output values to a binary file made of a header followed by blocks
+of frames stored column after column.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/16/26         Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <cstdint>
+#include <cstring>
+
+#include "FGOutputBinaryFile.h"
+#include "math/FGFunction.h"
+#include "FGLog.h"
+
+using namespace std;
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS IMPLEMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace {
+
+const char Magic[8] = {'J', 'S', 'B', 'S', 'I', 'M', 'B', 'O'};
+const uint32_t FormatVersion = 1;
+const uint8_t DoubleColumn = 0;
+
+// Suffixes of the property names that are recognized as units.
+const char* const Units[] = {
+  "deg", "rad", "deg_sec", "rad_sec", "rad_sec2", "ft", "ft2", "ft3", "in",
+  "km", "m", "fps", "fps2", "ft_sec2", "kts", "mps", "lbs", "lbsft", "psf",
+  "psi", "slugs", "slug_ft2", "slugs_ft2", "slugs_ft3", "sec", "rpm", "hp",
+  "pps", "norm", "R", "K"};
+
+bool IsLittleEndian(void)
+{
+  const uint16_t one = 1;
+  uint8_t first;
+  memcpy(&first, &one, 1);
+  return first == 1;
+}
+
+template<typename T>
+void WriteLittleEndian(ostream& out, T value)
+{
+  uint8_t bytes[sizeof(T)];
+  memcpy(bytes, &value, sizeof(T));
+  if (!IsLittleEndian()) {
+    for (size_t i=0; i < sizeof(T)/2; ++i)
+      swap(bytes[i], bytes[sizeof(T)-1-i]);
+  }
+  out.write(reinterpret_cast<const char*>(bytes), sizeof(T));
+}
+
+void WriteString(ostream& out, const string& str)
+{
+  size_t length = min(str.size(), size_t(UINT16_MAX));
+  WriteLittleEndian(out, static_cast<uint16_t>(length));
+  out.write(str.data(), length);
+}
+
+string GetUnit(const string& name)
+{
+  size_t dash = name.find_last_of('-');
+  if (dash == string::npos || name.find('/', dash) != string::npos)
+    return string();
+
+  string suffix = name.substr(dash+1);
+  for (const char* unit: Units) {
+    if (suffix == unit) return suffix;
+  }
+  return string();
+}
+
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGOutputBinaryFile::OpenFile(void)
+{
+  datafile.clear();
+  datafile.open(Filename, ios::out | ios::binary | ios::trunc);
+  if (!datafile) {
+    FGLogging log(LogLevel::ERROR);
+    log << LogFormat::RED << LogFormat::BOLD << "\nERROR: unable to open the file "
+        << LogFormat::RESET << Filename.c_str()
+        << LogFormat::RED << LogFormat::BOLD << "\n       => Output to this file is disabled.\n\n"
+        << LogFormat::RESET;
+    Disable();
+    return false;
+  }
+
+  if (SubSystems) {
+    FGLogging log(LogLevel::WARN);
+    log << "The subsystems are not supported by the binary output to "
+        << Filename.c_str() << ". Only the properties and the functions will be"
+        << " logged.\n";
+  }
+
+  NumColumns = static_cast<unsigned int>(1 + OutputParameters.size()
+                                         + PreFunctions.size());
+  NumFrames = 0;
+  Block.resize(NumColumns * BlockSize);
+
+  datafile.write(Magic, sizeof(Magic));
+  WriteLittleEndian(datafile, FormatVersion);
+  WriteLittleEndian(datafile, static_cast<uint32_t>(NumColumns));
+  WriteLittleEndian(datafile, static_cast<uint32_t>(BlockSize));
+
+  WriteLittleEndian(datafile, DoubleColumn);
+  WriteString(datafile, "Time");
+  WriteString(datafile, "sec");
+  for (unsigned int i=0; i<OutputParameters.size(); ++i) {
+    WriteLittleEndian(datafile, DoubleColumn);
+    if (!OutputCaptions[i].empty())
+      WriteString(datafile, OutputCaptions[i]);
+    else
+      WriteString(datafile, OutputParameters[i]->GetFullyQualifiedName());
+    WriteString(datafile, GetUnit(OutputParameters[i]->GetName()));
+  }
+  for (const auto& f: PreFunctions) {
+    WriteLittleEndian(datafile, DoubleColumn);
+    WriteString(datafile, f->GetName());
+    WriteString(datafile, GetUnit(f->GetName()));
+  }
+
+  datafile.flush();
+
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGOutputBinaryFile::CloseFile(void)
+{
+  if (datafile.is_open()) {
+    WriteBlock();
+    datafile.close();
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGOutputBinaryFile::Print(void)
+{
+  if (!datafile.is_open()) return;
+
+  double* frame = &Block[NumFrames];
+  unsigned int col = 0;
+
+  frame[col++ * BlockSize] = FDMExec->GetSimTime();
+  for (auto param: OutputParameters)
+    frame[col++ * BlockSize] = param->GetValue();
+  for (const auto& f: PreFunctions)
+    frame[col++ * BlockSize] = f->getDoubleValue();
+
+  if (++NumFrames == BlockSize) WriteBlock();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGOutputBinaryFile::PrintFrame(const double* frame)
+{
+  if (!datafile.is_open()) return;
+
+  for (unsigned int col=0; col<NumColumns; ++col)
+    Block[col * BlockSize + NumFrames] = frame[col];
+
+  if (++NumFrames == BlockSize) WriteBlock();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGOutputBinaryFile::WriteBlock(void)
+{
+  if (NumFrames == 0) return;
+
+  WriteLittleEndian(datafile, static_cast<uint32_t>(NumFrames));
+
+  for (unsigned int col=0; col<NumColumns; ++col) {
+    const double* values = &Block[col * BlockSize];
+    if (IsLittleEndian()) {
+      datafile.write(reinterpret_cast<const char*>(values),
+                     NumFrames * sizeof(double));
+    } else {
+      for (unsigned int i=0; i<NumFrames; ++i)
+        WriteLittleEndian(datafile, values[i]);
+    }
+  }
+
+  datafile.flush();
+  NumFrames = 0;
+}
+}
@@ -0,0 +1,129 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Header:       FGOutputBinaryFile.h
+ Author:       The JSBSim team
+ Date started: 10/16/26
+
+ ------------- Copyright (C) 2026 The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc., 59
+ Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/16/26         Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+SENTRY
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#ifndef FGOUTPUTBINARYFILE_H
+#define FGOUTPUTBINARYFILE_H
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <vector>
+
+#include "FGOutputFile.h"
+#include "simgear/io/iostreams/sgstream.hxx"
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+FORWARD DECLARATIONS
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DOCUMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/** Implements the output to a binary file. The values are written without any
+    formatting so that large amounts of data can be logged at a high rate. The
+    output is selected with:
+
+    @code
+    <output name="data.bin" type="BINARY" rate="120">
+      <property> position/h-sl-ft </property>
+      ...
+    </output>
+    @endcode
+
+    The file starts with a header which describes the columns:
+    - the 8 characters "JSBSIMBO",
+    - the format version (uint32, currently 1),
+    - the number of columns (uint32),
+    - the maximum number of frames per block (uint32),
+    - for each column: its type (uint8, 0 for a double), its name and its unit
+      (each as a uint16 length followed by the characters, the unit may be
+      empty).
+
+    The header is followed by blocks of frames. Each block starts with its
+    number of frames n (uint32) followed by the n values of the first column,
+    then the n values of the second column and so on. All the integers and
+    the doubles are little-endian. The last block of the file may contain less
+    frames than the others.
+
+    The first column is the simulation time, the following ones are the
+    properties then the functions listed in the output directives. The name of
+    a property column is its caption or its fully qualified name, and its unit
+    is derived from the suffix of the property name (e.g. "ft" for
+    position/h-sl-ft). The subsystems outputs (rates, velocities, etc.) are not
+    supported by this format.
+
+    The files can be read with the module jsbsim.binary_output of the Python
+    package or plotted with simplot.
+ */
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DECLARATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+class FGOutputBinaryFile : public FGOutputFile
+{
+public:
+  /// Constructor
+  FGOutputBinaryFile(FGFDMExec* fdmex) : FGOutputFile(fdmex) {}
+  /// Destructor : writes the pending frames and closes the file.
+  ~FGOutputBinaryFile() override { StopWriter(); CloseFile(); }
+
+  /// Generates the output to the binary file.
+  void Print(void) override;
+
+  /// Number of frames that are stored before being written to the file.
+  static constexpr unsigned int BlockSize = 1024;
+
+protected:
+  sg_ofstream datafile;
+
+  bool OpenFile(void) override;
+  void CloseFile(void) override;
+  bool CanPrintFrames(void) const override { return true; }
+  void PrintFrame(const double* frame) override;
+
+private:
+  /// Values of the pending frames, stored column after column.
+  std::vector<double> Block;
+  unsigned int NumColumns = 0;
+  unsigned int NumFrames = 0;
+
+  void WriteBlock(void);
+};
+}
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+#endif
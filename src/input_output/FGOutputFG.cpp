@@ -219,7 +219,9 @@ void FGOutputFG::SocketDataFill(FGNetFDM* net)
   net->num_engines = min(FGNetFDM::FG_MAX_ENGINES,Propulsion->GetNumEngines()); // Number of valid engines
 
   for (i=0; i<net->num_engines; i++) {
-    auto engine = Propulsion->GetEngine(i);
+    // A raw pointer is used so that the reference count of the engine is not
+    // updated by each cast below.
+    FGEngine* engine = Propulsion->GetEngine(i).get();
     if (engine->GetRunning())
       net->eng_state[i] = 2;       // Engine state running
     else if (engine->GetCranking())
@@ -232,7 +234,7 @@ void FGOutputFG::SocketDataFill(FGNetFDM* net)
       break;
     case (FGEngine::etPiston):
       {
-        auto piston_engine = static_pointer_cast<FGPiston>(engine);
+        auto piston_engine = static_cast<FGPiston*>(engine);
         net->rpm[i]       = (float)(piston_engine->getRPM());
         net->fuel_flow[i] = (float)(piston_engine->getFuelFlow_gph());
         net->fuel_px[i]   = 0; // Fuel pressure, psi  (N/A in current model)
@@ -249,7 +251,7 @@ void FGOutputFG::SocketDataFill(FGNetFDM* net)
     case (FGEngine::etTurboprop):
       break;
     case (FGEngine::etElectric):
-      net->rpm[i] = static_cast<float>(static_pointer_cast<FGElectric>(engine)->getRPM());
+      net->rpm[i] = static_cast<float>(static_cast<FGElectric*>(engine)->getRPM());
       break;
     case (FGEngine::etUnknown):
       break;
@@ -265,13 +267,14 @@ void FGOutputFG::SocketDataFill(FGNetFDM* net)
   net->num_wheels  = min(FGNetFDM::FG_MAX_WHEELS, GroundReactions->GetNumGearUnits());
 
   for (i=0; i<net->num_wheels; i++) {
-    net->wow[i]              = GroundReactions->GetGearUnit(i)->GetWOW();
-    if (GroundReactions->GetGearUnit(i)->GetGearUnitDown())
+    FGLGear* gear = GroundReactions->GetGearUnit(i).get();
+    net->wow[i]              = gear->GetWOW();
+    if (gear->GetGearUnitDown())
       net->gear_pos[i]      = 1;  //gear down, using FCS convention
     else
       net->gear_pos[i]      = 0;  //gear up, using FCS convention
-    net->gear_steer[i]       = (float)(GroundReactions->GetGearUnit(i)->GetSteerNorm());
-    net->gear_compression[i] = (float)(GroundReactions->GetGearUnit(i)->GetCompLen());
+    net->gear_steer[i]       = (float)(gear->GetSteerNorm());
+    net->gear_compression[i] = (float)(gear->GetCompLen());
   }
 
   // Environment
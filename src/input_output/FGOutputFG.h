@@ -75,6 +75,8 @@ public:
 
 protected:
   void PrintHeaders(void) override {};
+  // The net FDM packet is filled from the models.
+  bool CanPrintFrames(void) const override { return false; }
 
 private:
 
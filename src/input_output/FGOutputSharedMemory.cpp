@@ -0,0 +1,122 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       FGOutputSharedMemory.cpp
+ Author:       The JSBSim team
+ Date started: 10/16/26
+ Purpose:      Manage output of sim parameters to shared memory
+ Called by:    FGOutput
+
+ ------------- Copyright (C) 2026 The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc., 59
+ Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+FUNCTIONAL DESCRIPTION
+--------------------------------------------------------------------------------
+Writes the output values to a POSIX shared memory segment.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/16/26         Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include "FGOutputSharedMemory.h"
+#include "FGFDMExec.h"
+#include "FGXMLElement.h"
+#include "math/FGFunction.h"
+#include "FGLog.h"
+
+using namespace std;
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS IMPLEMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+bool FGOutputSharedMemory::Load(Element* el)
+{
+  if (!FGOutputType::Load(el))
+    return false;
+
+  SetOutputName(el->GetAttributeValue("name"));
+
+  if (Name.empty()) {
+    FGXMLLogging log(el, LogLevel::ERROR);
+    log << LogFormat::RED << LogFormat::BOLD
+        << "  The shared memory output requires a name.\n" << LogFormat::RESET;
+    return false;
+  }
+
+  if (SubSystems) {
+    FGXMLLogging log(el, LogLevel::WARN);
+    log << "The subsystems are not supported by the shared memory output "
+        << Name << ". Only the properties and the functions will be output.\n";
+  }
+
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGOutputSharedMemory::InitModel(void)
+{
+  if (!FGOutputType::InitModel())
+    return false;
+
+  vector<string> names;
+  names.push_back("Time");
+  for (unsigned int i=0; i<OutputParameters.size(); ++i) {
+    if (!OutputCaptions[i].empty())
+      names.push_back(OutputCaptions[i]);
+    else
+      names.push_back(OutputParameters[i]->GetFullyQualifiedName());
+  }
+  for (const auto& f: PreFunctions)
+    names.push_back(f->GetName());
+
+  if (!Segment || !Segment->IsOpen() || Segment->GetNumValues() != names.size()
+      || Segment->GetName() != FGSharedMemory::GetSegmentName(Name)) {
+    // The previous segment is removed before its replacement is created since
+    // they may have the same name.
+    Segment.reset();
+    Segment = make_unique<FGSharedMemory>(Name, JSBSIM_SHM_OUTPUT, names);
+  }
+  Record.resize(names.size());
+
+  return Segment->IsOpen();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGOutputSharedMemory::Print(void)
+{
+  if (!Segment || !Segment->IsOpen()) return;
+
+  size_t i = 0;
+  Record[i++] = FDMExec->GetSimTime();
+  for (auto param: OutputParameters)
+    Record[i++] = param->GetValue();
+  for (const auto& f: PreFunctions)
+    Record[i++] = f->getDoubleValue();
+
+  Segment->Write(Record.data());
+}
+}
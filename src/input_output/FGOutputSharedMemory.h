@@ -0,0 +1,109 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Header:       FGOutputSharedMemory.h
+ Author:       The JSBSim team
+ Date started: 10/16/26
+
+ ------------- Copyright (C) 2026 The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc., 59
+ Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/16/26         Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+SENTRY
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#ifndef FGOUTPUTSHAREDMEMORY_H
+#define FGOUTPUTSHAREDMEMORY_H
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <memory>
+#include <vector>
+
+#include "FGOutputType.h"
+#include "FGSharedMemory.h"
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+FORWARD DECLARATIONS
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DOCUMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/** Implements the output to a shared memory segment. The processes running on
+    the same host read the values directly from memory, without any copy
+    through the kernel nor any system call:
+
+    @code
+    <output name="jsbsim_out" type="SHM" rate="120">
+      <property> position/h-sl-ft </property>
+      <property caption="vc"> velocities/vc-kts </property>
+      ...
+    </output>
+    @endcode
+
+    The name of the output is the name of the POSIX shared memory segment
+    (a leading '/' is added if missing). The record contains the simulation
+    time followed by the values of the properties then the functions listed
+    in the output directives. Each call to Print() replaces the record: a
+    reader only gets the last values, not the history. The subsystems outputs
+    (rates, velocities, etc.) are not supported.
+
+    The segment is created by FGFDMExec::RunIC() and removed when the output
+    is destroyed. Its layout and the functions to read it are given by the C
+    header jsbsim_shm.h.
+    @see FGInputSharedMemory
+ */
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DECLARATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+class FGOutputSharedMemory : public FGOutputType
+{
+public:
+  /// Constructor
+  FGOutputSharedMemory(FGFDMExec* fdmex) : FGOutputType(fdmex) {}
+
+  /** Init the output directives from an XML file.
+      @param el XML Element that is pointing to the output directives */
+  bool Load(Element* el) override;
+
+  /** Creates the shared memory segment. The segment is kept if the simulation
+      is reset so that the readers remain attached to it.
+      @result true if the execution succeeded. */
+  bool InitModel(void) override;
+  /// Writes the values to the shared memory segment.
+  void Print(void) override;
+
+private:
+  std::unique_ptr<FGSharedMemory> Segment;
+  std::vector<double> Record;
+};
+}
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+#endif
@@ -76,6 +76,7 @@ FGOutputSocket::FGOutputSocket(FGFDMExec* fdmex) :
 
 FGOutputSocket::~FGOutputSocket()
 {
+  StopWriter();
   delete socket;
 }
 
@@ -279,7 +280,7 @@ void FGOutputSocket::PrintHeaders(void)
 
 void FGOutputSocket::Print(void)
 {
-  string asciiData, scratch;
+  string scratch;
 
   if (socket == 0) return;
   if (!socket->GetConnectStatus()) return;
@@ -391,12 +392,29 @@ void FGOutputSocket::Print(void)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGOutputSocket::PrintFrame(const double* frame)
+{
+  if (socket == 0) return;
+  if (!socket->GetConnectStatus()) return;
+
+  socket->Clear();
+  socket->Append(*frame++);
+  for (unsigned int i=0;i<OutputParameters.size();++i)
+    socket->Append(*frame++);
+
+  socket->Send();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 void FGOutputSocket::SocketStatusOutput(const string& out_str)
 {
   string asciiData;
 
   if (socket == 0) return;
 
+  // The writer thread must not be sending a frame at the same time.
+  FlushWriter();
   socket->Clear();
   asciiData = string("<STATUS>") + out_str;
   socket->Append(asciiData.c_str());
@@ -103,6 +103,8 @@ public:
 
 protected:
   virtual void PrintHeaders(void);
+  bool CanPrintFrames(void) const override { return SubSystems == 0; }
+  void PrintFrame(const double* frame) override;
 
   std::string SockName;
   unsigned int SockPort;
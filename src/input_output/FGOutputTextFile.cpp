@@ -403,4 +403,32 @@ void FGOutputTextFile::Print(void)
   outstream << endl;
   outstream.flush();
 }
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGOutputTextFile::CanPrintFrames(void) const
+{
+  // The output to the console goes through the logger which is not meant to
+  // be used by several threads.
+  return SubSystems == 0 && datafile.is_open();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGOutputTextFile::PrintFrame(const double* frame)
+{
+  ostream outstream(datafile.rdbuf());
+
+  outstream.precision(10);
+  outstream << *frame++;
+
+  outstream.precision(18);
+  for (unsigned int i=0;i<OutputParameters.size();++i)
+    outstream << delimeter << *frame++;
+  for (unsigned int i=0;i<PreFunctions.size();i++)
+    outstream << delimeter << *frame++;
+
+  outstream << endl;
+  outstream.flush();
+}
 }
@@ -67,6 +67,8 @@ class FGOutputTextFile : public FGOutputFile
 public:
   /// Constructor
   FGOutputTextFile(FGFDMExec* fdmex) : FGOutputFile(fdmex), delimeter(",") {}
+  /// Destructor
+  ~FGOutputTextFile() override { StopWriter(); }
 
   /** Set the delimiter.
       @param delim delimiter of the output values (most likely a comma or a
@@ -87,6 +89,8 @@ protected:
   sg_ofstream datafile;
 
   bool OpenFile(void) override;
+  bool CanPrintFrames(void) const override;
+  void PrintFrame(const double* frame) override;
   void CloseFile(void) override { if (datafile.is_open()) datafile.close(); }
 };
 }
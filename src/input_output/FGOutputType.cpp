@@ -39,6 +39,7 @@ INCLUDES
 
 #include "FGFDMExec.h"
 #include "FGOutputType.h"
+#include "FGOutputWriter.h"
 #include "FGXMLElement.h"
 #include "FGPropertyManager.h"
 #include "math/FGTemplateFunc.h"
@@ -55,8 +56,13 @@ CLASS IMPLEMENTATION
 
 FGOutputType::FGOutputType(FGFDMExec* fdmex) :
   FGModel(fdmex),
+  OutputIdx(0),
   SubSystems(0),
-  enabled(true)
+  enabled(true),
+  Async(false),
+  OverrunPolicy(eOverrunPolicy::Drop),
+  BufferSize(1024),
+  Overruns(0)
 {
   Aerodynamics = FDMExec->GetAerodynamics();
   Auxiliary = FDMExec->GetAuxiliary();
@@ -78,6 +84,8 @@ FGOutputType::FGOutputType(FGFDMExec* fdmex) :
 
 FGOutputType::~FGOutputType()
 {
+  StopWriter();
+
   for (auto param: OutputParameters)
     delete param;
 
@@ -168,6 +176,28 @@ bool FGOutputType::Load(Element* element)
 
   SetRateHz(outRate);
 
+  if (element->HasAttribute("phase"))
+    SetPhase(static_cast<unsigned int>(element->GetAttributeValueAsNumber("phase")));
+
+  if (element->HasAttribute("async")) {
+    string policy = element->GetAttributeValue("async");
+    unsigned int bufferSize = BufferSize;
+    if (element->HasAttribute("buffer_size"))
+      bufferSize = (unsigned int)element->GetAttributeValueAsNumber("buffer_size");
+
+    if (policy == "drop")
+      SetAsync(eOverrunPolicy::Drop, bufferSize);
+    else if (policy == "block")
+      SetAsync(eOverrunPolicy::Block, bufferSize);
+    else {
+      FGXMLLogging log(element, LogLevel::ERROR);
+      log << LogFormat::RED << LogFormat::BOLD << "  Unknown value \""
+          << policy << "\" for the attribute async. It should be either "
+          << "\"drop\" or \"block\". The output will be synchronous.\n"
+          << LogFormat::RESET;
+    }
+  }
+
   return true;
 }
 
@@ -175,6 +205,8 @@ bool FGOutputType::Load(Element* element)
 
 bool FGOutputType::InitModel(void)
 {
+  StopWriter();
+
   bool ret = FGModel::InitModel();
 
   Debug(2);
@@ -189,7 +221,7 @@ bool FGOutputType::Run(bool Holding)
   if (!enabled) return true;
 
   RunPreFunctions();
-  Print();
+  Generate();
   RunPostFunctions();
 
   Debug(4);
@@ -199,6 +231,88 @@ bool FGOutputType::Run(bool Holding)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGOutputType::Generate(void)
+{
+  if (!Async) {
+    Print();
+    return;
+  }
+
+  if (!Writer) {
+    if (!CanPrintFrames()) {
+      Print();
+      return;
+    }
+    size_t frameSize = 1 + OutputParameters.size() + PreFunctions.size();
+    Writer = std::make_unique<FGOutputWriter>(frameSize, BufferSize,
+                                    [this](const double* frame) {
+                                      PrintFrame(frame);
+                                    });
+  }
+
+  if (Writer->IsFull()) {
+    Overruns++;
+    if (OverrunPolicy == eOverrunPolicy::Drop) return;
+    Writer->WaitForRoom();
+  }
+
+  SampleFrame(Writer->GetFrame());
+  Writer->Commit();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGOutputType::SampleFrame(double* frame) const
+{
+  *frame++ = FDMExec->GetSimTime();
+  for (auto param: OutputParameters)
+    *frame++ = param->GetValue();
+  for (const auto& f: PreFunctions)
+    *frame++ = f->getDoubleValue();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGOutputType::SetAsync(eOverrunPolicy policy, unsigned int bufferSize)
+{
+  StopWriter();
+
+  if (!Async) {
+    string outputProp = CreateIndexedPropertyName("simulation/output", OutputIdx);
+    PropertyManager->Tie(outputProp + "/async/overruns", this,
+                         &FGOutputType::GetOverruns);
+    PropertyManager->Tie(outputProp + "/async/queued-frames", this,
+                         &FGOutputType::GetQueuedFrames);
+  }
+
+  Async = true;
+  OverrunPolicy = policy;
+  BufferSize = bufferSize > 0 ? bufferSize : 1;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+int FGOutputType::GetQueuedFrames(void) const
+{
+  return Writer ? static_cast<int>(Writer->GetQueued()) : 0;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGOutputType::FlushWriter(void)
+{
+  if (Writer) Writer->Flush();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGOutputType::StopWriter(void)
+{
+  Writer.reset();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 void FGOutputType::SetRateHz(double rtHz)
 {
   rtHz = rtHz>1000?1000:(rtHz<0?0:rtHz);
@@ -63,6 +63,7 @@ class FGGroundReactions;
 class FGExternalReactions;
 class FGBuoyantForces;
 class FGPropertyValue;
+class FGOutputWriter;
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 CLASS DOCUMENTATION
@@ -82,6 +83,38 @@ CLASS DOCUMENTATION
     The class mimics some functionalities of FGModel (methods InitModel(),
     Run() and SetRate()). However it does not inherit from FGModel since it is
     conceptually different from the model paradigm.
+
+    The output can be generated asynchronously: the simulation thread then
+    only copies the values of the output parameters in a ring buffer and the
+    formatting and the writing of the output are done by a background thread
+    (see FGOutputWriter). This is requested with the attribute "async" of the
+    output directive which also specifies what happens when the buffer is full:
+
+    @code
+    <output name="data.csv" type="CSV" rate="120" async="drop" buffer_size="4096">
+      <property> position/h-sl-ft </property>
+      ...
+    </output>
+    @endcode
+
+    - async="drop": the frames that do not fit in the buffer are discarded.
+    - async="block": the simulation waits until the buffer has room for the
+      frame.
+
+    The attribute "buffer_size" is the number of frames that the buffer can
+    hold (1024 by default). The number of frames that have been dropped or
+    that have blocked the simulation is reported by the property
+    simulation/output[i]/async/overruns and the number of frames waiting to be
+    written by simulation/output[i]/async/queued-frames.
+
+    Only the outputs which do not depend on the subsystems (rates, velocities,
+    etc.) can be generated asynchronously, since the subsystems can only be
+    read from the simulation thread. Other outputs ignore the attribute
+    "async" and are generated synchronously.
+
+    The attribute "phase" offsets the frames at which the output is generated
+    within its period (in frames): two outputs with the same rate and different
+    phases are generated at different frames, which spreads their cost.
  */
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -157,13 +190,17 @@ public:
    */
   virtual void Print(void) = 0;
 
+  /** Generate the output now. The output is either generated by Print() or,
+      if the output is asynchronous, queued for the writer thread. */
+  void Generate(void);
+
   /** Reset the output prior to a restart of the simulation. This method should
       be called when the simulation is restarted with, for example, new initial
       conditions. When this method is executed the output instance can take
       special actions such as closing the current output file and open a new
       one with a different name. */
 
-  virtual void SetStartNewOutput(void) {}
+  virtual void SetStartNewOutput(void) { StopWriter(); }
 
   /// Enables the output generation.
   void Enable(void) { enabled = true; }
@@ -191,6 +228,23 @@ public:
     /** Subsystem: Propulsion (= 4096)       */ ssPropulsion      = 4096
   } subsystems;
 
+  /// Policies of the asynchronous output when its buffer is full.
+  enum class eOverrunPolicy {Drop, Block};
+
+  /** Requests the output to be generated asynchronously. This method is taken
+      into account the next time the output is generated.
+      @param policy what to do when the buffer is full
+      @param bufferSize number of frames that the buffer can hold */
+  void SetAsync(eOverrunPolicy policy, unsigned int bufferSize);
+  /// Returns true if the output has been requested to be asynchronous.
+  bool IsAsync(void) const { return Async; }
+  /** Returns the number of frames that have been dropped (or that have blocked
+      the simulation) because the buffer of the asynchronous output was
+      full. */
+  int GetOverruns(void) const { return Overruns; }
+  /// Returns the number of frames waiting to be written.
+  int GetQueuedFrames(void) const;
+
 protected:
   unsigned int OutputIdx;
   int SubSystems;
@@ -211,7 +265,32 @@ protected:
   std::shared_ptr<FGExternalReactions> ExternalReactions;
   std::shared_ptr<FGBuoyantForces> BuoyantForces;
 
+  /** Returns true if the output can be generated from the values of a frame
+      by PrintFrame(). Outputs that return false are always generated
+      synchronously. */
+  virtual bool CanPrintFrames(void) const { return false; }
+  /** Generates the output from the values of a frame. This method is called
+      by the writer thread so it must not access the simulation.
+      @param frame the simulation time, followed by the values of the output
+                   parameters and of the "pre" functions. */
+  virtual void PrintFrame(const double* frame) {}
+  /// Blocks until all the queued frames have been written.
+  void FlushWriter(void);
+  /** Writes the queued frames and stops the writer thread. This method must
+      be called before the destination of the output is closed and by the
+      destructors of the derived classes which implement PrintFrame(). */
+  void StopWriter(void);
+
   void Debug(int from) override;
+
+private:
+  bool Async;
+  eOverrunPolicy OverrunPolicy;
+  unsigned int BufferSize;
+  int Overruns;
+  std::unique_ptr<FGOutputWriter> Writer;
+
+  void SampleFrame(double* frame) const;
 };
 }
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
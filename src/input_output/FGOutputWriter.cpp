@@ -0,0 +1,143 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       FGOutputWriter.cpp
+ Author:       The JSBSim team
+ Date started: 10/16/26
+ Purpose:      Write output frames from a background thread
+ Called by:    FGOutputType
+
+ ------------- Copyright (C) 2026 The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc., 59
+ Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+FUNCTIONAL DESCRIPTION
+--------------------------------------------------------------------------------
+Single producer/single consumer ring buffer of output frames emptied by a
+background thread.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/16/26         Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include "FGOutputWriter.h"
+
+using namespace std;
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS IMPLEMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+FGOutputWriter::FGOutputWriter(size_t frameSize, size_t capacity,
+                               Callback print)
+  : FrameSize(frameSize), Capacity(capacity > 0 ? capacity : 1),
+    Frames(FrameSize * Capacity), Print(std::move(print))
+{
+  Thread = thread(&FGOutputWriter::Loop, this);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGOutputWriter::~FGOutputWriter()
+{
+  Running = false;
+  {
+    lock_guard<mutex> lock(WakeMutex);
+  }
+  WakeWriter.notify_one();
+  Thread.join();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGOutputWriter::Commit(void)
+{
+  Head.fetch_add(1);
+
+  // The store to Head and the load of WriterSleeping below are sequentially
+  // consistent, as are their counterparts in Loop(), so either the writer
+  // thread sees the new frame before going to sleep or it is seen sleeping
+  // here. Taking the lock guarantees that the writer thread is waiting on the
+  // condition variable before it is notified.
+  if (WriterSleeping) {
+    {
+      lock_guard<mutex> lock(WakeMutex);
+    }
+    WakeWriter.notify_one();
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGOutputWriter::WaitUntilQueued(size_t count)
+{
+  if (GetQueued() <= count) return;
+
+  // The store to ProducerWaiting and the load of Tail in GetQueued() are
+  // sequentially consistent, as are the store to Tail and the load of
+  // ProducerWaiting in Loop(), so either this thread sees the frames written
+  // or the writer thread sees it waiting and notifies it.
+  unique_lock<mutex> lock(WakeMutex);
+  ProducerWaiting = true;
+  WakeProducer.wait(lock, [this, count]{ return GetQueued() <= count; });
+  ProducerWaiting = false;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGOutputWriter::Loop(void)
+{
+  for (;;) {
+    size_t tail = Tail.load(memory_order_relaxed);
+
+    if (tail != Head.load(memory_order_acquire)) {
+      try {
+        Print(&Frames[(tail % Capacity) * FrameSize]);
+      } catch (...) {
+        // There is nobody to report the error to on this thread: the frame is
+        // lost but the following ones are still written.
+      }
+      Tail.store(tail+1);
+
+      if (ProducerWaiting) {
+        {
+          lock_guard<mutex> lock(WakeMutex);
+        }
+        WakeProducer.notify_one();
+      }
+      continue;
+    }
+
+    // The frames that were queued before the destructor was called have all
+    // been written.
+    if (!Running) break;
+
+    unique_lock<mutex> lock(WakeMutex);
+    WriterSleeping = true;
+    WakeWriter.wait(lock, [this]{
+      return Tail.load(memory_order_relaxed) != Head.load() || !Running;
+    });
+    WriterSleeping = false;
+  }
+}
+}
@@ -0,0 +1,151 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Header:       FGOutputWriter.h
+ Author:       The JSBSim team
+ Date started: 10/16/26
+
+ ------------- Copyright (C) 2026 The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc., 59
+ Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/16/26         Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+SENTRY
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#ifndef FGOUTPUTWRITER_H
+#define FGOUTPUTWRITER_H
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+FORWARD DECLARATIONS
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DOCUMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/** Writes output frames from a background thread. A frame is a fixed number of
+    doubles (the simulation time followed by the values of the output
+    parameters) that the simulation thread copies in a ring buffer. A
+    background thread removes the frames from the ring buffer and hands them
+    over to a callback which formats and writes them.
+
+    The ring buffer has a single producer (the simulation thread) and a single
+    consumer (the writer thread) so its indices are updated with atomic
+    operations only: the simulation thread never takes a lock as long as the
+    writer thread is busy. A lock is only taken to wake up a writer thread that
+    is sleeping on an empty buffer, or by the simulation thread when it waits
+    for some room in a full buffer.
+
+    The simulation thread uses the buffer as follows:
+
+    @code
+    if (writer.IsFull()) writer.WaitForRoom(); // or drop the frame
+    double* frame = writer.GetFrame();
+    // ... fill the frame ...
+    writer.Commit();
+    @endcode
+
+    @see FGOutputType
+ */
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DECLARATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+class FGOutputWriter
+{
+public:
+  using Callback = std::function<void(const double*)>;
+
+  /** Constructor. Starts the writer thread.
+      @param frameSize number of doubles in a frame
+      @param capacity maximum number of frames in the ring buffer
+      @param print function called by the writer thread for each frame */
+  FGOutputWriter(size_t frameSize, size_t capacity, Callback print);
+  /// Destructor: writes the pending frames and stops the writer thread.
+  ~FGOutputWriter();
+
+  FGOutputWriter(const FGOutputWriter&) = delete;
+  FGOutputWriter& operator=(const FGOutputWriter&) = delete;
+
+  /// Returns true if there is no room left for a new frame.
+  bool IsFull(void) const {
+    return Head.load(std::memory_order_relaxed)
+           - Tail.load(std::memory_order_acquire) >= Capacity;
+  }
+  /// Blocks the calling thread until there is room for a new frame.
+  void WaitForRoom(void) { WaitUntilQueued(Capacity-1); }
+  /** Returns the frame to be filled. The buffer must not be full.
+      @see IsFull() */
+  double* GetFrame(void) {
+    return &Frames[(Head.load(std::memory_order_relaxed) % Capacity) * FrameSize];
+  }
+  /// Queues the frame returned by GetFrame() for the writer thread.
+  void Commit(void);
+  /// Blocks the calling thread until all the queued frames are written.
+  void Flush(void) { WaitUntilQueued(0); }
+
+  /** Returns the number of frames waiting to be written.
+      The loads are sequentially consistent: WaitUntilQueued() relies on it to
+      not miss the wake up of the writer thread. */
+  size_t GetQueued(void) const { return Head.load() - Tail.load(); }
+  size_t GetFrameSize(void) const { return FrameSize; }
+
+private:
+  const size_t FrameSize;
+  const size_t Capacity;
+  std::vector<double> Frames;
+  Callback Print;
+
+  // Number of frames ever queued (written by the producer) and ever written
+  // (written by the consumer). The slot of a frame is its number modulo the
+  // capacity.
+  std::atomic<size_t> Head{0};
+  std::atomic<size_t> Tail{0};
+
+  std::atomic<bool> Running{true};
+  std::atomic<bool> WriterSleeping{false};
+  std::atomic<bool> ProducerWaiting{false};
+  std::mutex WakeMutex;
+  std::condition_variable WakeWriter;
+  std::condition_variable WakeProducer;
+  std::thread Thread;
+
+  void WaitUntilQueued(size_t count);
+  void Loop(void);
+};
+}
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+#endif
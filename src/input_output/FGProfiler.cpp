@@ -0,0 +1,152 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       FGProfiler.cpp
+ Author:       The JSBSim team
+ Date started: 10/16/26
+ Purpose:      Measure the time spent in the parts of a simulation
+
+ ------------- Copyright (C) 2026 The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc., 59
+ Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/16/26         Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <algorithm>
+#include <iomanip>
+#include <ostream>
+#include <vector>
+
+#include "FGProfiler.h"
+#include "FGPropertyManager.h"
+
+using namespace std;
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS IMPLEMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+FGProfiler::FGProfiler(std::shared_ptr<FGPropertyManager> pm)
+  : enabled(false), PropertyManager(pm)
+{
+  PropertyManager->Tie("simulation/profile/enabled", this,
+                       &FGProfiler::IsEnabled, &FGProfiler::SetEnabled);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGProfiler::~FGProfiler()
+{
+  PropertyManager->Unbind(this);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGProfileEntry* FGProfiler::Register(const string& path)
+{
+  auto used = [this](const string& name) {
+    return any_of(Entries.begin(), Entries.end(),
+                  [&name](const FGProfileEntry& e) { return e.path == name; });
+  };
+
+  string name = path;
+  for (unsigned int i=1; used(name); i++)
+    name = path + "[" + to_string(i) + "]";
+
+  int idx = static_cast<int>(Entries.size());
+  Entries.emplace_back();
+  Entries.back().path = name;
+  Entries.back().enabled = &enabled;
+
+  string base = "simulation/profile/" + name;
+  PropertyManager->Tie(base + "/calls", this, idx, &FGProfiler::GetCalls);
+  PropertyManager->Tie(base + "/total-sec", this, idx, &FGProfiler::GetTotalTime);
+  PropertyManager->Tie(base + "/max-us", this, idx, &FGProfiler::GetMaxTime);
+
+  return &Entries.back();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGProfiler::Clear(void)
+{
+  PropertyManager->Unbind(this);
+  Entries.clear();
+
+  PropertyManager->Tie("simulation/profile/enabled", this,
+                       &FGProfiler::IsEnabled, &FGProfiler::SetEnabled);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGProfiler::Reset(void)
+{
+  for (auto& entry: Entries) {
+    entry.calls = 0;
+    entry.last = entry.total = entry.max = 0.0;
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGProfiler::PrintReport(ostream& out) const
+{
+  vector<const FGProfileEntry*> sorted;
+  double frame = 0.0;
+
+  for (auto& entry: Entries) {
+    if (entry.path == "frame") frame = entry.total;
+    if (entry.calls > 0) sorted.push_back(&entry);
+  }
+
+  stable_sort(sorted.begin(), sorted.end(),
+              [](const FGProfileEntry* a, const FGProfileEntry* b) {
+                return a->total > b->total;
+              });
+
+  ios_base::fmtflags flags = out.flags();
+  streamsize precision = out.precision();
+
+  out << endl << "Profile (sorted by cumulative time):" << endl
+      << setw(10) << "calls" << setw(13) << "total (ms)" << setw(12)
+      << "mean (us)" << setw(12) << "max (us)" << setw(10) << "frame %"
+      << "  path" << endl;
+
+  out << fixed;
+  for (auto entry: sorted) {
+    out << setw(10) << entry->calls
+        << setw(13) << setprecision(3) << entry->total*1E3
+        << setw(12) << setprecision(3) << entry->total*1E6/entry->calls
+        << setw(12) << setprecision(3) << entry->max*1E6
+        << setw(10) << setprecision(2)
+        << (frame > 0.0 ? 100.*entry->total/frame : 0.0)
+        << "  " << entry->path << endl;
+  }
+
+  out.flags(flags);
+  out.precision(precision);
+}
+
+}
@@ -0,0 +1,186 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Header:       FGProfiler.h
+ Author:       The JSBSim team
+ Date started: 10/16/26
+
+ ------------- Copyright (C) 2026 The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc., 59
+ Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/16/26         Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+SENTRY
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#ifndef FGPROFILER_H
+#define FGPROFILER_H
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <chrono>
+#include <deque>
+#include <iosfwd>
+#include <memory>
+#include <string>
+
+#include "JSBSim_API.h"
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+FORWARD DECLARATIONS
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace JSBSim {
+
+class FGPropertyManager;
+
+/** Wall clock time statistics of a profiled part of the simulation. */
+struct FGProfileEntry {
+  /// Path of the entry relative to simulation/profile.
+  std::string path;
+  /// Number of times the part has been executed.
+  long calls = 0;
+  /// Last, cumulative and maximum execution times in seconds.
+  double last = 0.0, total = 0.0, max = 0.0;
+  /// Points to the flag of the profiler that enables the measurements.
+  const bool* enabled = nullptr;
+
+  void Add(double duration) {
+    ++calls;
+    last = duration;
+    total += duration;
+    if (duration > max) max = duration;
+  }
+};
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DOCUMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/** Measures the wall clock time spent in the different parts of a simulation.
+    The profiler is owned by the executive. The parts to profile (the frame,
+    the models, the FCS channels and components, the aerodynamic functions)
+    register an entry when they are created and wrap their execution in an
+    FGProfileScope:
+
+    @code{.cpp}
+    {
+      FGProfileScope scope(entry);
+      ... // Code to profile
+    }
+    @endcode
+
+    The profiling is disabled by default in which case the cost of a scope is
+    a test of a boolean. When it is enabled (property simulation/profile/enabled
+    or SetEnabled()), the time is measured with a steady clock and the
+    statistics of each entry are available from the properties
+    simulation/profile/<path>/calls, simulation/profile/<path>/total-sec (the
+    cumulative time in seconds) and simulation/profile/<path>/max-us (the
+    longest execution in microseconds). PrintReport() prints a summary of all
+    the entries sorted from the most to the least expensive.
+
+    Note that the entries are nested: the time spent in a component is also
+    accounted for in its channel, in the FCS model and in the frame.
+
+    @author The JSBSim team
+*/
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DECLARATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+class JSBSIM_API FGProfiler
+{
+public:
+  /** Constructor
+      @param pm the property manager under which the statistics are exposed. */
+  explicit FGProfiler(std::shared_ptr<FGPropertyManager> pm);
+  ~FGProfiler();
+
+  /// Enables or disables the time measurements.
+  void SetEnabled(bool enable) { enabled = enable; }
+  bool IsEnabled(void) const { return enabled; }
+
+  /** Registers a new entry and ties its properties.
+      If the path is already used by another entry, an index is appended to
+      it (e.g. "systems/pitch[1]").
+      @param path path of the entry relative to simulation/profile.
+      @return a pointer to the entry which remains valid until Clear() is
+              called. */
+  FGProfileEntry* Register(const std::string& path);
+
+  /// Removes all the entries and unties their properties.
+  void Clear(void);
+
+  /// Resets the statistics of all the entries.
+  void Reset(void);
+
+  /// Returns the number of entries.
+  size_t GetNumEntries(void) const { return Entries.size(); }
+  /// Returns the i-th entry (in the order of their registration).
+  const FGProfileEntry& GetEntry(size_t i) const { return Entries[i]; }
+
+  /** Prints a summary of the statistics of the entries that have been
+      executed, sorted by decreasing cumulative time. */
+  void PrintReport(std::ostream& out) const;
+
+private:
+  bool enabled;
+  std::shared_ptr<FGPropertyManager> PropertyManager;
+  // A deque does not move its elements when entries are appended.
+  std::deque<FGProfileEntry> Entries;
+
+  long GetCalls(int idx) const { return Entries[idx].calls; }
+  double GetTotalTime(int idx) const { return Entries[idx].total; }
+  double GetMaxTime(int idx) const { return Entries[idx].max * 1E6; }
+};
+
+/** Measures the time elapsed between its construction and its destruction
+    and adds it to a profile entry (see FGProfiler). Nothing is measured when
+    the profiler is disabled or when the entry is null. */
+class FGProfileScope
+{
+public:
+  explicit FGProfileScope(FGProfileEntry* e)
+    : entry(e && *e->enabled ? e : nullptr)
+  {
+    if (entry) start = std::chrono::steady_clock::now();
+  }
+
+  ~FGProfileScope() {
+    if (entry) {
+      std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+      entry->Add(elapsed.count());
+    }
+  }
+
+  FGProfileScope(const FGProfileScope&) = delete;
+  FGProfileScope& operator=(const FGProfileScope&) = delete;
+
+private:
+  FGProfileEntry* entry;
+  std::chrono::steady_clock::time_point start;
+};
+}
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+#endif
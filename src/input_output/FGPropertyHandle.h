@@ -0,0 +1,119 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Header:       FGPropertyHandle.h
+ Author:       The JSBSim team
+ Date started: 10/16/26
+
+ ------------- Copyright (C) 2026 The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc., 59
+ Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/16/26         Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+SENTRY
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#ifndef FGPROPERTYHANDLE_H
+#define FGPROPERTYHANDLE_H
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include "simgear/props/props.hxx"
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+FORWARD DECLARATIONS
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DOCUMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/** Reads the double value of a property node through a resolved access path.
+    SGPropertyNode::getDoubleValue() checks the attributes and dispatches on the
+    type of the node, then on the kind of raw value it is tied to, each time it
+    is called. The handle makes these decisions once when it is bound to a node
+    and keeps the result:
+    - the address of the value when the node holds a double or is tied to a
+      double variable,
+    - the getter of the raw value when the node is tied to methods,
+    - SGPropertyNode::getDoubleValue() otherwise (aliases, other types, traced
+      nodes, etc.)
+
+    The handle checks at each read that the storage serial number of the node
+    has not changed. When the node is tied, untied, changes type or has its
+    attributes modified, the access path is resolved again so the handle always
+    returns the same value as SGPropertyNode::getDoubleValue().
+
+    The handle does not own the node: the caller must keep a reference to the
+    node for as long as the handle is used.
+    @see FGPropertyValue
+*/
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DECLARATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+class FGPropertyHandle
+{
+public:
+  FGPropertyHandle(void) = default;
+  explicit FGPropertyHandle(const SGPropertyNode* node) { Bind(node); }
+
+  /// Binds the handle to a node and resolves its access path.
+  void Bind(const SGPropertyNode* node) {
+    Node = node;
+    if (Node) Resolve();
+  }
+
+  /// Returns the node to which the handle is bound.
+  const SGPropertyNode* GetNode(void) const { return Node; }
+
+  /** Returns the value of the node. The handle must be bound to a node.
+      @return the same value as SGPropertyNode::getDoubleValue() */
+  double getDoubleValue(void) const {
+    if (Node->getStorageSerial() != Serial) Resolve();
+    if (Pointer) return *Pointer;
+    if (Reader) return Reader(Raw);
+    return Node->getDoubleValue();
+  }
+
+private:
+  const SGPropertyNode* Node = nullptr;
+  mutable unsigned int Serial = 0;
+  mutable const double* Pointer = nullptr;
+  mutable const SGRawValue<double>* Raw = nullptr;
+  mutable SGRawValue<double>::reader_t Reader = nullptr;
+
+  void Resolve(void) const {
+    Serial = Node->getStorageSerial();
+    Pointer = Node->getDoublePointer();
+    Raw = Pointer ? nullptr : Node->getDoubleRawValue();
+    Reader = Raw ? Raw->getReader() : nullptr;
+  }
+};
+
+} // namespace JSBSim
+
+#endif
@@ -51,6 +51,7 @@ INCLUDES
 #include "math/FGCondition.h"
 #include "math/FGFunctionValue.h"
 #include "input_output/string_utilities.h"
+#include "input_output/FGStateStream.h"
 
 using namespace std;
 
@@ -261,6 +262,7 @@ bool FGScript::LoadScript(const SGPath& script, double default_dT,
         return false;
       }
       newEvent->Condition = newCondition;
+      newEvent->ConditionEntry = newCondition->Compile(Conditions);
     } else {
       FGXMLLogging log(event_element, LogLevel::ERROR);
       log << "No condition specified in script event " << newEvent->Name << "\n";
@@ -372,6 +374,12 @@ bool FGScript::LoadScript(const SGPath& script, double default_dT,
     event_element = run_element->FindNextElement("event");
   }
 
+  InputEvents.assign(Conditions.GetNumInputs(), vector<unsigned int>());
+  for (unsigned int i=0; i<Events.size(); i++) {
+    for (unsigned int input: Conditions.GetInputs(Events[i].ConditionEntry))
+      InputEvents[input].push_back(i);
+  }
+
   Debug(4);
 
   return true;
@@ -390,6 +398,68 @@ void FGScript::ResetEvents(void)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGScript::SaveState(FGStateWriter& state) const
+{
+  state.Section(ScriptName);
+  state.Write(StartTime);
+  state.Write(EndTime);
+  state.Write(static_cast<uint32_t>(Events.size()));
+
+  for (const auto& thisEvent: Events) {
+    state.Write(thisEvent.Triggered);
+    state.Write(thisEvent.Notified);
+    state.Write(thisEvent.StartTime);
+    state.Write(thisEvent.TimeSpan);
+    state.Write(thisEvent.SetValue);
+    state.Write(thisEvent.newValue);
+    state.Write(thisEvent.OriginalValue);
+    state.Write(thisEvent.ValueSpan);
+    state.Write(thisEvent.Transiting);
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGScript::RestoreState(FGStateReader& state)
+{
+  uint32_t count;
+
+  state.Section(ScriptName);
+  state.Read(StartTime);
+  state.Read(EndTime);
+  state.Read(count);
+  state.CheckCount(count, Events.size());
+
+  for (auto& thisEvent: Events) {
+    state.Read(thisEvent.Triggered);
+    state.Read(thisEvent.Notified);
+    state.Read(thisEvent.StartTime);
+    state.Read(thisEvent.TimeSpan);
+    state.ReadFixed(thisEvent.SetValue);
+    state.ReadFixed(thisEvent.newValue);
+    state.ReadFixed(thisEvent.OriginalValue);
+    state.ReadFixed(thisEvent.ValueSpan);
+    state.ReadFixed(thisEvent.Transiting);
+    thisEvent.ConditionStale = true;
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Reads the properties used by the conditions and flags the events that depend
+// on the properties which have changed.
+
+void FGScript::UpdateConditionInputs(void)
+{
+  for (unsigned int i=0; i<Conditions.GetNumInputs(); i++) {
+    if (Conditions.UpdateInput(i)) {
+      for (unsigned int ev: InputEvents[i])
+        Events[ev].ConditionStale = true;
+    }
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 bool FGScript::RunScript(void)
 {
   unsigned i, j;
@@ -400,18 +470,35 @@ bool FGScript::RunScript(void)
 
   if (currentTime > EndTime) return false;
 
+  Frames++;
+  bool inputsUpdated = false;
+
   // Iterate over all events.
   for (unsigned int ev_ctr=0; ev_ctr < Events.size(); ev_ctr++) {
 
     struct event &thisEvent = Events[ev_ctr];
 
+    // The properties are read again if a previous event has modified one of
+    // them. The condition is only tested when one of its properties has
+    // changed since it was last tested.
+    if (!inputsUpdated) {
+      UpdateConditionInputs();
+      inputsUpdated = true;
+    }
+    if (thisEvent.ConditionStale) {
+      thisEvent.ConditionValue = Conditions.Evaluate(thisEvent.ConditionEntry);
+      thisEvent.ConditionStale = false;
+      thisEvent.Evaluations++;
+    }
+
     // Determine whether the set of conditional tests for this condition equate
     // to true and should cause the event to execute. If the conditions evaluate
     // to true, then the event is triggered. If the event is not persistent,
     // then this trigger will remain set true. If the event is persistent, the
     // trigger will reset to false when the condition evaluates to false.
-    if (thisEvent.Condition->Evaluate()) {
+    if (thisEvent.ConditionValue) {
       if (!thisEvent.Triggered) {
+        thisEvent.Executions++;
 
         // The conditions are true, do the setting of the desired Event
         // parameters
@@ -500,6 +587,7 @@ bool FGScript::RunScript(void)
             break;
           }
           thisEvent.SetParam[i]->setDoubleValue(newSetValue);
+          inputsUpdated = false;
         }
       }
 
@@ -555,6 +643,23 @@ bool FGScript::RunScript(void)
   return true;
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGScript::PrintSummary(void) const
+{
+  FGLogging log(LogLevel::INFO);
+
+  log << "\nScript \"" << ScriptName << "\": " << Frames << " frames, "
+      << Conditions.GetNumInputs() << " properties tested by the events\n";
+
+  for (unsigned int i=0; i<Events.size(); i++) {
+    log << "  Event " << i;
+    if (!Events[i].Name.empty()) log << " (" << Events[i].Name << ")";
+    log << ": condition tested " << Events[i].Evaluations << " times, executed "
+        << Events[i].Executions << " times\n";
+  }
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
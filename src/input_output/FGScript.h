@@ -44,6 +44,7 @@ INCLUDES
 #include "FGJSBBase.h"
 #include "FGPropertyReader.h"
 #include "input_output/FGPropertyManager.h"
+#include "math/FGConditionProgram.h"
 #include "simgear/misc/sg_path.hxx"
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -56,6 +57,8 @@ class FGFDMExec;
 class FGCondition;
 class FGFunction;
 class FGPropertyValue;
+class FGStateWriter;
+class FGStateReader;
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 CLASS DOCUMENTATION
@@ -157,6 +160,15 @@ CLASS DOCUMENTATION
     to be used are specified in the &quot;use&quot; lines. Next,
     comes the &quot;run&quot; section, where the conditions are
     described in &quot;event&quot; clauses.</p>
+
+    <p>The conditions of all the events are compiled into a single
+    FGConditionProgram. At each frame, the properties read by the conditions
+    are read once and the condition of an event is only tested again when one
+    of its properties has changed. The properties are read again after an
+    event has set a property so that the following events see its new value,
+    as if all the conditions had been tested. The number of times each
+    condition has been tested and each event has been executed is reported by
+    PrintSummary().</p>
     @author Jon S. Berndt
 */
 
@@ -194,6 +206,15 @@ public:
 
   void ResetEvents(void);
 
+  /** Prints, for each event, the number of times its condition has been
+      tested and the number of times it has been executed. */
+  void PrintSummary(void) const;
+
+  /// Saves the state of the events (triggered, notified, transiting, etc.)
+  void SaveState(FGStateWriter& state) const;
+  /// Restores the state of the events saved by SaveState().
+  void RestoreState(FGStateReader& state);
+
 private:
   enum eAction {
     FG_RAMP  = 1,
@@ -233,6 +254,11 @@ private:
     std::vector <double>  ValueSpan;
     std::vector <bool>    Transiting;
     std::vector <FGFunction*> Functions;
+    unsigned int     ConditionEntry;  // First instruction in FGScript::Conditions
+    bool             ConditionValue;
+    bool             ConditionStale;  // One of the inputs has changed
+    unsigned long    Evaluations;
+    unsigned long    Executions;
 
     event() {
       Triggered = false;
@@ -243,12 +269,17 @@ private:
       Name = "";
       StartTime = 0.0;
       TimeSpan = 0.0;
+      ConditionEntry = 0;
+      ConditionValue = false;
+      ConditionStale = true;
+      Evaluations = Executions = 0;
     }
 
     void reset(void) {
       Triggered = false;
       Notified = false;
       StartTime = 0.0;
+      ConditionStale = true;
     }
   };
 
@@ -256,6 +287,13 @@ private:
   double  StartTime;
   double  EndTime;
   std::vector <struct event> Events;
+  unsigned long Frames = 0;
+
+  FGConditionProgram Conditions;
+  // Indices of the events whose condition reads each input of Conditions.
+  std::vector <std::vector <unsigned int>> InputEvents;
+
+  void UpdateConditionInputs(void);
 
   FGPropertyReader LocalProperties;
 
@@ -0,0 +1,173 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       FGSharedMemory.cpp
+ Author:       The JSBSim team
+ Date started: 10/16/26
+ Purpose:      Manage a shared memory segment
+ Called by:    FGOutputSharedMemory, FGInputSharedMemory
+
+ ------------- Copyright (C) 2026 The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc., 59
+ Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+FUNCTIONAL DESCRIPTION
+--------------------------------------------------------------------------------
+POSIX shared memory segment holding a record protected by a sequence lock.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/16/26         Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <cerrno>
+#include <cstring>
+
+#include "FGSharedMemory.h"
+#include "FGLog.h"
+
+using namespace std;
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS IMPLEMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#if defined(_WIN32) || !(defined(__GNUC__) || defined(__clang__))
+
+FGSharedMemory::FGSharedMemory(const string& name, int direction,
+                               const vector<string>& names)
+  : Name(GetSegmentName(name)), NumValues(names.size())
+{
+  FGLogging log(LogLevel::ERROR);
+  log << "Shared memory segments are not supported on this platform. The "
+      << "segment " << Name << " will not be created.\n";
+}
+
+FGSharedMemory::~FGSharedMemory() {}
+
+void FGSharedMemory::Write(const double* values) {}
+
+bool FGSharedMemory::Read(double* values, uint64_t& sequence)
+{
+  return false;
+}
+
+#else
+
+FGSharedMemory::FGSharedMemory(const string& name, int direction,
+                               const vector<string>& names)
+  : Name(GetSegmentName(name)), NumValues(names.size())
+{
+  size_t namesSize = 0;
+  for (const auto& n: names) namesSize += n.size() + 1;
+
+  size_t namesOffset = JSBSIM_SHM_VALUES_OFFSET + NumValues * sizeof(double);
+  Size = namesOffset + namesSize;
+
+  int fd = shm_open(Name.c_str(), O_CREAT | O_RDWR, 0666);
+  if (fd < 0) {
+    FGLogging log(LogLevel::ERROR);
+    log << "Could not create the shared memory segment " << Name << ": "
+        << strerror(errno) << "\n";
+    return;
+  }
+
+  // A segment left by a previous run is reused: its size is adjusted to the
+  // new layout.
+  if (ftruncate(fd, static_cast<off_t>(Size)) != 0) {
+    FGLogging log(LogLevel::ERROR);
+    log << "Could not set the size of the shared memory segment " << Name
+        << ": " << strerror(errno) << "\n";
+    close(fd);
+    shm_unlink(Name.c_str());
+    return;
+  }
+
+  void* address = mmap(nullptr, Size, PROT_READ | PROT_WRITE, MAP_SHARED, fd,
+                       0);
+  close(fd);
+  if (address == MAP_FAILED) {
+    FGLogging log(LogLevel::ERROR);
+    log << "Could not map the shared memory segment " << Name << ": "
+        << strerror(errno) << "\n";
+    shm_unlink(Name.c_str());
+    return;
+  }
+
+  Header = static_cast<jsbsim_shm_header*>(address);
+
+  // The magic number is written last so that the processes which attach to
+  // the segment never see a partially initialized header.
+  __atomic_store_n(&Header->magic, 0u, __ATOMIC_RELEASE);
+  memset(static_cast<char*>(address) + sizeof(uint32_t), 0,
+         Size - sizeof(uint32_t));
+  Header->version = JSBSIM_SHM_VERSION;
+  Header->direction = static_cast<uint16_t>(direction);
+  Header->num_values = static_cast<uint32_t>(NumValues);
+  Header->values_offset = JSBSIM_SHM_VALUES_OFFSET;
+  Header->names_offset = static_cast<uint32_t>(namesOffset);
+  Header->names_size = static_cast<uint32_t>(namesSize);
+
+  char* p = static_cast<char*>(address) + namesOffset;
+  for (const auto& n: names) {
+    memcpy(p, n.c_str(), n.size() + 1);
+    p += n.size() + 1;
+  }
+
+  __atomic_store_n(&Header->magic, JSBSIM_SHM_MAGIC, __ATOMIC_RELEASE);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGSharedMemory::~FGSharedMemory()
+{
+  if (!Header) return;
+
+  __atomic_store_n(&Header->magic, 0u, __ATOMIC_RELEASE);
+  munmap(Header, Size);
+  shm_unlink(Name.c_str());
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGSharedMemory::Write(const double* values)
+{
+  if (Header) jsbsim_shm_write(Header, values);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGSharedMemory::Read(double* values, uint64_t& sequence)
+{
+  if (!Header) return false;
+
+  // The writer only holds the lock while it copies a few doubles so a bounded
+  // number of attempts is enough. The simulation is never blocked by a writer
+  // that died in the middle of an update.
+  for (int i=0; i<100; ++i) {
+    if (jsbsim_shm_read(Header, values, &sequence)) return true;
+  }
+  return false;
+}
+
+#endif
+}
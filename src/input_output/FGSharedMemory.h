@@ -0,0 +1,115 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Header:       FGSharedMemory.h
+ Author:       The JSBSim team
+ Date started: 10/16/26
+
+ ------------- Copyright (C) 2026 The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc., 59
+ Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/16/26         Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+SENTRY
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#ifndef FGSHAREDMEMORY_H
+#define FGSHAREDMEMORY_H
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <string>
+#include <vector>
+
+#include "jsbsim_shm.h"
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+FORWARD DECLARATIONS
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DOCUMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/** Creates and maps a POSIX shared memory segment that holds a record of
+    doubles. The layout of the segment and the sequence lock which protects
+    the record are described in jsbsim_shm.h which is also used by the
+    external processes to access the segment.
+
+    The segment is created (or reused if it already exists) by the
+    constructor and removed by the destructor. Shared memory segments are not
+    supported on Windows: the segment is then never open.
+    @see FGOutputSharedMemory, FGInputSharedMemory
+ */
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DECLARATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+class FGSharedMemory
+{
+public:
+  /** Constructor. Creates and initializes the segment.
+      @param name name of the segment. A leading '/' is added if missing.
+      @param direction JSBSIM_SHM_OUTPUT or JSBSIM_SHM_INPUT
+      @param names names of the values of the record */
+  FGSharedMemory(const std::string& name, int direction,
+                 const std::vector<std::string>& names);
+  /// Destructor. Unmaps and removes the segment.
+  ~FGSharedMemory();
+
+  FGSharedMemory(const FGSharedMemory&) = delete;
+  FGSharedMemory& operator=(const FGSharedMemory&) = delete;
+
+  /// Returns true if the segment has been successfully created.
+  bool IsOpen(void) const { return Header != nullptr; }
+  /// Returns the name of the segment.
+  const std::string& GetName(void) const { return Name; }
+  /// Returns the name of the segment created for the given name.
+  static std::string GetSegmentName(const std::string& name) {
+    return (!name.empty() && name[0] == '/') ? name : "/" + name;
+  }
+  /// Returns the number of doubles in the record.
+  size_t GetNumValues(void) const { return NumValues; }
+
+  /// Writes a new record.
+  void Write(const double* values);
+  /** Copies the last record.
+      @param values receives the values of the record
+      @param sequence receives the sequence number of the record (0 if the
+                      record has never been written)
+      @return false if no consistent copy could be made because the record
+              was being modified */
+  bool Read(double* values, uint64_t& sequence);
+
+private:
+  std::string Name;
+  size_t NumValues;
+  jsbsim_shm_header* Header = nullptr;
+  size_t Size = 0;
+};
+}
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+#endif
@@ -0,0 +1,398 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       FGSocketServer.cpp
+ Author:       The JSBSim team
+ Date started: 10/16/26
+ Purpose:      TCP server multiplexing several clients
+ Called by:    FGInputSocket
+
+ ------------- Copyright (C) 2026 The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc., 59
+ Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+FUNCTIONAL DESCRIPTION
+--------------------------------------------------------------------------------
+Non-blocking TCP server that multiplexes its clients with poll().
+
+HISTORY
+--------------------------------------------------------------------------------
+10/16/26         Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#if defined(_MSC_VER) || defined(__MINGW32__)
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#undef ERROR
+#else
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+#include <cerrno>
+#include <cstring>
+
+#include "FGSocketServer.h"
+#include "FGLog.h"
+
+using namespace std;
+
+// Defines that make BSD/Unix sockets and Windows sockets syntax look alike.
+#ifdef _WIN32
+#define poll WSAPoll
+typedef WSAPOLLFD pollfd_t;
+#define WOULD_BLOCK (WSAGetLastError() == WSAEWOULDBLOCK)
+#define SEND_FLAGS 0
+#else
+#define closesocket close
+#define INVALID_SOCKET -1
+#define SOCKET_ERROR -1
+typedef struct pollfd pollfd_t;
+#define WOULD_BLOCK (errno == EWOULDBLOCK || errno == EAGAIN)
+#ifdef MSG_NOSIGNAL
+#define SEND_FLAGS MSG_NOSIGNAL
+#else
+#define SEND_FLAGS 0
+#endif
+#endif
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS IMPLEMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace {
+
+void SetNonBlocking(FGSocketServer::socket_t fd)
+{
+#ifdef _WIN32
+  u_long NoBlock = 1;
+  ioctlsocket(fd, FIONBIO, &NoBlock);
+#else
+  int flags = fcntl(fd, F_GETFL, 0);
+  fcntl(fd, F_SETFL, flags | O_NONBLOCK);
+#endif
+}
+
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGSocketServer::Connection::GetLine(string& line)
+{
+  size_t start = Input.find_first_not_of("\r\n", InputStart);
+  if (start == string::npos) {
+    Input.clear();
+    InputStart = 0;
+    return false;
+  }
+
+  size_t end = Input.find_first_of("\r\n", start);
+  if (end == string::npos) {
+    // Keep the incomplete line for the next call to FGSocketServer::Poll().
+    Input.erase(0, start);
+    InputStart = 0;
+    return false;
+  }
+
+  line.assign(Input, start, end-start);
+  InputStart = end;
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGSocketServer::FGSocketServer(int port, const string& greeting)
+  : Listener(INVALID_SOCKET), Greeting(greeting)
+{
+#ifdef _WIN32
+  WSADATA wsaData;
+  if (WSAStartup(MAKEWORD(2, 2), &wsaData)) {
+    FGLogging log(LogLevel::ERROR);
+    log << "Winsock DLL not initialized ...\n";
+    return;
+  }
+#endif
+
+  socket_t fd = socket(AF_INET, SOCK_STREAM, 0);
+  if (fd == INVALID_SOCKET) {
+    LogSocketError("creating the TCP server socket");
+    return;
+  }
+
+#ifndef _WIN32
+  // Allows the server to be restarted while the connections of a previous
+  // instance are in the TIME_WAIT state.
+  int reuse = 1;
+  setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+#endif
+
+  struct sockaddr_in address;
+  memset(&address, 0, sizeof(address));
+  address.sin_family = AF_INET;
+  address.sin_port = htons(port);
+  address.sin_addr.s_addr = htonl(INADDR_ANY);
+
+  if (bind(fd, (struct sockaddr*)&address, sizeof(address)) == SOCKET_ERROR) {
+    LogSocketError("binding the TCP server socket");
+    CloseSocket(fd);
+    return;
+  }
+
+  if (listen(fd, SOMAXCONN) == SOCKET_ERROR) {
+    LogSocketError("listening to the TCP server socket");
+    CloseSocket(fd);
+    return;
+  }
+
+  SetNonBlocking(fd);
+  Listener = fd;
+
+  if (debug_lvl > 0) {
+    FGLogging log(LogLevel::DEBUG);
+    log << "Listening to TCP connections on port " << port << "\n";
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGSocketServer::~FGSocketServer()
+{
+  for (auto& connection: Connections)
+    CloseSocket(connection->Socket);
+  if (Listener != INVALID_SOCKET) CloseSocket(Listener);
+#ifdef _WIN32
+  WSACleanup();
+#endif
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGSocketServer::IsListening(void) const
+{
+  return Listener != INVALID_SOCKET;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGSocketServer::IsConnected(unsigned int id) const
+{
+  for (auto& connection: Connections)
+    if (connection->ID == id) return true;
+  return false;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGSocketServer::Poll(int timeout)
+{
+  if (Listener == INVALID_SOCKET) return false;
+
+  vector<pollfd_t> fds(Connections.size()+1);
+  fds[0].fd = Listener;
+  fds[0].events = POLLIN;
+  for (size_t i=0; i<Connections.size(); ++i) {
+    fds[i+1].fd = Connections[i]->Socket;
+    // Nothing more is read from a connection which is closing.
+    fds[i+1].events = Connections[i]->Closing ? 0 : POLLIN;
+    if (!Connections[i]->Output.empty()) fds[i+1].events |= POLLOUT;
+  }
+
+  int result = poll(fds.data(), static_cast<unsigned long>(fds.size()), timeout);
+  if (result == SOCKET_ERROR) {
+#ifndef _WIN32
+    if (errno != EINTR)
+#endif
+      LogSocketError("Poll");
+    return false;
+  }
+  if (result == 0) return false;
+
+  bool received = false;
+  vector<bool> dropped(Connections.size(), false);
+
+  for (size_t i=0; i<Connections.size(); ++i) {
+    short revents = fds[i+1].revents;
+    Connection& connection = *Connections[i];
+
+    if (!connection.Closing && (revents & (POLLIN | POLLHUP | POLLERR))) {
+      size_t length = connection.Input.size();
+      if (!Receive(connection)) dropped[i] = true;
+      // A client closing its connection is reported as a reception so that
+      // the owner processes the lines it has sent before it is dropped by
+      // Flush().
+      received |= connection.Input.size() > length || connection.Closing;
+    }
+    if (!dropped[i] && (revents & POLLOUT)) {
+      if (!Send(connection)) dropped[i] = true;
+    }
+  }
+
+  // Remove the connections in reverse order so that the indices remain valid.
+  for (size_t i=Connections.size(); i-- > 0;) {
+    if (dropped[i]) {
+      CloseSocket(Connections[i]->Socket);
+      Connections.erase(Connections.begin()+i);
+    }
+  }
+
+  // The new connections are accepted last since they are not in fds.
+  if (fds[0].revents & POLLIN) Accept();
+
+  return received;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGSocketServer::Flush(void)
+{
+  for (size_t i=Connections.size(); i-- > 0;) {
+    Connection& connection = *Connections[i];
+    bool ok = connection.Output.empty() || Send(connection);
+    if (!ok || (connection.Closing && connection.Output.empty())) {
+      CloseSocket(connection.Socket);
+      Connections.erase(Connections.begin()+i);
+    }
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGSocketServer::Accept(void)
+{
+  for (;;) {
+    socket_t fd = accept(Listener, nullptr, nullptr);
+    if (fd == INVALID_SOCKET) {
+      if (!WOULD_BLOCK) LogSocketError("Accept");
+      return;
+    }
+
+    SetNonBlocking(fd);
+    // The replies and the streamed data are small messages that must not be
+    // delayed by the Nagle algorithm.
+    int noDelay = 1;
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, (const char*)&noDelay,
+               sizeof(noDelay));
+#ifdef SO_NOSIGPIPE
+    int noSigPipe = 1;
+    setsockopt(fd, SOL_SOCKET, SO_NOSIGPIPE, &noSigPipe, sizeof(noSigPipe));
+#endif
+
+    Connections.emplace_back(new Connection(fd, NextID++));
+    Connections.back()->Send(Greeting);
+
+    if (debug_lvl > 0) {
+      FGLogging log(LogLevel::INFO);
+      log << "Client " << Connections.back()->ID << " connected. "
+          << Connections.size() << " client(s) connected.\n";
+    }
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGSocketServer::Receive(Connection& connection)
+{
+  char buf[4096];
+
+  for (;;) {
+    int num_chars = recv(connection.Socket, buf, sizeof buf, 0);
+    if (num_chars > 0) {
+      connection.Input.append(buf, num_chars);
+      if (connection.Input.size() - connection.InputStart > MaxInputSize) {
+        FGLogging log(LogLevel::ERROR);
+        log << "Client " << connection.ID << " sent more than "
+            << MaxInputSize << " bytes without end of line. Closing the "
+            << "connection.\n";
+        return false;
+      }
+      continue;
+    }
+
+    if (num_chars == 0) {
+      // The client has closed the connection. The lines it has sent are still
+      // processed and the connection is dropped by Flush().
+      if (debug_lvl > 0) {
+        FGLogging log(LogLevel::INFO);
+        log << "Client " << connection.ID << " disconnected.\n";
+      }
+      connection.Closing = true;
+      return true;
+    }
+
+    if (WOULD_BLOCK) return true;
+
+    LogSocketError("Receive - TCP data reception");
+    return false;
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGSocketServer::Send(Connection& connection)
+{
+  size_t sent = 0;
+
+  while (sent < connection.Output.size()) {
+    int num_chars = send(connection.Socket, connection.Output.data()+sent,
+                         static_cast<int>(connection.Output.size()-sent),
+                         SEND_FLAGS);
+    if (num_chars == SOCKET_ERROR) {
+      if (WOULD_BLOCK) break;
+      LogSocketError("Send - TCP data sending");
+      return false;
+    }
+    sent += num_chars;
+  }
+
+  connection.Output.erase(0, sent);
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGSocketServer::CloseSocket(socket_t fd)
+{
+  closesocket(fd);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGSocketServer::LogSocketError(const string& msg)
+{
+  FGLogging log(LogLevel::ERROR);
+  log << "Socket error in " << msg << ": ";
+#ifdef _WIN32
+  LPSTR errorMessage = nullptr;
+  DWORD errorCode = WSAGetLastError();
+  FormatMessage(FORMAT_MESSAGE_ALLOCATE_BUFFER | FORMAT_MESSAGE_FROM_SYSTEM | FORMAT_MESSAGE_IGNORE_INSERTS,
+                nullptr, errorCode, MAKELANGID(LANG_NEUTRAL, SUBLANG_DEFAULT), (LPSTR)&errorMessage, 0, nullptr);
+  log << errorMessage << "\n";
+  LocalFree(errorMessage);
+#else
+  log << strerror(errno) << "\n";
+#endif
+}
+}
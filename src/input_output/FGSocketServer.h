@@ -0,0 +1,162 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Header:       FGSocketServer.h
+ Author:       The JSBSim team
+ Date started: 10/16/26
+
+ ------------- Copyright (C) 2026 The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc., 59
+ Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/16/26         Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+SENTRY
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#ifndef FGSOCKETSERVER_H
+#define FGSOCKETSERVER_H
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "FGJSBBase.h"
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+FORWARD DECLARATIONS
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DOCUMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/** A TCP server which serves several clients at once. All the sockets are
+    non-blocking and are multiplexed with poll() (WSAPoll() on Windows) so the
+    server never waits for a single client.
+
+    The server is driven by its owner, once per frame:
+    - Poll() accepts the pending connections, receives the data available from
+      the clients and drops the connections that have failed. A connection
+      closed by its client is only marked as closing so that the lines it has
+      sent can still be processed,
+    - the owner then extracts the complete lines received by each connection
+      with Connection::GetLine() and queues its replies with
+      Connection::Send(),
+    - Flush() sends the queued replies and drops the closing connections which
+      have nothing left to send. The data that could not be sent without
+      blocking is kept for the next call.
+
+    A client which sends more than MaxInputSize bytes that have not been
+    processed yet (for instance a line which never ends) is disconnected.
+
+    Each connection is identified by a number which is never reused, so the
+    owner can keep data about the clients and discard it when the connection
+    has been dropped.
+    @see FGInputSocket
+ */
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DECLARATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+class FGSocketServer : public FGJSBBase
+{
+public:
+  /// Type large enough to hold a socket descriptor on all the platforms.
+  using socket_t = std::intptr_t;
+
+  class Connection {
+  public:
+    /** Extracts the next complete line received from the client.
+        @param line receives the line without its end of line characters
+        @return false if there is no complete line left */
+    bool GetLine(std::string& line);
+    /// Queues data to be sent to the client by FGSocketServer::Flush().
+    void Send(const std::string& data) { Output += data; }
+    /// Number of bytes waiting to be sent to the client.
+    size_t GetPendingOutput(void) const { return Output.size(); }
+    /// Closes the connection once the pending data has been sent.
+    void Close(void) { Closing = true; }
+    unsigned int GetID(void) const { return ID; }
+
+  private:
+    friend class FGSocketServer;
+
+    Connection(socket_t fd, unsigned int id) : Socket(fd), ID(id) {}
+
+    socket_t Socket;
+    unsigned int ID;
+    bool Closing = false;
+    std::string Input;
+    size_t InputStart = 0;
+    std::string Output;
+  };
+
+  /** Constructor. Listens to TCP connections on the given port.
+      @param port the port number
+      @param greeting message sent to each client when it connects */
+  FGSocketServer(int port, const std::string& greeting);
+  /// Destructor. Closes all the connections.
+  ~FGSocketServer();
+
+  /// Returns true if the server is listening to connections.
+  bool IsListening(void) const;
+
+  /** Accepts the new connections and receives the data sent by the clients.
+      @param timeout maximum time in milliseconds to wait for an event: 0 to
+                     return immediately, -1 to wait indefinitely.
+      @return true if some data has been received */
+  bool Poll(int timeout);
+
+  /// Sends the data queued by the connections.
+  void Flush(void);
+
+  const std::vector<std::unique_ptr<Connection>>& GetConnections(void) const
+  { return Connections; }
+
+  /// Returns true if the connection identified by id is still open.
+  bool IsConnected(unsigned int id) const;
+
+  /// Maximum size of the data received from a client and not yet processed.
+  static constexpr size_t MaxInputSize = 1 << 20;
+
+private:
+  socket_t Listener;
+  std::string Greeting;
+  unsigned int NextID = 0;
+  std::vector<std::unique_ptr<Connection>> Connections;
+
+  void Accept(void);
+  bool Receive(Connection& connection);
+  bool Send(Connection& connection);
+  void CloseSocket(socket_t fd);
+  void LogSocketError(const std::string& msg);
+};
+}
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+#endif
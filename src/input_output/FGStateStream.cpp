@@ -0,0 +1,181 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       FGStateStream.cpp
+ Author:       The JSBSim team
+ Date started: 10/16/26
+ Purpose:      Serialization of the simulation state
+
+ ------------- Copyright (C) 2026 The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc., 59
+ Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/16/26         Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include "FGStateStream.h"
+#include "math/FGMatrix33.h"
+#include "math/FGQuaternion.h"
+#include "math/FGLocation.h"
+
+using namespace std;
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS IMPLEMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+void FGStateWriter::Write(const string& value)
+{
+  Write(static_cast<uint32_t>(value.size()));
+  buffer.append(value);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGStateWriter::Write(const FGColumnVector3& value)
+{
+  for (unsigned int i=1; i<=3; i++) Write(value.Entry(i));
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGStateWriter::Write(const FGQuaternion& value)
+{
+  for (unsigned int i=1; i<=4; i++) Write(value.Entry(i));
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGStateWriter::Write(const FGMatrix33& value)
+{
+  for (unsigned int i=1; i<=3; i++)
+    for (unsigned int j=1; j<=3; j++)
+      Write(value.Entry(i, j));
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGStateWriter::Write(const FGLocation& value)
+{
+  // The derived values (latitude, longitude, matrices) are recomputed from the
+  // ECEF coordinates when the location is restored.
+  for (unsigned int i=1; i<=3; i++) Write(value.Entry(i));
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGStateWriter::Write(const vector<bool>& value)
+{
+  Write(static_cast<uint32_t>(value.size()));
+  for (bool v: value) Write(v);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGStateReader::Read(string& value)
+{
+  size_t size = ReadSize();
+  CheckSize(size);
+  value = buffer.substr(pos, size);
+  pos += size;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGStateReader::Read(FGColumnVector3& value)
+{
+  for (unsigned int i=1; i<=3; i++) Read(value(i));
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGStateReader::Read(FGQuaternion& value)
+{
+  for (unsigned int i=1; i<=4; i++) Read(value(i));
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGStateReader::Read(FGMatrix33& value)
+{
+  for (unsigned int i=1; i<=3; i++)
+    for (unsigned int j=1; j<=3; j++)
+      Read(value(i, j));
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGStateReader::Read(FGLocation& value)
+{
+  FGColumnVector3 ecef;
+  Read(ecef);
+  value = ecef;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGStateReader::Read(vector<bool>& value)
+{
+  value.resize(ReadSize());
+  for (size_t i=0; i<value.size(); i++) {
+    bool v;
+    Read(v);
+    value[i] = v;
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGStateReader::ReadFixed(vector<bool>& value)
+{
+  CheckCount(ReadSize(), value.size());
+  for (size_t i=0; i<value.size(); i++) {
+    bool v;
+    Read(v);
+    value[i] = v;
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGStateReader::CheckCount(size_t count, size_t expected) const
+{
+  if (count != expected)
+    throw BaseException("The simulation state does not match the model: "
+                        "expected " + to_string(expected) + " items, found "
+                        + to_string(count) + ".");
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGStateReader::Section(const string& name)
+{
+  string section;
+  Read(section);
+  if (section != name)
+    throw BaseException("The simulation state does not match the model: "
+                        "expected section " + name + ", found " + section
+                        + ".");
+}
+}
@@ -0,0 +1,186 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Header:       FGStateStream.h
+ Author:       The JSBSim team
+ Date started: 10/16/26
+
+ ------------- Copyright (C) 2026 The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc., 59
+ Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/16/26         Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+SENTRY
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#ifndef FGSTATESTREAM_H
+#define FGSTATESTREAM_H
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "FGJSBBase.h"
+#include "math/FGHistory.h"
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+FORWARD DECLARATIONS
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace JSBSim {
+
+class FGColumnVector3;
+class FGQuaternion;
+class FGMatrix33;
+class FGLocation;
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DOCUMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/** Serializes the internal state of the simulation into a binary blob.
+    The values are stored in the native binary format of the machine so a blob
+    is meant to be restored by the same build of JSBSim that produced it.
+    @see FGStateReader
+    @see FGFDMExec::SaveState
+*/
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DECLARATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+class JSBSIM_API FGStateWriter
+{
+public:
+  /// Writes a value which type can be copied byte by byte (numbers, enums...)
+  template <typename T>
+  void Write(const T& value) {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "The type must be trivially copyable");
+    buffer.append(reinterpret_cast<const char*>(&value), sizeof(T));
+  }
+  void Write(const std::string& value);
+  void Write(const FGColumnVector3& value);
+  void Write(const FGQuaternion& value);
+  void Write(const FGMatrix33& value);
+  void Write(const FGLocation& value);
+  void Write(const std::vector<bool>& value);
+  template <typename T>
+  void Write(const std::vector<T>& value) {
+    Write(static_cast<uint32_t>(value.size()));
+    for (const auto& v: value) Write(v);
+  }
+  template <typename T, unsigned int N>
+  void Write(const FGHistory<T, N>& value) {
+    for (unsigned int i=0; i<N; ++i) Write(value[i]);
+  }
+
+  /** Starts a new section of the blob. The section name is checked by
+      FGStateReader::Section() when the blob is read back which allows to
+      detect a blob that has been produced by a different model. */
+  void Section(const std::string& name) { Write(name); }
+
+  /// Returns the blob.
+  const std::string& GetBuffer(void) const { return buffer; }
+
+private:
+  std::string buffer;
+};
+
+/** Restores the internal state of the simulation from a binary blob produced
+    by FGStateWriter. The values must be read in the very same order than they
+    have been written.
+
+    A BaseException is thrown if the blob is truncated or if it does not match
+    the model which is reading it. The reader does not copy the blob which must
+    therefore outlive it: a reader cannot be built from a temporary string.
+    @see FGStateWriter
+    @see FGFDMExec::RestoreState
+*/
+class JSBSIM_API FGStateReader
+{
+public:
+  explicit FGStateReader(std::string_view blob) : buffer(blob), pos(0) {}
+  explicit FGStateReader(std::string&& blob) = delete;
+
+  template <typename T>
+  void Read(T& value) {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "The type must be trivially copyable");
+    CheckSize(sizeof(T));
+    std::memcpy(&value, buffer.data() + pos, sizeof(T));
+    pos += sizeof(T);
+  }
+  void Read(std::string& value);
+  void Read(FGColumnVector3& value);
+  void Read(FGQuaternion& value);
+  void Read(FGMatrix33& value);
+  void Read(FGLocation& value);
+  void Read(std::vector<bool>& value);
+  template <typename T>
+  void Read(std::vector<T>& value) {
+    value.resize(ReadSize());
+    for (auto& v: value) Read(v);
+  }
+  template <typename T, unsigned int N>
+  void Read(FGHistory<T, N>& value) {
+    for (unsigned int i=0; i<N; ++i) Read(value[i]);
+  }
+
+  /** Reads a value which size must match the expected size. This is used for
+      the containers which size is fixed by the model definition (number of
+      engines, of components, etc.) */
+  template <typename T>
+  void ReadFixed(std::vector<T>& value) {
+    CheckCount(ReadSize(), value.size());
+    for (auto& v: value) Read(v);
+  }
+  void ReadFixed(std::vector<bool>& value);
+
+  /// Checks that the number of items stored in the blob is the expected one.
+  void CheckCount(size_t count, size_t expected) const;
+
+  /// Checks that the next section in the blob is the expected one.
+  void Section(const std::string& name);
+
+  /// Returns true if all the blob has been read.
+  bool AtEnd(void) const { return pos == buffer.size(); }
+
+private:
+  std::string_view buffer;
+  size_t pos;
+
+  size_t ReadSize(void) { uint32_t size; Read(size); return size; }
+  void CheckSize(size_t size) const {
+    if (pos + size > buffer.size())
+      throw BaseException("The simulation state is truncated.");
+  }
+};
+}
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+#endif
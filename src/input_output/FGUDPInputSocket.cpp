@@ -37,6 +37,9 @@ HISTORY
 INCLUDES
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
+#include <cstdint>
+#include <cstring>
+
 #include "FGUDPInputSocket.h"
 #include "FGFDMExec.h"
 #include "FGXMLElement.h"
@@ -51,8 +54,39 @@ namespace JSBSim {
 CLASS IMPLEMENTATION
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
+namespace {
+
+bool IsLittleEndian(void)
+{
+  const uint16_t one = 1;
+  uint8_t first;
+  memcpy(&first, &one, 1);
+  return first == 1;
+}
+
+// Reads a value of type T from an unaligned buffer.
+template<typename T>
+double Decode(const char* data, bool swapBytes)
+{
+  uint8_t bytes[sizeof(T)];
+  memcpy(bytes, data, sizeof(T));
+  if (swapBytes) {
+    for (size_t i=0; i < sizeof(T)/2; ++i)
+      std::swap(bytes[i], bytes[sizeof(T)-1-i]);
+  }
+  T value;
+  memcpy(&value, bytes, sizeof(T));
+  return static_cast<double>(value);
+}
+
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 FGUDPInputSocket::FGUDPInputSocket(FGFDMExec* fdmex, bool isEnabled) :
-  FGInputSocket(fdmex, isEnabled), rate(20), oldTimeStamp(0.0)
+  FGInputSocket(fdmex, isEnabled), rate(20), oldTimeStamp(0.0),
+  BinaryFormat(false), SwapBytes(false), RecordSize(0),
+  SizeMismatchLogged(false)
 {
   SockPort = 5139;
   SockProtocol = FGfdmSocket::ptUDP;
@@ -68,6 +102,17 @@ bool FGUDPInputSocket::Load(Element* el)
   rate = atoi(el->GetAttributeValue("rate").c_str());
   SetRate(0.5 + 1.0/(FDMExec->GetDeltaT()*rate));
 
+  string format = el->GetAttributeValue("format");
+  to_lower(format);
+  if (format == "binary")
+    return LoadBinaryLayout(el);
+  else if (!format.empty() && format != "text") {
+    FGXMLLogging log(el, LogLevel::ERROR);
+    log << LogFormat::RED << LogFormat::BOLD << "\n  Unknown input format "
+        << format << "\n" << LogFormat::RESET;
+    return false;
+  }
+
   Element *property_element = el->FindElement("property");
 
   while (property_element) {
@@ -88,10 +133,182 @@ bool FGUDPInputSocket::Load(Element* el)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+bool FGUDPInputSocket::LoadBinaryLayout(Element* el)
+{
+  BinaryFormat = true;
+
+  string byte_order = el->GetAttributeValue("byte_order");
+  to_lower(byte_order);
+  if (byte_order == "big")
+    SwapBytes = IsLittleEndian();
+  else if (byte_order.empty() || byte_order == "little")
+    SwapBytes = !IsLittleEndian();
+  else {
+    FGXMLLogging log(el, LogLevel::ERROR);
+    log << LogFormat::RED << LogFormat::BOLD << "\n  Unknown byte order "
+        << byte_order << "\n" << LogFormat::RESET;
+    return false;
+  }
+
+  // The record starts with the time stamp.
+  RecordSize = sizeof(double);
+
+  Element *property_element = el->FindElement("property");
+
+  while (property_element) {
+    string type = "double";
+    if (property_element->HasAttribute("type")) {
+      type = property_element->GetAttributeValue("type");
+      to_lower(type);
+    }
+
+    Field field;
+    size_t size;
+    if (type == "double") {
+      field.type = eFieldType::Double;
+      size = sizeof(double);
+    } else if (type == "float") {
+      field.type = eFieldType::Float;
+      size = sizeof(float);
+    } else if (type == "int8") {
+      field.type = eFieldType::Int8;
+      size = 1;
+    } else if (type == "uint8") {
+      field.type = eFieldType::UInt8;
+      size = 1;
+    } else if (type == "int16") {
+      field.type = eFieldType::Int16;
+      size = 2;
+    } else if (type == "uint16") {
+      field.type = eFieldType::UInt16;
+      size = 2;
+    } else if (type == "int32") {
+      field.type = eFieldType::Int32;
+      size = 4;
+    } else if (type == "uint32") {
+      field.type = eFieldType::UInt32;
+      size = 4;
+    } else {
+      FGXMLLogging log(property_element, LogLevel::ERROR);
+      log << LogFormat::RED << LogFormat::BOLD << "\n  Unknown field type "
+          << type << "\n" << LogFormat::RESET;
+      return false;
+    }
+
+    string property_str = property_element->GetDataLine();
+    SGPropertyNode* node = PropertyManager->GetNode(property_str);
+    if (!node) {
+      FGXMLLogging log(property_element, LogLevel::ERROR);
+      log << LogFormat::RED << LogFormat::BOLD << "\n  No property by the name "
+          << property_str << " can be found. The field will be ignored.\n"
+          << LogFormat::RESET;
+    } else {
+      InputProperties.push_back(node);
+    }
+
+    // A field is kept even if its property does not exist so that the offsets
+    // of the following fields are not modified.
+    field.offset = RecordSize;
+    field.node = node;
+    Fields.push_back(field);
+    RecordSize += size;
+
+    property_element = el->FindNextElement("property");
+  }
+
+  Record.resize(RecordSize+1);
+  Newest.resize(RecordSize+1);
+
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 void FGUDPInputSocket::Read(bool Holding)
 {
   if (!socket) return;
 
+  if (BinaryFormat)
+    ReadBinary();
+  else
+    ReadText();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGUDPInputSocket::ReadBinary(void)
+{
+  // Drain the socket so that the records do not pile up when the sender is
+  // faster than the input rate: only the newest valid record is applied.
+  bool received = false;
+  int length;
+
+  while ((length = socket->Receive(Record.data(), static_cast<int>(Record.size()))) > 0) {
+    if (static_cast<size_t>(length) != RecordSize) {
+      if (!SizeMismatchLogged) {
+        FGLogging log(LogLevel::ERROR);
+        log << "\nReceived a UDP input record of " << length
+            << " bytes instead of " << RecordSize << " bytes. Further records "
+            << "with a wrong size will be ignored silently.\n";
+        SizeMismatchLogged = true;
+      }
+      continue;
+    }
+
+    double timeStamp = Decode<double>(Record.data(), SwapBytes);
+
+    if (timeStamp < oldTimeStamp) continue;
+
+    oldTimeStamp = timeStamp;
+    Record.swap(Newest);
+    received = true;
+  }
+
+  if (!received) return;
+
+  const char* record = Newest.data();
+
+  for (const Field& field: Fields) {
+    if (!field.node) continue;
+
+    const char* data = record + field.offset;
+    double value = 0.0;
+
+    switch(field.type) {
+    case eFieldType::Double:
+      value = Decode<double>(data, SwapBytes);
+      break;
+    case eFieldType::Float:
+      value = Decode<float>(data, SwapBytes);
+      break;
+    case eFieldType::Int8:
+      value = Decode<int8_t>(data, SwapBytes);
+      break;
+    case eFieldType::UInt8:
+      value = Decode<uint8_t>(data, SwapBytes);
+      break;
+    case eFieldType::Int16:
+      value = Decode<int16_t>(data, SwapBytes);
+      break;
+    case eFieldType::UInt16:
+      value = Decode<uint16_t>(data, SwapBytes);
+      break;
+    case eFieldType::Int32:
+      value = Decode<int32_t>(data, SwapBytes);
+      break;
+    case eFieldType::UInt32:
+      value = Decode<uint32_t>(data, SwapBytes);
+      break;
+    }
+
+    field.node->setDoubleValue(value);
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGUDPInputSocket::ReadText(void)
+{
   data = socket->Receive();
 
   if (!data.empty()) {
@@ -51,6 +51,33 @@ CLASS DOCUMENTATION
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
 /** Implements a UDP input socket.
+
+    By default each datagram is a text line of comma separated values: the
+    time stamp followed by the values of the properties listed in the input
+    directive. With the attribute format="binary", each datagram is a packed
+    record which is decoded without any text parsing:
+
+    @code
+    <input type="udp" port="5139" rate="1000" format="binary" byte_order="little">
+      <property type="float"> fcs/throttle-cmd-norm[0] </property>
+      <property type="int16"> fcs/elevator-cmd-norm </property>
+      <property> fcs/aileron-cmd-norm </property>
+    </input>
+    @endcode
+
+    The record starts with the time stamp as a double, followed by the fields
+    in the order of the property elements without any padding. The type of a
+    field is given by the attribute "type" which can be one of double (the
+    default), float, int8, uint8, int16, uint16, int32 and uint32. The byte
+    order is given by the attribute "byte_order" of the input directive
+    ("little", the default, or "big") and applies to all the fields.
+
+    In both formats, datagrams with a time stamp older than the previous one
+    are ignored, as well as datagrams which do not match the expected number of
+    values (or the size of the record for the binary format). For the binary
+    format, all the pending datagrams are read at each frame and only the
+    newest valid record is applied; a record with a wrong size is reported
+    only once.
  */
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -76,6 +103,33 @@ protected:
   int rate;
   double oldTimeStamp;
   std::vector<SGPropertyNode_ptr> InputProperties;
+
+  /// Types of the fields of a binary record.
+  enum class eFieldType {Double, Float, Int8, UInt8, Int16, UInt16, Int32,
+                         UInt32};
+
+  struct Field {
+    eFieldType type;
+    size_t offset;
+    /// nullptr if the property does not exist: the field is then skipped.
+    SGPropertyNode* node;
+  };
+
+  bool BinaryFormat;
+  bool SwapBytes;
+  std::vector<Field> Fields;
+  size_t RecordSize;
+  /// Receives the datagrams. One byte longer than a record to detect the
+  /// datagrams which are too long.
+  std::vector<char> Record;
+  /// The newest valid record received during the current frame.
+  std::vector<char> Newest;
+  /// The wrong size of a record is only reported once.
+  bool SizeMismatchLogged;
+
+  bool LoadBinaryLayout(Element* el);
+  void ReadText(void);
+  void ReadBinary(void);
 };
 }
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
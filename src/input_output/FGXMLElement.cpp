@@ -45,7 +45,7 @@ FORWARD DECLARATIONS
 
 namespace JSBSim {
 
-bool Element::converterIsInitialized = false;
+std::once_flag Element::converterIsInitialized;
 map <string, map <string, double> > Element::convert;
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -59,8 +59,10 @@ Element::Element(const string& nm)
   element_index = 0;
   line_number = -1;
 
-  if (!converterIsInitialized) {
-    converterIsInitialized = true;
+  // The conversion table is shared by all the elements of all the FGFDMExec
+  // instances so it must be initialized only once, even when several
+  // executives are loading their models concurrently.
+  call_once(converterIsInitialized, []() {
     // convert ["from"]["to"] = factor, so: from * factor = to
     // Length
     convert["M"]["FT"] = 3.2808399;
@@ -254,7 +256,7 @@ Element::Element(const string& nm)
     convert["VOLTS"]["VOLTS"] = 1.0;
     convert["OHMS"]["OHMS"] = 1.0;
     convert["AMPERES"]["AMPERES"] = 1.0;
-  }
+  });
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -723,6 +725,27 @@ void Element::AddData(string d)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+Element_ptr Element::Copy(void) const
+{
+  Element_ptr copy = new Element(name);
+
+  copy->attributes = attributes;
+  copy->data_lines = data_lines;
+  copy->file_name = file_name;
+  copy->line_number = line_number;
+  copy->children.reserve(children.size());
+
+  for (const auto& child: children) {
+    Element_ptr childCopy = child->Copy();
+    childCopy->SetParent(copy);
+    copy->children.push_back(childCopy);
+  }
+
+  return copy;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 string Element::ReadFrom(void) const
 {
   ostringstream message;
@@ -36,6 +36,7 @@ INCLUDES
 
 #include <string>
 #include <map>
+#include <mutex>
 #include <vector>
 
 #include "simgear/structure/SGSharedPtr.hxx"
@@ -179,6 +180,10 @@ public:
   const std::string& GetName(void) const {return name;}
   void ChangeName(const std::string& _name) { name = _name; }
 
+  /// Returns the attributes of the element.
+  const std::map<std::string, std::string>& GetAttributes(void) const
+  { return attributes; }
+
   /** Gets a line of data belonging to an element.
       @param i the index of the data line to return (0 by default).
       @return a string representing the data line requested, or the empty string
@@ -344,6 +349,15 @@ public:
   *   @param el Child element to add. */
   void AddChildElement(Element* el) {children.push_back(el);}
 
+  /** Determines if an element is one of the children of this element.
+  *   @param el Element to look for.
+  *   @return true if el is a child of this element. */
+  bool HasChildElement(const Element* el) const {
+    for (const auto& child: children)
+      if (child == el) return true;
+    return false;
+  }
+
   /** Stores an attribute belonging to this element.
   *   @param name The string name of the attribute.
   *   @param value The string value of the attribute. */
@@ -353,6 +367,13 @@ public:
   *   @param d the data to store. */
   void AddData(std::string d);
 
+  /** Returns a deep copy of the element. The copy has no parent and its
+      children are copies of the children of this element. The element is not
+      modified so several copies can be made from a document that is shared
+      between threads, provided that the document is not modified meanwhile.
+      @return the copy of the element. */
+  Element_ptr Copy(void) const;
+
   /** Prints the element.
   *   Prints this element and calls the Print routine for child elements.
   *   @param d The tab level. A level corresponds to a single space. */
@@ -395,7 +416,7 @@ private:
   int line_number;
   typedef std::map <std::string, std::map <std::string, double> > tMapConvert;
   static tMapConvert convert;
-  static bool converterIsInitialized;
+  static std::once_flag converterIsInitialized;
 };
 
 } // namespace JSBSim
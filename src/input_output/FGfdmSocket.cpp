@@ -54,6 +54,7 @@ INCLUDES
 #include <iostream>
 #include <sstream>
 #include <cstring>
+#include <charconv>
 #include <assert.h>
 
 #include "FGfdmSocket.h"
@@ -339,6 +340,32 @@ string FGfdmSocket::Receive(void)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+int FGfdmSocket::Receive(char* data, int length)
+{
+  assert(Protocol == ptUDP);
+
+  if (sckt == INVALID_SOCKET) return 0;
+
+  struct sockaddr addr;
+  socklen_t fromlen = sizeof addr;
+  int num_chars = recvfrom(sckt, data, length, 0, (struct sockaddr*)&addr, &fromlen);
+  if (num_chars == SOCKET_ERROR) {
+#ifdef _WIN32
+    // Windows reports the truncation of the datagram as an error.
+    if (WSAGetLastError() == WSAEMSGSIZE) return length;
+    if (WSAGetLastError() != WSAEWOULDBLOCK)
+#else
+    if (errno != EWOULDBLOCK)
+#endif
+      LogSocketError("Receive - UDP data reception");
+    return 0;
+  }
+
+  return num_chars;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 int FGfdmSocket::Reply(const string& text)
 {
   int num_chars_sent=0;
@@ -369,7 +396,7 @@ void FGfdmSocket::Close(void)
 
 void FGfdmSocket::Clear(void)
 {
-  buffer.str("");
+  buffer.clear();
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -377,40 +404,62 @@ void FGfdmSocket::Clear(void)
 void FGfdmSocket::Clear(const string& s)
 {
   Clear();
-  buffer << s << ' ';
+  buffer += s;
+  buffer += ' ';
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGfdmSocket::AppendField(const char* item, size_t length, size_t width)
+{
+  if (!buffer.empty()) buffer += ',';
+  if (length < width) buffer.append(width - length, ' ');
+  buffer.append(item, length);
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
 void FGfdmSocket::Append(const char* item)
 {
-  if (buffer.tellp() > 0) buffer << ',';
-  buffer << item;
+  AppendField(item, strlen(item), 0);
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
 void FGfdmSocket::Append(double item)
 {
-  if (buffer.tellp() > 0) buffer << ',';
-  buffer << std::setw(12) << std::setprecision(precision) << item;
+  // The number is formatted in a local array rather than through a stream:
+  // the result is the same as std::setw(12) << std::setprecision(precision)
+  // but no memory is allocated.
+  char str[64];
+#if defined(__cpp_lib_to_chars)
+  auto result = std::to_chars(str, str+sizeof(str), item,
+                              std::chars_format::general, precision);
+  size_t length = result.ec == std::errc() ? result.ptr - str : 0;
+#else
+  std::ostringstream buf;
+  buf.imbue(std::locale::classic());
+  buf << std::setprecision(precision) << item;
+  size_t length = buf.str().copy(str, sizeof(str));
+#endif
+  AppendField(str, length, 12);
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
 void FGfdmSocket::Append(long item)
 {
-  if (buffer.tellp() > 0) buffer << ',';
-  buffer << std::setw(12) << item;
+  char str[32];
+  auto result = std::to_chars(str, str+sizeof(str), item);
+  AppendField(str, result.ptr - str, 12);
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
 void FGfdmSocket::Send(void)
 {
-  buffer << '\n';
-  string str = buffer.str();
-  Send(str.c_str(), str.size());
+  buffer += '\n';
+  Send(buffer.data(), static_cast<int>(buffer.size()));
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
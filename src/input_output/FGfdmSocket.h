@@ -39,6 +39,8 @@ SENTRY
 INCLUDES
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
+#include <string>
+
 #include "FGJSBBase.h"
 
 #if defined(_MSC_VER) || defined(__MINGW32__)
@@ -115,6 +117,17 @@ public:
    */
   std::string Receive(void);
 
+  /**
+   * @brief Receive a single datagram from a UDP socket without allocating
+   * memory.
+   *
+   * @param data The buffer in which the datagram is copied.
+   * @param length The size of the buffer. A longer datagram is truncated.
+   * @return The number of bytes copied in the buffer, 0 if no datagram was
+   *         available.
+   */
+  int Receive(char* data, int length);
+
   /**
    * @brief Send a reply to the client ending by a prompt "JSBSim>"
    *
@@ -187,10 +200,13 @@ private:
   ProtocolType Protocol;
   struct sockaddr_in scktName;
   struct hostent *host;
-  std::ostringstream buffer;
+  /// Record being assembled. It is cleared but never shrunk so that once it
+  /// has reached the size of a record, no memory is allocated anymore.
+  std::string buffer;
   int precision;
   bool connected;
   void LogSocketError(const std::string& msg);
+  void AppendField(const char* item, size_t length, size_t width);
   void Debug(int from);
 };
 }
@@ -0,0 +1,229 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Header:       jsbsim_shm.h
+ Author:       The JSBSim team
+ Date started: 10/16/26
+
+ ------------- Copyright (C) 2026 The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc., 59
+ Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+FUNCTIONAL DESCRIPTION
+--------------------------------------------------------------------------------
+Layout of the shared memory segments created by the SHM input and output types
+of JSBSim, and the functions to access them. This header is plain C so that it
+can be used by the processes which are coupled to JSBSim, whatever their
+language.
+
+A segment is made of a header, followed by the record (an array of doubles)
+and by the names of the values of the record. The record is protected by a
+sequence lock: the writer makes the sequence number odd before modifying the
+record and even again once it is done. A reader copies the record and checks
+that the sequence number was even and has not changed meanwhile, otherwise it
+tries again. Neither side takes a lock nor makes a system call.
+
+Typical reader of an output segment:
+
+  size_t size;
+  jsbsim_shm_header* shm = jsbsim_shm_attach("/jsbsim_out", &size);
+  double values[64];
+  uint64_t sequence;
+  while (!jsbsim_shm_read(shm, values, &sequence));
+  ...
+  jsbsim_shm_detach(shm, size);
+
+Each segment must have a single writer: JSBSim for an output segment, the
+external process for an input segment.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/16/26         Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+SENTRY
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#ifndef JSBSIM_SHM_H
+#define JSBSIM_SHM_H
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+SEGMENT LAYOUT
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/** Value of the field magic once the segment is initialized ("JSBM"). */
+#define JSBSIM_SHM_MAGIC 0x4d42534au
+#define JSBSIM_SHM_VERSION 1
+
+/** Values of the field direction. */
+#define JSBSIM_SHM_OUTPUT 0  /* Written by JSBSim */
+#define JSBSIM_SHM_INPUT  1  /* Read by JSBSim */
+
+/** Header at the start of a segment. All the offsets are in bytes from the
+    start of the segment. */
+typedef struct jsbsim_shm_header {
+  uint32_t magic;
+  uint16_t version;
+  uint16_t direction;
+  /** Number of doubles in the record. For an output segment, the first one is
+      the simulation time. */
+  uint32_t num_values;
+  uint32_t values_offset;
+  /** The names of the values, each terminated by a null character. */
+  uint32_t names_offset;
+  uint32_t names_size;
+  /** Sequence lock: odd while the record is being written, incremented by 2
+      for each new record. 0 if the record has never been written. */
+  uint64_t sequence;
+} jsbsim_shm_header;
+
+/** Offset of the record: it starts on its own cache line. */
+#define JSBSIM_SHM_VALUES_OFFSET 64
+
+static inline double* jsbsim_shm_values(jsbsim_shm_header* shm)
+{
+  return (double*)((char*)shm + shm->values_offset);
+}
+
+static inline const char* jsbsim_shm_names(const jsbsim_shm_header* shm)
+{
+  return (const char*)shm + shm->names_offset;
+}
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+RECORD ACCESS
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#if defined(__GNUC__) || defined(__clang__)
+
+/** Writes a new record. Must only be called by the writer of the segment.
+    @param values num_values doubles */
+static inline void jsbsim_shm_write(jsbsim_shm_header* shm, const double* values)
+{
+  double* record = jsbsim_shm_values(shm);
+  uint64_t sequence = __atomic_load_n(&shm->sequence, __ATOMIC_RELAXED);
+  uint32_t i;
+
+  __atomic_store_n(&shm->sequence, sequence+1, __ATOMIC_RELAXED);
+  __atomic_thread_fence(__ATOMIC_RELEASE);
+  for (i=0; i<shm->num_values; ++i)
+    __atomic_store(&record[i], (double*)&values[i], __ATOMIC_RELAXED);
+  __atomic_store_n(&shm->sequence, sequence+2, __ATOMIC_RELEASE);
+}
+
+/** Copies the record.
+    @param values receives num_values doubles
+    @param sequence if not NULL, receives the sequence number of the record
+    @return 1 if the copy is consistent, 0 if the record was being written in
+            which case the call must be repeated. */
+static inline int jsbsim_shm_read(jsbsim_shm_header* shm, double* values,
+                                  uint64_t* sequence)
+{
+  double* record = jsbsim_shm_values(shm);
+  uint64_t before = __atomic_load_n(&shm->sequence, __ATOMIC_ACQUIRE);
+  uint64_t after;
+  uint32_t i;
+
+  if (before & 1) return 0;
+  for (i=0; i<shm->num_values; ++i)
+    __atomic_load(&record[i], &values[i], __ATOMIC_RELAXED);
+  __atomic_thread_fence(__ATOMIC_ACQUIRE);
+  after = __atomic_load_n(&shm->sequence, __ATOMIC_RELAXED);
+
+  if (before != after) return 0;
+  if (sequence) *sequence = before;
+  return 1;
+}
+
+/** Returns the sequence number of the last record written. */
+static inline uint64_t jsbsim_shm_sequence(jsbsim_shm_header* shm)
+{
+  return __atomic_load_n(&shm->sequence, __ATOMIC_ACQUIRE);
+}
+
+#endif
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+ATTACHMENT
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#if !defined(_WIN32) && (defined(__GNUC__) || defined(__clang__))
+
+/** Maps a segment created by JSBSim.
+    @param name the name of the segment (e.g. "/jsbsim_out")
+    @param size receives the size of the mapping
+    @return NULL if the segment does not exist or is not initialized yet */
+static inline jsbsim_shm_header* jsbsim_shm_attach(const char* name,
+                                                   size_t* size)
+{
+  struct stat st;
+  void* address;
+  jsbsim_shm_header* shm;
+  int fd = shm_open(name, O_RDWR, 0);
+
+  if (fd < 0) return NULL;
+  if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(jsbsim_shm_header)) {
+    close(fd);
+    return NULL;
+  }
+  address = mmap(NULL, (size_t)st.st_size, PROT_READ | PROT_WRITE, MAP_SHARED,
+                 fd, 0);
+  close(fd);
+  if (address == MAP_FAILED) return NULL;
+
+  shm = (jsbsim_shm_header*)address;
+  if (__atomic_load_n(&shm->magic, __ATOMIC_ACQUIRE) != JSBSIM_SHM_MAGIC
+      || shm->version != JSBSIM_SHM_VERSION) {
+    munmap(address, (size_t)st.st_size);
+    return NULL;
+  }
+
+  *size = (size_t)st.st_size;
+  return shm;
+}
+
+/** Unmaps a segment mapped by jsbsim_shm_attach(). */
+static inline void jsbsim_shm_detach(jsbsim_shm_header* shm, size_t size)
+{
+  munmap(shm, size);
+}
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -37,11 +37,12 @@ INCLUDES
 #ifdef __CYGWIN__
 #define _GNU_SOURCE 1
 #endif
+#include <charconv>
+#include <cmath>
 #include <errno.h>
 #include <iostream>
 #include <sstream>
 #include <stdio.h>
-#include <regex>
 #ifdef __APPLE__
 #include <xlocale.h>
 #else
@@ -79,39 +80,138 @@ struct CNumericLocale
   locale_t Locale;
 };
 
+namespace {
+
+bool IsSpace(char c)
+{
+  return isspace(static_cast<unsigned char>(c));
+}
+
+bool IsDigit(char c)
+{
+  return isdigit(static_cast<unsigned char>(c));
+}
+
+/* Checks that the characters starting at 'first' are a number with the format
+ * [+-]?(\d+(\.\d*)?|\.\d+)([eE][+-]?\d+)?
+ * Returns a pointer past the last character of the number or nullptr if the
+ * characters do not match the format.
+ */
+const char* ScanNumber(const char* first, const char* last)
+{
+  const char* p = first;
+
+  if (p != last && (*p == '+' || *p == '-')) ++p;
+
+  const char* digits = p;
+  while (p != last && IsDigit(*p)) ++p;
+  bool mantissa = p != digits;
+
+  if (p != last && *p == '.') {
+    const char* fraction = ++p;
+    while (p != last && IsDigit(*p)) ++p;
+    mantissa = mantissa || p != fraction;
+  }
+
+  if (!mantissa) return nullptr;
+
+  if (p != last && (*p == 'e' || *p == 'E')) {
+    ++p;
+    if (p != last && (*p == '+' || *p == '-')) ++p;
+    const char* exponent = p;
+    while (p != last && IsDigit(*p)) ++p;
+    if (p == exponent) return nullptr;
+  }
+
+  return p;
+}
+
+/* Converts the characters [first, last) which have been checked by
+ * ScanNumber(). Returns false if the number is too large.
+ * std::from_chars is used when the standard library supports it for floating
+ * point numbers: it does not depend on the locale and does not need the
+ * string to be null terminated.
+ */
+bool ConvertNumber(const char* first, const char* last, double& value)
+{
+#if defined(__cpp_lib_to_chars)
+  if (*first == '+') ++first;
+  if (from_chars(first, last, value).ec == errc()) return true;
+  // The number is out of range: strtod_l() tells the numbers that are rounded
+  // down to zero from the numbers that are too large.
+#endif
+  static const CNumericLocale numeric_c;
+  const string number(first, last);
+  errno = 0;          // Reset the error code
+  value = strtod_l(number.c_str(), nullptr, numeric_c.Locale);
+
+  return fabs(value) != HUGE_VAL || errno != ERANGE;
+}
+
+}
+
 /* A locale independent version of atof().
  * Whatever is the current locale of the application, atof_locale_c() reads
  * numbers assuming that the decimal point is the period (.)
  */
 double atof_locale_c(const string& input)
 {
-  static const std::regex number_format(R"(^\s*[+-]?(\d+(\.\d*)?|\.\d+)([eE][+-]?\d+)?\s*$)");
   const char* first = input.c_str();
+  const char* last = first + input.size();
 
   // Skip leading whitespaces
-  while (isspace(*first)) ++first;
+  while (first != last && IsSpace(*first)) ++first;
 
-  if (!*first)
+  if (first == last)
     throw InvalidNumber("Expecting a numeric attribute value, but only got spaces");
 
-  if (!std::regex_match(input, number_format))
+  const char* end = ScanNumber(first, last);
+  const char* trailing = end;
+
+  // Skip trailing whitespaces
+  if (trailing)
+    while (trailing != last && IsSpace(*trailing)) ++trailing;
+
+  if (!end || trailing != last)
     throw InvalidNumber("Expecting a numeric attribute value, but got: " + input);
 
-  CNumericLocale numeric_c;
-  errno = 0;          // Reset the error code
-  double value = strtod_l(first, nullptr, numeric_c.Locale);
+  double value;
 
-  // Error management
-  std::stringstream s;
+  if (!ConvertNumber(first, end, value))
+    throw InvalidNumber("This number is too large: " + input);
 
-  if (fabs(value) == HUGE_VAL && errno == ERANGE)
-    s << "This number is too large: " << input;
-  else if (fabs(value) == 0 && errno == EINVAL)
-    s << "Expecting a numeric attribute value, but got: " << input;
-  else
-    return value;
+  return value;
+}
 
-  throw InvalidNumber(s.str());
+/* Reads the numbers separated by whitespaces in a string with the format
+ * accepted by atof_locale_c() and appends them to a vector.
+ */
+void read_numbers_locale_c(const string& input, vector<double>& values)
+{
+  const char* p = input.c_str();
+  const char* last = p + input.size();
+
+  while (true) {
+    while (p != last && IsSpace(*p)) ++p;
+    if (p == last) break;
+
+    const char* end = ScanNumber(p, last);
+
+    if (!end || (end != last && !IsSpace(*end))) {
+      const char* token_end = p;
+      while (token_end != last && !IsSpace(*token_end)) ++token_end;
+      throw InvalidNumber("Expecting a numeric value, but got: "
+                          + string(p, token_end));
+    }
+
+    double value;
+
+    if (!ConvertNumber(p, end, value))
+      throw InvalidNumber("This number is too large: " + string(p, end));
+
+    values.push_back(value);
+    p = end;
+  }
 }
 
 
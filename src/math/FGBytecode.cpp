@@ -0,0 +1,388 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       FGBytecode.cpp
+ Author:       The JSBSim team
+ Date started: 10/16/26
+ Purpose:      Evaluates the functions lowered into a flat list of instructions
+
+ ------------- Copyright (C) 2026 The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc., 59
+ Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/16/26         Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#include "FGBytecode.h"
+#include "FGParameter.h"
+#include "FGPropertyValue.h"
+#include "input_output/FGLog.h"
+
+using namespace std;
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS IMPLEMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+// The values and the checks below must be kept consistent with FGFunction.cpp
+// so that both evaluations return identical results.
+const double invlog2val = 1.0/log10(2.0);
+bool GetBinary(double val, const string &ctxMsg); // Defined in FGFunction.cpp
+
+// Number of registers that are allocated on the stack by Execute().
+constexpr unsigned int MaxStackRegisters = 64;
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+size_t FGBytecode::Emit(OpCode op, unsigned int dst, unsigned int arg,
+                        unsigned int n)
+{
+  UseRegister(dst);
+  Program.push_back({op, dst, arg, n});
+  return Program.size()-1;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+unsigned int FGBytecode::AddConstant(double value)
+{
+  Constants.push_back(value);
+  return static_cast<unsigned int>(Constants.size()-1);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+unsigned int FGBytecode::AddParameter(const FGParameter* param)
+{
+  Parameters.push_back(param);
+  return static_cast<unsigned int>(Parameters.size()-1);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+unsigned int FGBytecode::AddInput(const FGPropertyValue* input)
+{
+  auto it = find(Inputs.begin(), Inputs.end(), input);
+  if (it != Inputs.end())
+    return static_cast<unsigned int>(it - Inputs.begin());
+
+  Inputs.push_back(input);
+  InputValues.push_back(0.0);
+  return static_cast<unsigned int>(Inputs.size()-1);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+unsigned int FGBytecode::AddMessage(const string& msg)
+{
+  Messages.push_back(msg);
+  return static_cast<unsigned int>(Messages.size()-1);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+unsigned int FGBytecode::AddJumpTable(void)
+{
+  JumpTables.emplace_back();
+  return static_cast<unsigned int>(JumpTables.size()-1);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+double FGBytecode::Execute(void) const
+{
+  if (!Lazy) return Execute(nullptr);
+
+  // The inputs are read ahead of the program so they must all be bound: a
+  // late bound property might not exist yet and would then trigger an error
+  // even if the branch of the program that reads it is not executed.
+  if (!InputsBound) {
+    for (auto input: Inputs) {
+      if (input->IsLateBound()) return Execute(nullptr);
+    }
+    InputsBound = true;
+  }
+
+  if (ReadInputs() || !HasResult) {
+    HasResult = false; // In case the execution throws an exception.
+    Result = Execute(InputValues.data());
+    HasResult = true;
+  }
+
+  return Result;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Reads the inputs and returns true if any of them has changed. The values are
+// compared bitwise: 0.0 and -0.0 can give different results (atan2 for
+// instance) and a NaN would otherwise never compare equal to itself.
+
+bool FGBytecode::ReadInputs(void) const
+{
+  bool changed = false;
+
+  for (size_t i=0; i < Inputs.size(); ++i) {
+    double value = Inputs[i]->GetValue();
+    if (memcmp(&value, &InputValues[i], sizeof(double)) != 0) {
+      InputValues[i] = value;
+      changed = true;
+    }
+  }
+
+  return changed;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+double FGBytecode::Execute(const double* in) const
+{
+  if (NumRegisters <= MaxStackRegisters) {
+    double R[MaxStackRegisters];
+    Run(R, in);
+    return R[0];
+  }
+
+  vector<double> R(NumRegisters);
+  Run(R.data(), in);
+  return R[0];
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGBytecode::Run(double* R, const double* in) const
+{
+  const size_t size = Program.size();
+  size_t pc = 0;
+
+  while (pc < size) {
+    const Instruction& inst = Program[pc++];
+    const double* x = R + inst.arg;
+    double& result = R[inst.dst];
+
+    switch (inst.op) {
+    case OpCode::Const:
+      result = Constants[inst.arg];
+      break;
+    case OpCode::Param:
+      result = Parameters[inst.arg]->GetValue();
+      break;
+    case OpCode::Input:
+      result = in ? in[inst.arg] : Inputs[inst.arg]->GetValue();
+      break;
+    case OpCode::Sum:
+      {
+        double temp = 0.0;
+        for (unsigned int i=0; i < inst.n; ++i) temp += x[i];
+        result = temp;
+      }
+      break;
+    case OpCode::Product:
+      {
+        double temp = 1.0;
+        for (unsigned int i=0; i < inst.n; ++i) temp *= x[i];
+        result = temp;
+      }
+      break;
+    case OpCode::Difference:
+      {
+        double temp = x[0];
+        for (unsigned int i=1; i < inst.n; ++i) temp -= x[i];
+        result = temp;
+      }
+      break;
+    case OpCode::Avg:
+      {
+        double temp = 0.0;
+        for (unsigned int i=0; i < inst.n; ++i) temp += x[i];
+        result = temp / static_cast<size_t>(inst.n);
+      }
+      break;
+    case OpCode::Min:
+      {
+        double _min = HUGE_VAL;
+        for (unsigned int i=0; i < inst.n; ++i)
+          if (x[i] < _min) _min = x[i];
+        result = _min;
+      }
+      break;
+    case OpCode::Max:
+      {
+        double _max = -HUGE_VAL;
+        for (unsigned int i=0; i < inst.n; ++i)
+          if (x[i] > _max) _max = x[i];
+        result = _max;
+      }
+      break;
+    case OpCode::ToRadians:
+      result = x[0]*M_PI/180.;
+      break;
+    case OpCode::ToDegrees:
+      result = x[0]*180./M_PI;
+      break;
+    case OpCode::Sqrt:
+      result = x[0] >= 0.0 ? sqrt(x[0]) : -HUGE_VAL;
+      break;
+    case OpCode::Log2:
+      result = x[0] > 0.0 ? log10(x[0])*invlog2val : -HUGE_VAL;
+      break;
+    case OpCode::Ln:
+      result = x[0] > 0.0 ? log(x[0]) : -HUGE_VAL;
+      break;
+    case OpCode::Log10:
+      result = x[0] > 0.0 ? log10(x[0]) : -HUGE_VAL;
+      break;
+    case OpCode::Sign:
+      result = x[0] < 0.0 ? -1 : 1; // 0.0 counts as positive.
+      break;
+    case OpCode::Exp:
+      result = exp(x[0]);
+      break;
+    case OpCode::Abs:
+      result = fabs(x[0]);
+      break;
+    case OpCode::Sin:
+      result = sin(x[0]);
+      break;
+    case OpCode::Cos:
+      result = cos(x[0]);
+      break;
+    case OpCode::Tan:
+      result = tan(x[0]);
+      break;
+    case OpCode::Asin:
+      result = asin(x[0]);
+      break;
+    case OpCode::Acos:
+      result = acos(x[0]);
+      break;
+    case OpCode::Atan:
+      result = atan(x[0]);
+      break;
+    case OpCode::Floor:
+      result = floor(x[0]);
+      break;
+    case OpCode::Ceil:
+      result = ceil(x[0]);
+      break;
+    case OpCode::Round:
+      result = round(x[0]);
+      break;
+    case OpCode::Fraction:
+      {
+        double scratch;
+        result = modf(x[0], &scratch);
+      }
+      break;
+    case OpCode::Integer:
+      {
+        double integer;
+        modf(x[0], &integer);
+        result = integer;
+      }
+      break;
+    case OpCode::Not:
+      result = GetBinary(x[0], Messages[inst.n]) ? 0.0 : 1.0;
+      break;
+    case OpCode::Quotient:
+      result = x[1] != 0.0 ? x[0]/x[1] : HUGE_VAL;
+      break;
+    case OpCode::Pow:
+      result = pow(x[0], x[1]);
+      break;
+    case OpCode::Fmod:
+      result = x[1] != 0.0 ? fmod(x[0], x[1]) : HUGE_VAL;
+      break;
+    case OpCode::RoundMultiple:
+      result = round((x[0] / x[1])) * x[1];
+      break;
+    case OpCode::Atan2:
+      result = atan2(x[0], x[1]);
+      break;
+    case OpCode::Mod:
+      result = static_cast<int>(x[0]) % static_cast<int>(x[1]);
+      break;
+    case OpCode::Lt:
+      result = x[0] < x[1] ? 1.0 : 0.0;
+      break;
+    case OpCode::Le:
+      result = x[0] <= x[1] ? 1.0 : 0.0;
+      break;
+    case OpCode::Gt:
+      result = x[0] > x[1] ? 1.0 : 0.0;
+      break;
+    case OpCode::Ge:
+      result = x[0] >= x[1] ? 1.0 : 0.0;
+      break;
+    case OpCode::Eq:
+      result = x[0] == x[1] ? 1.0 : 0.0;
+      break;
+    case OpCode::Nq:
+      result = x[0] != x[1] ? 1.0 : 0.0;
+      break;
+    case OpCode::Jump:
+      pc = inst.n;
+      break;
+    case OpCode::JumpIfFalse:
+      if (!GetBinary(result, Messages[inst.arg])) pc = inst.n;
+      break;
+    case OpCode::JumpIfTrue:
+      if (GetBinary(result, Messages[inst.arg])) pc = inst.n;
+      break;
+    case OpCode::Switch:
+      {
+        const string& ctxMsg = Messages[inst.arg];
+        const vector<unsigned int>& table = JumpTables[inst.n];
+        double temp = result;
+        if (temp < 0.0) {
+          LogException err;
+          err << ctxMsg << LogFormat::RED << LogFormat::BOLD
+              << "The switch function index (" << temp
+              << ") is negative.\n" << LogFormat::RESET;
+          throw err;
+        }
+        size_t n = table.size();
+        size_t i = static_cast<size_t>(temp+0.5);
+
+        if (i < n)
+          pc = table[i];
+        else {
+          LogException err;
+          err << ctxMsg << LogFormat::RED << LogFormat::BOLD
+              << "The switch function index (" << temp
+              << ") selected a value above the range of supplied values"
+              << "[0:" << n-1 << "]"
+              << " - not enough values were supplied.\n" << LogFormat::RESET;
+          throw err;
+        }
+      }
+      break;
+    }
+  }
+}
+
+} // namespace JSBSim
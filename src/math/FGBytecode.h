@@ -0,0 +1,187 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Header:       FGBytecode.h
+ Author:       The JSBSim team
+ Date started: 10/16/26
+
+ ------------- Copyright (C) 2026 The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc., 59
+ Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/16/26         Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+SENTRY
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#ifndef FGBYTECODE_H
+#define FGBYTECODE_H
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <string>
+#include <vector>
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+FORWARD DECLARATIONS
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace JSBSim {
+
+class FGParameter;
+class FGPropertyValue;
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DOCUMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/** Flat register based program that evaluates an FGFunction.
+    The tree of parameters of a function is lowered by FGFunction::Compile()
+    into a contiguous list of instructions. Each instruction reads its
+    operands from consecutive registers and writes its result to a register so
+    that the evaluation does not need any virtual call nor any pointer chasing
+    for the operators. The leaves of the tree (properties, tables, etc.) and the
+    operators that are not supported by the bytecode are evaluated by a call to
+    their FGParameter::GetValue() method.
+
+    The instructions perform the very same floating point operations in the
+    very same order as the tree of parameters so both evaluations return
+    identical results. The operands of <ifthen>, <switch>, <and> and <or> are
+    evaluated lazily with conditional jumps, as they are by the tree.
+
+    The program also keeps track of the properties (its inputs) that the
+    function depends on, including the properties read by the tables and by
+    the parameters evaluated through FGParameter::GetValue(). When the function
+    is deterministic, the inputs are read before the program is executed and
+    the result of the previous execution is returned if none of them has
+    changed. Functions that are driven by properties which seldom change (flap
+    or gear position, etc.) are therefore only recomputed when needed.
+    @see FGFunction
+*/
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DECLARATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+class FGBytecode
+{
+public:
+  enum class OpCode {
+    // Data
+    Const, Param, Input,
+    // Functions with a variable number of arguments
+    Sum, Product, Difference, Avg, Min, Max,
+    // Functions with one argument
+    ToRadians, ToDegrees, Sqrt, Log2, Ln, Log10, Sign, Exp, Abs, Sin, Cos, Tan,
+    Asin, Acos, Atan, Floor, Ceil, Round, Fraction, Integer, Not,
+    // Functions with two arguments
+    Quotient, Pow, Fmod, RoundMultiple, Atan2, Mod, Lt, Le, Gt, Ge, Eq, Nq,
+    // Control flow
+    Jump, JumpIfFalse, JumpIfTrue, Switch
+  };
+
+  /** An instruction. The meaning of the fields depends on the operation:
+      - Const: R[dst] = constant #arg
+      - Param: R[dst] = parameter #arg
+      - Input: R[dst] = input #arg
+      - functions: R[dst] = f(R[arg], ..., R[arg+n-1])
+      - Not: R[dst] = !R[arg]. The error message #n is issued if R[arg] is
+        neither 0 nor 1.
+      - Jump: jump to the instruction #n
+      - JumpIfFalse, JumpIfTrue: jump to the instruction #n depending on the
+        value of R[dst]. The error message #arg is issued if R[dst] is neither
+        0 nor 1.
+      - Switch: jump to the instruction #(jump table #n)[R[dst]]. The error
+        message #arg is issued if R[dst] is not a valid index. */
+  struct Instruction {
+    OpCode op;
+    unsigned int dst;
+    unsigned int arg;
+    unsigned int n;
+  };
+
+  /** Adds an instruction to the program.
+      @return the index of the instruction */
+  size_t Emit(OpCode op, unsigned int dst, unsigned int arg=0,
+              unsigned int n=0);
+
+  /// Adds a constant to the program and returns its index.
+  unsigned int AddConstant(double value);
+  /// Adds a parameter to the program and returns its index.
+  unsigned int AddParameter(const FGParameter* param);
+  /** Adds a property to the inputs of the program.
+      @return the index of the input (the index of the existing input if the
+              property has already been added) */
+  unsigned int AddInput(const FGPropertyValue* input);
+  /** Disables the lazy evaluation. This must be called when the result of the
+      program does not only depend on its inputs (random numbers, etc.) */
+  void DisableLazyEvaluation(void) { Lazy = false; }
+  /// Adds an error message to the program and returns its index.
+  unsigned int AddMessage(const std::string& msg);
+  /// Adds an empty jump table to the program and returns its index.
+  unsigned int AddJumpTable(void);
+
+  /// Returns the index of the next instruction to be emitted.
+  unsigned int GetNextAddress(void) const
+  { return static_cast<unsigned int>(Program.size()); }
+  /// Sets the target of the jump instruction #idx to the next instruction.
+  void SetJumpTarget(size_t idx) { Program[idx].n = GetNextAddress(); }
+  /// Appends the next instruction to the jump table #idx.
+  void AddJumpTableEntry(unsigned int idx)
+  { JumpTables[idx].push_back(GetNextAddress()); }
+
+  /// Declares that the register #reg is used by the program.
+  void UseRegister(unsigned int reg)
+  { if (reg >= NumRegisters) NumRegisters = reg+1; }
+
+  /** Executes the program and returns the value of the register #0. The
+      execution is skipped if the lazy evaluation is enabled and if the inputs
+      have not changed since the previous call. */
+  double Execute(void) const;
+
+  /// Returns the number of instructions.
+  size_t GetSize(void) const { return Program.size(); }
+
+private:
+  std::vector<Instruction> Program;
+  std::vector<double> Constants;
+  std::vector<const FGParameter*> Parameters;
+  std::vector<std::string> Messages;
+  std::vector<std::vector<unsigned int>> JumpTables;
+  std::vector<const FGPropertyValue*> Inputs;
+  unsigned int NumRegisters = 0;
+  bool Lazy = true;
+
+  // Lazy evaluation state
+  mutable bool InputsBound = false;
+  mutable bool HasResult = false;
+  mutable double Result = 0.0;
+  mutable std::vector<double> InputValues;
+
+  bool ReadInputs(void) const;
+  double Execute(const double* in) const;
+  void Run(double* R, const double* in) const;
+};
+
+} // namespace JSBSim
+
+#endif
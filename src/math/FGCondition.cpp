@@ -42,6 +42,7 @@ INCLUDES
 #include <utility>
 
 #include "FGCondition.h"
+#include "FGConditionProgram.h"
 #include "FGPropertyValue.h"
 #include "input_output/FGXMLElement.h"
 #include "input_output/FGPropertyManager.h"
@@ -213,6 +214,35 @@ bool FGCondition::Evaluate(void) const
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+unsigned int FGCondition::Compile(FGConditionProgram& program) const
+{
+  using OpCode = FGConditionProgram::OpCode;
+
+  if (!TestParam1) {
+    unsigned int idx = program.Emit(Logic == eAND ? OpCode::And : OpCode::Or);
+    for (auto& cond: conditions)
+      cond->Compile(program);
+    program.EndGroup(idx);
+    return idx;
+  }
+
+  static constexpr array<OpCode, 7> mOpCode {{
+    OpCode::EQ, // ecUndef is never stored once the constructor has succeeded.
+    OpCode::EQ, OpCode::NE, OpCode::GT, OpCode::GE, OpCode::LT, OpCode::LE
+  }};
+
+  unsigned int lhs = program.AddInput(TestParam1);
+  const FGPropertyValue* property = TestParam2->GetProperty();
+
+  if (property)
+    return program.Emit(mOpCode[Comparison], lhs, program.AddInput(property));
+
+  return program.Emit(mOpCode[Comparison], lhs,
+                      program.AddConstant(TestParam2->GetValue()), true);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 void FGCondition::PrintCondition(string indent) const
 {
   FGLogging out(LogLevel::STDOUT);
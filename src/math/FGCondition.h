@@ -39,6 +39,7 @@ INCLUDES
 
 #include "FGJSBBase.h"
 #include "math/FGPropertyValue.h"
+#include "math/FGParameterValue.h"
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 FORWARD DECLARATIONS
@@ -48,6 +49,7 @@ namespace JSBSim {
 
 class FGPropertyManager;
 class FGPropertyValue;
+class FGConditionProgram;
 class Element;
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -70,6 +72,10 @@ public:
 
   bool Evaluate(void) const;
   void PrintCondition(std::string indent="  ") const;
+  /** Appends the condition to a program.
+      @return the index of the first instruction of the condition
+      @see FGConditionProgram */
+  unsigned int Compile(FGConditionProgram& program) const;
 
 private:
 
@@ -78,7 +84,7 @@ private:
   eLogic Logic;
 
   FGPropertyValue_ptr TestParam1;
-  FGParameter_ptr TestParam2;
+  FGParameterValue_ptr TestParam2;
   eComparison Comparison;
   std::string conditional;
   std::vector<std::shared_ptr<FGCondition>> conditions;
@@ -0,0 +1,147 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       FGConditionProgram.cpp
+ Author:       The JSBSim team
+ Date started: 10/16/26
+ Purpose:      Evaluates the conditions lowered into a flat list of instructions
+
+ ------------- Copyright (C) 2026 The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc., 59
+ Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/16/26         Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <algorithm>
+#include <cstring>
+
+#include "FGConditionProgram.h"
+#include "FGPropertyValue.h"
+
+using namespace std;
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS IMPLEMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+unsigned int FGConditionProgram::Emit(OpCode op, unsigned int lhs,
+                                      unsigned int rhs, bool constant)
+{
+  unsigned int idx = GetNextAddress();
+  Program.push_back({op, constant, lhs, rhs, idx+1});
+  return idx;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+unsigned int FGConditionProgram::AddConstant(double value)
+{
+  Constants.push_back(value);
+  return static_cast<unsigned int>(Constants.size()-1);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Each condition has its own FGPropertyValue instances so the inputs are
+// identified by the name of their property, including the sign.
+
+unsigned int FGConditionProgram::AddInput(const FGPropertyValue* input)
+{
+  string name = input->GetFullyQualifiedName();
+  if (input->GetNameWithSign()[0] == '-') name.insert(0, 1, '-');
+
+  auto it = find(InputNames.begin(), InputNames.end(), name);
+  if (it != InputNames.end())
+    return static_cast<unsigned int>(it - InputNames.begin());
+
+  Inputs.push_back(input);
+  InputNames.push_back(name);
+  InputValues.push_back(0.0);
+  return static_cast<unsigned int>(Inputs.size()-1);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// The values are compared bitwise: a NaN would otherwise never compare equal
+// to itself.
+
+bool FGConditionProgram::UpdateInput(unsigned int idx)
+{
+  double value = Inputs[idx]->GetValue();
+  if (memcmp(&value, &InputValues[idx], sizeof(double)) == 0) return false;
+
+  InputValues[idx] = value;
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+vector<unsigned int> FGConditionProgram::GetInputs(unsigned int entry) const
+{
+  vector<unsigned int> inputs;
+
+  for (unsigned int i=entry; i < Program[entry].next; ++i) {
+    const Instruction& ins = Program[i];
+    if (ins.op == OpCode::And || ins.op == OpCode::Or) continue;
+    inputs.push_back(ins.lhs);
+    if (!ins.constant) inputs.push_back(ins.rhs);
+  }
+
+  sort(inputs.begin(), inputs.end());
+  inputs.erase(unique(inputs.begin(), inputs.end()), inputs.end());
+  return inputs;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGConditionProgram::Evaluate(unsigned int entry) const
+{
+  const Instruction& ins = Program[entry];
+
+  switch (ins.op) {
+  case OpCode::And:
+    for (unsigned int i=entry+1; i < ins.next; i = Program[i].next)
+      if (!Evaluate(i)) return false;
+    return true;
+  case OpCode::Or:
+    for (unsigned int i=entry+1; i < ins.next; i = Program[i].next)
+      if (Evaluate(i)) return true;
+    return false;
+  default:
+    break;
+  }
+
+  double value1 = InputValues[ins.lhs];
+  double value2 = ins.constant ? Constants[ins.rhs] : InputValues[ins.rhs];
+
+  switch (ins.op) {
+  case OpCode::EQ: return value1 == value2;
+  case OpCode::NE: return value1 != value2;
+  case OpCode::GT: return value1 > value2;
+  case OpCode::GE: return value1 >= value2;
+  case OpCode::LT: return value1 < value2;
+  case OpCode::LE: return value1 <= value2;
+  default: return false; // Not reached
+  }
+}
+}
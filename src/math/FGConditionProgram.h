@@ -0,0 +1,138 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Header:       FGConditionProgram.h
+ Author:       The JSBSim team
+ Date started: 10/16/26
+
+ ------------- Copyright (C) 2026 The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc., 59
+ Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/16/26         Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+SENTRY
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#ifndef FGCONDITIONPROGRAM_H
+#define FGCONDITIONPROGRAM_H
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <string>
+#include <vector>
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+FORWARD DECLARATIONS
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace JSBSim {
+
+class FGPropertyValue;
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DOCUMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/** Flat program that evaluates a set of FGCondition.
+    Each condition is lowered by FGCondition::Compile() into a contiguous range
+    of instructions: a test group becomes an And or Or instruction followed by
+    the instructions of its members and a test becomes a comparison. The
+    comparisons read the values of the properties from a table of inputs that
+    is shared by all the conditions of the program, so a property used by
+    several conditions is only read once.
+
+    The inputs are not read by Evaluate(): the owner of the program reads them
+    with UpdateInput() which tells whether the value has changed. Since the
+    result of a condition only depends on its inputs, a condition needs only be
+    evaluated again when one of the inputs returned by GetInputs() has
+    changed.
+    @see FGCondition, FGScript
+*/
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DECLARATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+class FGConditionProgram
+{
+public:
+  enum class OpCode { And, Or, EQ, NE, GT, GE, LT, LE };
+
+  /** An instruction. The meaning of the fields depends on the operation:
+      - And, Or: true if all (resp. any) of the conditions located between the
+        next instruction and the instruction #next are true.
+      - comparisons: compares the input #lhs with the constant #rhs if constant
+        is true, or with the input #rhs otherwise.
+      The field next is the index of the instruction that follows the
+      instruction and its operands. */
+  struct Instruction {
+    OpCode op;
+    bool constant;
+    unsigned int lhs;
+    unsigned int rhs;
+    unsigned int next;
+  };
+
+  /** Adds an instruction to the program.
+      @return the index of the instruction */
+  unsigned int Emit(OpCode op, unsigned int lhs=0, unsigned int rhs=0,
+                    bool constant=false);
+  /// Sets the end of the operands of the And/Or instruction #idx.
+  void EndGroup(unsigned int idx) { Program[idx].next = GetNextAddress(); }
+
+  /// Adds a constant to the program and returns its index.
+  unsigned int AddConstant(double value);
+  /** Adds a property to the inputs of the program. A property that is already
+      an input is not added again, even if it is read by another
+      FGPropertyValue.
+      @return the index of the input */
+  unsigned int AddInput(const FGPropertyValue* input);
+
+  /// Returns the index of the next instruction to be emitted.
+  unsigned int GetNextAddress(void) const
+  { return static_cast<unsigned int>(Program.size()); }
+
+  /// Returns the number of inputs.
+  unsigned int GetNumInputs(void) const
+  { return static_cast<unsigned int>(Inputs.size()); }
+  /** Reads the value of the input #idx.
+      @return true if the value has changed since the previous call */
+  bool UpdateInput(unsigned int idx);
+  /// Returns the inputs read by the condition starting at the instruction #entry.
+  std::vector<unsigned int> GetInputs(unsigned int entry) const;
+
+  /** Evaluates the condition starting at the instruction #entry with the
+      values of the inputs read by the last calls to UpdateInput(). */
+  bool Evaluate(unsigned int entry) const;
+
+private:
+  std::vector<Instruction> Program;
+  std::vector<double> Constants;
+  std::vector<const FGPropertyValue*> Inputs;
+  std::vector<std::string> InputNames;
+  std::vector<double> InputValues;
+};
+
+} // namespace JSBSim
+
+#endif
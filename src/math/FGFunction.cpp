@@ -28,7 +28,9 @@ Purpose: Stores various parameter types for functions
 INCLUDES
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
+#include <cstdlib>
 #include <iomanip>
+#include <map>
 #include <memory>
 
 #include "simgear/misc/strutils.hxx"
@@ -111,6 +113,8 @@ public:
         const string& Prefix)
     : FGFunction(pm), f(_f)
   {
+    Operation = el->GetName();
+
     if (el->GetNumElements() != 0) {
       WrongNumberOfArguments err(Parameters, el);
       err << LogFormat::RED << LogFormat::BOLD
@@ -211,6 +215,7 @@ FGFunction::FGFunction(FGFDMExec* fdmex, Element* el, const string& prefix,
   Load(el, var, fdmex, prefix);
   CheckMinArguments(el, 1);
   CheckMaxArguments(el, 1);
+  Compile();
 
   string sCopyTo = el->GetAttributeValue("copyto");
 
@@ -314,6 +319,10 @@ void FGFunction::Load(Element* el, FGPropertyValue* var, FGFDMExec* fdmex,
                       const string& Prefix)
 {
   Name = el->GetAttributeValue("name");
+  Operation = el->GetName();
+  if (Operation == "and" || Operation == "or" || Operation == "not"
+      || Operation == "ifthen" || Operation == "switch")
+    Context = el->ReadFrom();
   Element* element = el->GetElement();
 
   auto sum = [](const decltype(Parameters)& Parameters)->double {
@@ -985,13 +994,159 @@ double FGFunction::GetValue(void) const
 {
   if (cached) return cachedValue;
 
-  double val = Parameters[0]->GetValue();
+  double val = Bytecode ? Bytecode->Execute() : Parameters[0]->GetValue();
 
   if (pCopyTo) pCopyTo->setDoubleValue(val);
 
   return val;
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Lowers the tree of parameters into a flat bytecode. This is only called for
+// the top level functions: the functions nested in the tree are evaluated by
+// the bytecode of the function that contains them.
+
+void FGFunction::Compile(void)
+{
+  if (getenv("JSBSIM_NO_BYTECODE")) return;
+
+  Bytecode.reset(new FGBytecode);
+  Compile(*Bytecode, Parameters[0], 0);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Emits the instructions that evaluate the parameter p and store its value in
+// the register reg. The registers above reg are used as scratch registers.
+
+void FGFunction::Compile(FGBytecode& code, const FGParameter* p,
+                         unsigned int reg) const
+{
+  using OpCode = FGBytecode::OpCode;
+  static const map<string, OpCode> opcodes = {
+    {"sum", OpCode::Sum}, {"product", OpCode::Product},
+    {"difference", OpCode::Difference}, {"avg", OpCode::Avg},
+    {"min", OpCode::Min}, {"max", OpCode::Max},
+    {"toradians", OpCode::ToRadians}, {"todegrees", OpCode::ToDegrees},
+    {"sqrt", OpCode::Sqrt}, {"log2", OpCode::Log2}, {"ln", OpCode::Ln},
+    {"log10", OpCode::Log10}, {"sign", OpCode::Sign}, {"exp", OpCode::Exp},
+    {"abs", OpCode::Abs}, {"sin", OpCode::Sin}, {"cos", OpCode::Cos},
+    {"tan", OpCode::Tan}, {"asin", OpCode::Asin}, {"acos", OpCode::Acos},
+    {"atan", OpCode::Atan}, {"floor", OpCode::Floor}, {"ceil", OpCode::Ceil},
+    {"fraction", OpCode::Fraction}, {"integer", OpCode::Integer},
+    {"quotient", OpCode::Quotient}, {"pow", OpCode::Pow},
+    {"fmod", OpCode::Fmod}, {"atan2", OpCode::Atan2}, {"mod", OpCode::Mod},
+    {"lt", OpCode::Lt}, {"le", OpCode::Le}, {"gt", OpCode::Gt},
+    {"ge", OpCode::Ge}, {"eq", OpCode::Eq}, {"nq", OpCode::Nq}
+  };
+
+  auto f = dynamic_cast<const FGFunction*>(p);
+
+  if (!f) {
+    auto value = dynamic_cast<const FGRealValue*>(p);
+    auto property = dynamic_cast<const FGPropertyValue*>(p);
+    if (value)
+      code.Emit(OpCode::Const, reg, code.AddConstant(value->GetValue()));
+    else if (property)
+      code.Emit(OpCode::Input, reg, code.AddInput(property));
+    else {
+      code.Emit(OpCode::Param, reg, code.AddParameter(p));
+      AddDependencies(code, p);
+    }
+    return;
+  }
+
+  const auto& args = f->Parameters;
+  unsigned int n = static_cast<unsigned int>(args.size());
+  auto it = opcodes.find(f->Operation);
+
+  if (it != opcodes.end()) {
+    for (unsigned int i=0; i < n; ++i)
+      Compile(code, args[i], reg+i);
+    code.Emit(it->second, reg, reg, n);
+  } else if (f->Operation == "roundmultiple") {
+    for (unsigned int i=0; i < n; ++i)
+      Compile(code, args[i], reg+i);
+    code.Emit(n == 1 ? OpCode::Round : OpCode::RoundMultiple, reg, reg, n);
+  } else if (f->Operation == "not") {
+    Compile(code, args[0], reg);
+    code.Emit(OpCode::Not, reg, reg, code.AddMessage(f->Context));
+  } else if (f->Operation == "and" || f->Operation == "or") {
+    // As soon as one parameter is false (resp. true), the result is known and
+    // the remaining parameters are not evaluated.
+    bool isAnd = f->Operation == "and";
+    unsigned int msg = code.AddMessage(f->Context);
+    vector<size_t> jumps;
+    for (auto arg: args) {
+      Compile(code, arg, reg);
+      jumps.push_back(code.Emit(isAnd ? OpCode::JumpIfFalse : OpCode::JumpIfTrue,
+                                reg, msg));
+    }
+    code.Emit(OpCode::Const, reg, code.AddConstant(isAnd ? 1.0 : 0.0));
+    size_t end = code.Emit(OpCode::Jump, reg);
+    for (auto j: jumps) code.SetJumpTarget(j);
+    code.Emit(OpCode::Const, reg, code.AddConstant(isAnd ? 0.0 : 1.0));
+    code.SetJumpTarget(end);
+  } else if (f->Operation == "ifthen") {
+    Compile(code, args[0], reg);
+    size_t otherwise = code.Emit(OpCode::JumpIfFalse, reg,
+                                 code.AddMessage(f->Context));
+    Compile(code, args[1], reg);
+    size_t end = code.Emit(OpCode::Jump, reg);
+    code.SetJumpTarget(otherwise);
+    Compile(code, args[2], reg);
+    code.SetJumpTarget(end);
+  } else if (f->Operation == "switch") {
+    Compile(code, args[0], reg);
+    unsigned int table = code.AddJumpTable();
+    code.Emit(OpCode::Switch, reg, code.AddMessage(f->Context), table);
+    vector<size_t> jumps;
+    for (unsigned int i=1; i < n; ++i) {
+      code.AddJumpTableEntry(table);
+      Compile(code, args[i], reg);
+      jumps.push_back(code.Emit(OpCode::Jump, reg));
+    }
+    for (auto j: jumps) code.SetJumpTarget(j);
+  } else {
+    // The other functions (random numbers, interpolations, rotations, etc.)
+    // are evaluated by the tree of parameters.
+    code.Emit(OpCode::Param, reg, code.AddParameter(p));
+    AddDependencies(code, p);
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Declares the properties that the parameter p reads as inputs of the code.
+
+void FGFunction::AddDependencies(FGBytecode& code, const FGParameter* p) const
+{
+  if (dynamic_cast<const FGRealValue*>(p)) return;
+
+  auto property = dynamic_cast<const FGPropertyValue*>(p);
+  if (property) {
+    code.AddInput(property);
+    return;
+  }
+
+  auto table = dynamic_cast<const FGTable*>(p);
+  if (table) {
+    for (const auto& lookup: table->GetLookupProperties()) {
+      if (lookup) code.AddInput(lookup);
+    }
+    return;
+  }
+
+  auto f = dynamic_cast<const FGFunction*>(p);
+  if (f && f->Operation != "random" && f->Operation != "urandom") {
+    for (const auto& arg: f->Parameters)
+      AddDependencies(code, arg);
+    return;
+  }
+
+  // The result of the parameter is not deterministic or does not only depend
+  // on properties.
+  code.DisableLazyEvaluation();
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
 string FGFunction::GetValueAsString(void) const
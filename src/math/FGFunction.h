@@ -37,6 +37,7 @@ INCLUDES
 #include <memory>
 
 #include "FGParameter.h"
+#include "FGBytecode.h"
 #include "input_output/FGPropertyManager.h"
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -158,6 +159,15 @@ an operation (such as sum) which can contain other items. The point to keep in
 mind is that it evaluates to a single value - which is just what the
 trigonometric functions require (except atan2, which takes two arguments).
 
+Once a function is loaded, its tree of operations is compiled into a flat
+bytecode (see FGBytecode) which is used to evaluate the function at run time.
+The bytecode also tracks the properties that the function depends on and, when
+the function is deterministic (i.e. it does not use <random> nor <urandom>), it
+is only recomputed when at least one of these properties has changed. The
+compilation does not change the result of the function. It can be disabled by
+setting the environment variable JSBSIM_NO_BYTECODE in which case the tree of
+operations is evaluated directly, which can be useful for debugging.
+
 <h2>Specific Function Definitions</h2>
 
 Note: In the definitions below, a "property" refers to a single property
@@ -828,8 +838,11 @@ protected:
   bool cached;
   double cachedValue;
   std::vector <FGParameter_ptr> Parameters;
+  std::unique_ptr<FGBytecode> Bytecode; // Compiled version of Parameters
   std::shared_ptr<FGPropertyManager> PropertyManager;
   SGPropertyNode_ptr pNode;
+  std::string Operation; // Name of the XML element that defines the function
+  std::string Context;   // Location of that element for the error messages
 
   void Load(Element* element, FGPropertyValue* var, FGFDMExec* fdmex,
             const std::string& prefix="");
@@ -838,11 +851,14 @@ protected:
   void CheckMaxArguments(Element* el, unsigned int _max);
   void CheckOddOrEvenArguments(Element* el, OddEven odd_even);
   std::string CreateOutputNode(Element* el, const std::string& Prefix);
+  void Compile(void);
 
 private:
   std::string Name;
   SGPropertyNode_ptr pCopyTo; // Property node for CopyTo property string
 
+  void Compile(FGBytecode& code, const FGParameter* p, unsigned int reg) const;
+  void AddDependencies(FGBytecode& code, const FGParameter* p) const;
   void Debug(int from);
 };
 
@@ -23,7 +23,6 @@
 #include <iostream>
 #include <sstream>
 #include <stdexcept>
-#include <ctime>
 
 #include "FGNelderMead.h"
 #include "input_output/FGLog.h"
@@ -50,7 +49,6 @@ FGNelderMead::FGNelderMead(Function * f, const std::vector<double> & initialGues
         pause(pause), rtolI(), minCostPrevResize(1), minCost(), minCostPrev(), maxCost(),
         nextMaxCost()
 {
-    srand ( time(NULL) ); // seed random number generator
 }
 
 void FGNelderMead::update()
@@ -260,7 +258,9 @@ int FGNelderMead::status()
 
 double FGNelderMead::getRandomFactor()
 {
-    double randFact = 1+(float(rand() % 1000)/500-1)*m_randomization;
+    // Each instance owns its generator (seeded from the system clock) so that
+    // several trims can run concurrently without sharing the C library state.
+    double randFact = 1+m_generator.GetUniformRandomNumber()*m_randomization;
     //log << "random factor: " << randFact << "\n";
     return randFact;
 }
@@ -23,6 +23,8 @@
 #include <limits>
 #include <cstddef>
 
+#include "FGJSBBase.h"
+
 namespace JSBSim
 {
 
@@ -63,6 +65,7 @@ private:
     Function * m_f;
     Callback * m_callback;
     double m_randomization;
+    RandomNumberGenerator m_generator;
     const std::vector<double> & m_lowerBound;
     const std::vector<double> & m_upperBound;
     size_t m_nDim, m_nVert;
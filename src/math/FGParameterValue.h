@@ -89,7 +89,7 @@ public:
   bool IsConstant(void) const override { return param->IsConstant(); }
 
   std::string GetName(void) const override {
-    FGPropertyValue* v = dynamic_cast<FGPropertyValue*>(param.ptr());
+    const FGPropertyValue* v = GetProperty();
     if (v)
       return v->GetNameWithSign();
     else
@@ -97,9 +97,14 @@ public:
   }
 
   bool IsLateBound(void) const {
-    FGPropertyValue* v = dynamic_cast<FGPropertyValue*>(param.ptr());
+    const FGPropertyValue* v = GetProperty();
     return v != nullptr && v->IsLateBound();
   }
+
+  /// Returns the property or nullptr if the parameter is a real value.
+  const FGPropertyValue* GetProperty(void) const {
+    return dynamic_cast<const FGPropertyValue*>(param.ptr());
+  }
 private:
   FGParameter_ptr param;
 };
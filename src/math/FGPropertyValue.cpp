@@ -88,7 +88,9 @@ SGPropertyNode* FGPropertyValue::GetNode(void) const
 
 double FGPropertyValue::GetValue(void) const
 {
-  return GetNode()->getDoubleValue()*Sign;
+  SGPropertyNode* node = GetNode();
+  if (Handle.GetNode() != node) Handle.Bind(node);
+  return Handle.getDoubleValue()*Sign;
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -39,6 +39,7 @@ INCLUDES
 
 #include "FGParameter.h"
 #include "input_output/FGPropertyManager.h"
+#include "input_output/FGPropertyHandle.h"
 #include "input_output/FGXMLElement.h"
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -52,6 +53,8 @@ CLASS DOCUMENTATION
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
   /** Represents a property value which can use late binding.
+      Once the property is bound, its value is read through an FGPropertyHandle
+      which bypasses the generic dispatch of SGPropertyNode::getDoubleValue().
       @author Jon Berndt, Anders Gidenstam
   */
 
@@ -88,6 +91,7 @@ protected:
 private:
   std::shared_ptr<FGPropertyManager> PropertyManager; // Property root used to do late binding.
   mutable SGPropertyNode_ptr PropertyNode;
+  mutable FGPropertyHandle Handle;
   mutable Element_ptr XML_def;
   std::string PropertyName;
   double Sign;
@@ -29,6 +29,7 @@
   INCLUDES
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
+#include <algorithm>
 #include <cstdio>
 #include <iostream>
 #include <cmath>
@@ -223,4 +224,98 @@ double FGRKFehlberg::approximate(double x, double y)
   return y4_val;
 }
 
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS IMPLEMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+// Butcher tableau. The last row of A is the 5th order solution B, so the
+// derivatives of the last stage are evaluated at the end of the step.
+const double FGDormandPrince::A[7][6] = {
+  {  0.0 },
+  {  1.0/5.0 },
+  {  3.0/40.0,        9.0/40.0 },
+  { 44.0/45.0,      -56.0/15.0,       32.0/9.0 },
+  { 19372.0/6561.0, -25360.0/2187.0,  64448.0/6561.0, -212.0/729.0 },
+  { 9017.0/3168.0,    -355.0/33.0,    46732.0/5247.0,   49.0/176.0, -5103.0/18656.0 },
+  {   35.0/384.0,        0.0,           500.0/1113.0,  125.0/192.0, -2187.0/6784.0,  11.0/84.0 }
+};
+
+const double FGDormandPrince::C[] = { 0.0, 1.0/5.0, 3.0/10.0, 4.0/5.0, 8.0/9.0, 1.0, 1.0 };
+
+// Difference between the 5th and 4th order weights
+const double FGDormandPrince::E[] = { 71.0/57600.0, 0.0, -71.0/16695.0, 71.0/1920.0, -17253.0/339200.0, 22.0/525.0, -1.0/40.0 };
+
+int FGDormandPrince::evolve(double x, double x_end, std::vector<double>& y,
+                            std::vector<double>& dydx, FGRungeKuttaSystem* pf)
+{
+  const size_t n = y.size();
+  const double h_min = (x_end - x) / std::max(max_steps, 1);
+  bool last_rejected = false;
+
+  for (auto& ki: k) ki.resize(n);
+  ytmp.resize(n);
+  k[0] = dydx;
+
+  if (h <= 0.0) h = x_end - x;
+  steps = rejected = 0;
+
+  while (x < x_end) {
+    double step = h;
+    bool last = false;
+
+    if (x + step >= x_end) {
+      step = x_end - x;
+      last = true;
+    }
+
+    for (int s=1; s<7; s++) {
+      for (size_t i=0; i<n; i++) {
+        double as = 0.0;
+        for (int j=0; j<s; j++) as += A[s][j]*k[j][i];
+        ytmp[i] = y[i] + step*as;
+      }
+      pf->pFunc(x + C[s]*step, ytmp, k[s]);
+    }
+
+    double err = 0.0;
+    for (size_t i=0; i<n; i++) {
+      double e = 0.0;
+      for (int j=0; j<7; j++) e += E[j]*k[j][i];
+      double scale = tolerance*(1.0 + std::max(fabs(y[i]), fabs(ytmp[i])));
+      e *= step/scale;
+      err += e*e;
+    }
+    err = sqrt(err/std::max<size_t>(n, 1));
+
+    double factor = err > 0.0 ? 0.9*pow(err, -0.2) : 5.0;
+    factor = std::min(5.0, std::max(0.2, factor));
+
+    if (err <= 1.0 || step <= h_min) {
+      x = last ? x_end : x + step;
+      y.swap(ytmp);
+      k[0].swap(k[6]);
+      steps++;
+      pf->pAccept(x);
+
+      // Do not grow the step right after a rejection.
+      if (last_rejected) factor = std::min(factor, 1.0);
+      last_rejected = false;
+
+      // A step shortened to reach x_end does not tell much about the step
+      // size that suits the next call.
+      double proposal = step*factor;
+      h = last && step < h ? std::max(h, proposal) : proposal;
+    } else {
+      rejected++;
+      last_rejected = true;
+      h = step*factor;
+    }
+
+    h = std::max(h, h_min);
+  }
+
+  dydx = k[0];
+  return steps;
+}
+
 } // namespace JSBSim
@@ -38,6 +38,10 @@ SENTRY
 INCLUDES
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
+#include <vector>
+
+#include "JSBSim_API.h"
+
 namespace JSBSim {
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -176,6 +180,77 @@ class FGRKFehlberg : public FGRungeKutta {
 };
 
 
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+DECLARATION: FGRungeKuttaSystem
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/**
+   Abstract base for a system of ordinary differential equations.
+*/
+class JSBSIM_API FGRungeKuttaSystem {
+  public:
+    virtual ~FGRungeKuttaSystem() {}
+    /// Computes the derivatives dydx of the state y at x.
+    virtual void pFunc(double x, const std::vector<double>& y,
+                       std::vector<double>& dydx) = 0;
+    /// Called each time a step ending at x has been accepted.
+    virtual void pAccept(double x) {}
+};
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+DECLARATION: FGDormandPrince
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/**
+   Dormand-Prince 5(4) method with step size control.
+   The difference between the 5th order solution and the embedded 4th order
+   solution is used as an estimate of the local error. A step is accepted
+   when the RMS of the error scaled by tolerance*(1+|y|) does not exceed 1
+   and the next step size is predicted from that estimate. The last step
+   proposed is kept as the initial guess of the next call to evolve().
+
+   The derivatives at the end of an accepted step are the derivatives at the
+   start of the next one (First Same As Last) so a step costs 6 evaluations
+   of the system.
+*/
+
+class JSBSIM_API FGDormandPrince {
+
+  public:
+    FGDormandPrince() : tolerance(1e-6), max_steps(1000), h(0.0), steps(0),
+                        rejected(0) {};
+
+    /** Integrates the system from x to x_end.
+        @param y the state at x on input, at x_end on output.
+        @param dydx the derivatives at x on input, at x_end on output.
+        @return the number of accepted steps. */
+    int evolve(double x, double x_end, std::vector<double>& y,
+               std::vector<double>& dydx, FGRungeKuttaSystem* pf);
+
+    double getTolerance() const     { return tolerance; }
+    int    getMaxSteps() const      { return max_steps; }
+    double getStepSize() const      { return h; }
+    int    getSteps() const         { return steps; }
+    int    getRejected() const      { return rejected; }
+    void   setTolerance(double tol) { tolerance = tol; }
+    /// The steps are never shorter than (x_end-x)/max_steps.
+    void   setMaxSteps(int n)       { max_steps = n; }
+    void   setStepSize(double dx)   { h = dx; }
+
+  private:
+    double tolerance;
+    int    max_steps;
+    double h;
+    int    steps;
+    int    rejected;
+
+    std::vector<double> k[7];
+    std::vector<double> ytmp;
+
+    static const double A[7][6], C[7], E[7];
+};
+
+
 } // namespace JSBSim
 
 #endif
@@ -18,13 +18,24 @@
 
 #include "initialization/FGInitialCondition.h"
 #include "FGStateSpace.h"
+#include <algorithm>
+#include <atomic>
+#include <exception>
 #include <limits>
 #include <iomanip>
+#include <map>
 #include <string>
+#include <thread>
 
 namespace JSBSim
 {
 
+void FGStateSpace::setThreads(unsigned int threads)
+{
+    if (threads == 0) threads = std::thread::hardware_concurrency();
+    m_threads = std::max(threads, 1U);
+}
+
 void FGStateSpace::linearize(
     std::vector<double> x0,
     std::vector<double> u0,
@@ -37,79 +48,164 @@ void FGStateSpace::linearize(
     double h = 1e-4;
 
     // A, d(x)/dx
-    numericalJacobian(A,x,x,x0,x0,h,true);
+    numericalJacobian(A,&FGStateSpace::x,&FGStateSpace::x,x0,x0,h,true);
     // B, d(x)/du
-    numericalJacobian(B,x,u,x0,u0,h,true);
+    numericalJacobian(B,&FGStateSpace::x,&FGStateSpace::u,x0,u0,h,true);
     // C, d(y)/dx
-    numericalJacobian(C,y,x,y0,x0,h);
+    numericalJacobian(C,&FGStateSpace::y,&FGStateSpace::x,y0,x0,h);
     // D, d(y)/du
-    numericalJacobian(D,y,u,y0,u0,h);
+    numericalJacobian(D,&FGStateSpace::y,&FGStateSpace::u,y0,u0,h);
 
 }
 
-void FGStateSpace::numericalJacobian(std::vector< std::vector<double> >  & J, ComponentVector & y,
-                                     ComponentVector & x, const std::vector<double> & y0, const std::vector<double> & x0, double h, bool computeYDerivative)
+std::unique_ptr<FGStateSpace> FGStateSpace::clone(FGFDMExec * fdm) const
 {
-    size_t nX = x.getSize();
-    size_t nY = y.getSize();
-    double f1 = 0, f2 = 0, fn1 = 0, fn2 = 0;
-    J.resize(nY);
-    for (unsigned int iY=0;iY<nY;iY++)
+    auto ss = std::make_unique<FGStateSpace>(fdm);
+    // the components shared by several vectors (y = x) remain shared
+    std::map<const Component *, Component *> copies;
+
+    auto copy = [&](const ComponentVector & from, ComponentVector & to) {
+        for (unsigned int i=0;i<from.getSize();i++)
+        {
+            const Component * comp = from.getComp(i);
+            auto it = copies.find(comp);
+            if (it == copies.end())
+            {
+                Component * compCopy = comp->clone();
+                if (!compCopy) return false;
+                ss->m_clonedComponents.emplace_back(compCopy);
+                it = copies.emplace(comp, compCopy).first;
+            }
+            to.add(it->second);
+        }
+        return true;
+    };
+
+    if (!copy(x, ss->x) || !copy(u, ss->u) || !copy(y, ss->y)) return nullptr;
+    return ss;
+}
+
+void FGStateSpace::numericalJacobian(std::vector< std::vector<double> >  & J, ComponentVector FGStateSpace::* y,
+                                     ComponentVector FGStateSpace::* x, const std::vector<double> & y0, const std::vector<double> & x0, double h, bool computeYDerivative)
+{
+    size_t nX = (this->*x).getSize();
+    size_t nY = (this->*y).getSize();
+    J.assign(nY, std::vector<double>(nX));
+
+    // all the perturbations start from the state reached at x0 so that the
+    // columns do not depend on the order in which they are computed
+    (this->*x).set(x0);
+    std::string state = m_fdm->SaveState();
+
+    // each thread computes its columns on its own clone of the executive
+    size_t nThreads = std::min<size_t>(m_threads, nX);
+    std::vector< std::unique_ptr<FGFDMExec> > fdms;
+    std::vector< std::unique_ptr<FGStateSpace> > spaces;
+
+    if (nThreads > 1)
     {
-        J[iY].resize(nX);
-        for (unsigned int iX=0;iX<nX;iX++)
+        for (size_t i=0;i<nThreads;i++)
         {
-            x.set(x0);
-            x.set(iX,x.get(iX)+h);
-            if (computeYDerivative) f1 = y.getDeriv(iY);
-            else f1 = y.get(iY);
-
-            x.set(x0);
-            x.set(iX,x.get(iX)+2*h);
-            if (computeYDerivative) f2 = y.getDeriv(iY);
-            else f2 = y.get(iY);
-
-            x.set(x0);
-            x.set(iX,x.get(iX)-h);
-            if (computeYDerivative) fn1 = y.getDeriv(iY);
-            else fn1 = y.get(iY);
-
-            x.set(x0);
-            x.set(iX,x.get(iX)-2*h);
-            if (computeYDerivative) fn2 = y.getDeriv(iY);
-            else fn2 = y.get(iY);
-
-			double diff1 = f1-fn1;
-			double diff2 = f2-fn2;
-
-			// correct for angle wrap
-			if (x.getComp(iX)->getUnit().compare("rad") == 0) {
-				while(diff1 > M_PI) diff1 -= 2*M_PI;
-				if(diff1 < -M_PI) diff1 += 2*M_PI;
-				if(diff2 > M_PI) diff2 -= 2*M_PI;
-				if(diff2 < -M_PI) diff2 += 2*M_PI;
-			} else if (x.getComp(iX)->getUnit().compare("deg") == 0) {
-				if(diff1 > 180) diff1 -= 360;
-				if(diff1 < -180) diff1 += 360;
-				if(diff2 > 180) diff2 -= 360;
-				if(diff2 < -180) diff2 += 360;
-			}
-            J[iY][iX] = (8*diff1-diff2)/(12*h); // 3rd order taylor approx from lewis, pg 203
-
-            x.set(x0);
-
-            if (m_fdm->GetDebugLevel() > 1)
+            fdms.push_back(m_fdm->Clone());
+            spaces.push_back(clone(fdms.back().get()));
+            if (!spaces.back())
             {
-                FGLogging log(LogLevel::DEBUG);
-                log << std::scientific << "\ty:\t" << y.getName(iY) << "\tx:\t"
-                    << x.getName(iX)
-                    << "\tfn2:\t" << fn2 << "\tfn1:\t" << fn1
-                    << "\tf1:\t" << f1 << "\tf2:\t" << f2
-                    << "\tf1-fn1:\t" << f1-fn1
-                    << "\tf2-fn2:\t" << f2-fn2
-                    << "\tdf/dx:\t" << J[iY][iX]
-                    << std::fixed << "\n";
+                spaces.clear();
+                break;
+            }
+        }
+    }
+
+    if (spaces.empty())
+    {
+        for (unsigned int iX=0;iX<nX;iX++)
+            jacobianColumn(J,this->*y,this->*x,state,h,computeYDerivative,iX);
+        m_fdm->RestoreState(state);
+        return;
+    }
+
+    std::atomic<unsigned int> next(0);
+    std::vector<std::exception_ptr> errors(nThreads);
+    FGLogger_ptr logger = GetLogger();
+    std::vector<std::thread> pool;
+
+    for (size_t i=0;i<nThreads;i++)
+    {
+        pool.emplace_back([&, i]() {
+            SetLogger(logger);
+            FGStateSpace & ss = *spaces[i];
+            try {
+                for (unsigned int iX=next++;iX<nX;iX=next++)
+                    ss.jacobianColumn(J,ss.*y,ss.*x,state,h,computeYDerivative,iX);
+            } catch (...) {
+                errors[i] = std::current_exception();
             }
+        });
+    }
+
+    for (auto & t : pool) t.join();
+
+    for (auto & error : errors)
+        if (error) std::rethrow_exception(error);
+}
+
+void FGStateSpace::jacobianColumn(std::vector< std::vector<double> > & J, ComponentVector & y,
+                                  ComponentVector & x, const std::string & state, double h,
+                                  bool computeYDerivative, unsigned int iX)
+{
+    size_t nY = y.getSize();
+    std::vector<double> f1(nY), f2(nY), fn1(nY), fn2(nY);
+
+    // each perturbation of x evaluates all the outputs: the perturbed state is
+    // restored before each output since the evaluation of a derivative may run
+    // the model
+    auto evaluate = [&](double dx, std::vector<double> & f) {
+        m_fdm->RestoreState(state);
+        x.set(iX,x.get(iX)+dx);
+        std::string perturbed = m_fdm->SaveState();
+        for (unsigned int iY=0;iY<nY;iY++)
+        {
+            if (iY > 0) m_fdm->RestoreState(perturbed);
+            if (computeYDerivative) f[iY] = y.getDeriv(iY);
+            else f[iY] = y.get(iY);
+        }
+    };
+
+    evaluate(h,f1);
+    evaluate(2*h,f2);
+    evaluate(-h,fn1);
+    evaluate(-2*h,fn2);
+
+    for (unsigned int iY=0;iY<nY;iY++)
+    {
+        double diff1 = f1[iY]-fn1[iY];
+        double diff2 = f2[iY]-fn2[iY];
+
+        // correct for angle wrap
+        if (x.getComp(iX)->getUnit().compare("rad") == 0) {
+            while(diff1 > M_PI) diff1 -= 2*M_PI;
+            if(diff1 < -M_PI) diff1 += 2*M_PI;
+            if(diff2 > M_PI) diff2 -= 2*M_PI;
+            if(diff2 < -M_PI) diff2 += 2*M_PI;
+        } else if (x.getComp(iX)->getUnit().compare("deg") == 0) {
+            if(diff1 > 180) diff1 -= 360;
+            if(diff1 < -180) diff1 += 360;
+            if(diff2 > 180) diff2 -= 360;
+            if(diff2 < -180) diff2 += 360;
+        }
+        J[iY][iX] = (8*diff1-diff2)/(12*h); // 3rd order taylor approx from lewis, pg 203
+
+        if (m_fdm->GetDebugLevel() > 1)
+        {
+            FGLogging log(LogLevel::DEBUG);
+            log << std::scientific << "\ty:\t" << y.getName(iY) << "\tx:\t"
+                << x.getName(iX)
+                << "\tfn2:\t" << fn2[iY] << "\tfn1:\t" << fn1[iY]
+                << "\tf1:\t" << f1[iY] << "\tf2:\t" << f2[iY]
+                << "\tf1-fn1:\t" << f1[iY]-fn1[iY]
+                << "\tf2-fn2:\t" << f2[iY]-fn2[iY]
+                << "\tdf/dx:\t" << J[iY][iX]
+                << std::fixed << "\n";
         }
     }
 }
@@ -31,6 +31,7 @@
 #include <fstream>
 #include <iostream>
 #include <limits>
+#include <memory>
 
 namespace JSBSim
 {
@@ -52,6 +53,9 @@ public:
         virtual ~Component() {};
         virtual double get() const = 0;
         virtual void set(double val) = 0;
+        // returns a copy of the component, or nullptr if it cannot be copied
+        // in which case the jacobians are computed on a single thread
+        virtual Component * clone() const { return nullptr; }
         virtual double getDeriv() const
         {
             // by default should calculate using finite difference approx
@@ -216,10 +220,16 @@ public:
     ComponentVector x, u, y;
 
     // constructor
-    FGStateSpace(FGFDMExec * fdm) : x(fdm,this), u(fdm,this), y(fdm,this), m_fdm(fdm) {};
+    FGStateSpace(FGFDMExec * fdm) : x(fdm,this), u(fdm,this), y(fdm,this), m_fdm(fdm), m_threads(1) {};
 
     void setFdm(FGFDMExec * fdm) { m_fdm = fdm; }
 
+    // number of threads used to compute the columns of the jacobians, each
+    // thread working on a clone of the executive (0 selects the hardware
+    // concurrency)
+    void setThreads(unsigned int threads);
+    unsigned int getThreads() const { return m_threads; }
+
     void run() {
         // initialize
         m_fdm->Initialize(m_fdm->GetIC().get());
@@ -288,13 +298,27 @@ public:
 private:
 
     // compute numerical jacobian of a matrix
-    void numericalJacobian(std::vector< std::vector<double> > & J, ComponentVector & y,
-                           ComponentVector & x, const std::vector<double> & y0,
+    void numericalJacobian(std::vector< std::vector<double> > & J, ComponentVector FGStateSpace::* y,
+                           ComponentVector FGStateSpace::* x, const std::vector<double> & y0,
                            const std::vector<double> & x0, double h=1e-5, bool computeYDerivative = false);
 
+    // compute the column iX of a numerical jacobian, the perturbations being
+    // applied to the simulation state saved in state
+    void jacobianColumn(std::vector< std::vector<double> > & J, ComponentVector & y,
+                        ComponentVector & x, const std::string & state, double h,
+                        bool computeYDerivative, unsigned int iX);
+
+    // copy of the state space working on another executive
+    std::unique_ptr<FGStateSpace> clone(FGFDMExec * fdm) const;
+
     // flight dynamcis model
     FGFDMExec * m_fdm;
 
+    unsigned int m_threads;
+
+    // components allocated by clone()
+    std::vector< std::unique_ptr<Component> > m_clonedComponents;
+
 public:
 
     // components
@@ -303,6 +327,7 @@ public:
     {
     public:
         Vt() : Component("Vt","ft/s") {};
+        Component* clone() const { return new Vt(*this); }
         double get() const
         {
             return m_fdm->GetAuxiliary()->GetVt();
@@ -326,6 +351,7 @@ public:
     {
     public:
         VGround() : Component("VGround","ft/s") {};
+        Component* clone() const { return new VGround(*this); }
         double get() const
         {
             return m_fdm->GetAuxiliary()->GetVground();
@@ -340,6 +366,7 @@ public:
     {
     public:
         AccelX() : Component("AccelX","ft/s^2") {};
+        Component* clone() const { return new AccelX(*this); }
         double get() const
         {
             return m_fdm->GetAuxiliary()->GetPilotAccel(1);
@@ -354,6 +381,7 @@ public:
     {
     public:
         AccelY() : Component("AccelY","ft/s^2") {};
+        Component* clone() const { return new AccelY(*this); }
         double get() const
         {
             return m_fdm->GetAuxiliary()->GetPilotAccel(2);
@@ -368,6 +396,7 @@ public:
     {
     public:
         AccelZ() : Component("AccelZ","ft/s^2") {};
+        Component* clone() const { return new AccelZ(*this); }
         double get() const
         {
             return m_fdm->GetAuxiliary()->GetPilotAccel(3);
@@ -382,6 +411,7 @@ public:
     {
     public:
         Alpha() : Component("Alpha","rad") {};
+        Component* clone() const { return new Alpha(*this); }
         double get() const
         {
             return m_fdm->GetAuxiliary()->Getalpha();
@@ -406,6 +436,7 @@ public:
     {
     public:
         Theta() : Component("Theta","rad") {};
+        Component* clone() const { return new Theta(*this); }
         double get() const
         {
             return m_fdm->GetPropagate()->GetEuler(2);
@@ -425,6 +456,7 @@ public:
     {
     public:
         Q() : Component("Q","rad/s") {};
+        Component* clone() const { return new Q(*this); }
         double get() const
         {
             return m_fdm->GetPropagate()->GetPQR(2);
@@ -443,6 +475,7 @@ public:
     {
     public:
         Alt() : Component("Alt","ft") {};
+        Component* clone() const { return new Alt(*this); }
         double get() const
         {
             return m_fdm->GetPropagate()->GetAltitudeASL();
@@ -461,6 +494,7 @@ public:
     {
     public:
         Beta() : Component("Beta","rad") {};
+        Component* clone() const { return new Beta(*this); }
         double get() const
         {
             return m_fdm->GetAuxiliary()->Getbeta();
@@ -481,6 +515,7 @@ public:
     {
     public:
         Phi() : Component("Phi","rad") {};
+        Component* clone() const { return new Phi(*this); }
         double get() const
         {
             return m_fdm->GetPropagate()->GetEuler(1);
@@ -499,6 +534,7 @@ public:
     {
     public:
         P() : Component("P","rad/s") {};
+        Component* clone() const { return new P(*this); }
         double get() const
         {
             return m_fdm->GetPropagate()->GetPQR(1);
@@ -517,6 +553,7 @@ public:
     {
     public:
         R() : Component("R","rad/s") {};
+        Component* clone() const { return new R(*this); }
         double get() const
         {
             return m_fdm->GetPropagate()->GetPQR(3);
@@ -535,6 +572,7 @@ public:
     {
     public:
         Psi() : Component("Psi","rad") {};
+        Component* clone() const { return new Psi(*this); }
         double get() const
         {
             return m_fdm->GetPropagate()->GetEuler(3);
@@ -553,6 +591,7 @@ public:
     {
     public:
         ThrottleCmd() : Component("ThtlCmd","norm") {};
+        Component* clone() const { return new ThrottleCmd(*this); }
         double get() const
         {
             return m_fdm->GetFCS()->GetThrottleCmd(0);
@@ -569,6 +608,7 @@ public:
     {
     public:
         ThrottlePos() : Component("ThtlPos","norm") {};
+        Component* clone() const { return new ThrottlePos(*this); }
         double get() const
         {
             return m_fdm->GetFCS()->GetThrottlePos(0);
@@ -584,6 +624,7 @@ public:
     {
     public:
         DaCmd() : Component("DaCmd","norm") {};
+        Component* clone() const { return new DaCmd(*this); }
         double get() const
         {
             return m_fdm->GetFCS()->GetDaCmd();
@@ -599,6 +640,7 @@ public:
     {
     public:
         DaPos() : Component("DaPos","norm") {};
+        Component* clone() const { return new DaPos(*this); }
         double get() const
         {
             return m_fdm->GetFCS()->GetDaLPos();
@@ -614,6 +656,7 @@ public:
     {
     public:
         DeCmd() : Component("DeCmd","norm") {};
+        Component* clone() const { return new DeCmd(*this); }
         double get() const
         {
             return m_fdm->GetFCS()->GetDeCmd();
@@ -629,6 +672,7 @@ public:
     {
     public:
         DePos() : Component("DePos","norm") {};
+        Component* clone() const { return new DePos(*this); }
         double get() const
         {
             return m_fdm->GetFCS()->GetDePos();
@@ -643,6 +687,7 @@ public:
     {
     public:
         DrCmd() : Component("DrCmd","norm") {};
+        Component* clone() const { return new DrCmd(*this); }
         double get() const
         {
             return m_fdm->GetFCS()->GetDrCmd();
@@ -658,6 +703,7 @@ public:
     {
     public:
         DrPos() : Component("DrPos","norm") {};
+        Component* clone() const { return new DrPos(*this); }
         double get() const
         {
             return m_fdm->GetFCS()->GetDrPos();
@@ -672,6 +718,7 @@ public:
     {
     public:
         Rpm0() : Component("Rpm0","rev/min") {};
+        Component* clone() const { return new Rpm0(*this); }
         double get() const
         {
             return m_fdm->GetPropulsion()->GetEngine(0)->GetThruster()->GetRPM();
@@ -686,6 +733,7 @@ public:
     {
     public:
         Rpm1() : Component("Rpm1","rev/min") {};
+        Component* clone() const { return new Rpm1(*this); }
         double get() const
         {
             return m_fdm->GetPropulsion()->GetEngine(1)->GetThruster()->GetRPM();
@@ -700,6 +748,7 @@ public:
     {
     public:
         Rpm2() : Component("Rpm2","rev/min") {};
+        Component* clone() const { return new Rpm2(*this); }
         double get() const
         {
             return m_fdm->GetPropulsion()->GetEngine(2)->GetThruster()->GetRPM();
@@ -714,6 +763,7 @@ public:
     {
     public:
         Rpm3() : Component("Rpm3","rev/min") {};
+        Component* clone() const { return new Rpm3(*this); }
         double get() const
         {
             return m_fdm->GetPropulsion()->GetEngine(3)->GetThruster()->GetRPM();
@@ -728,6 +778,7 @@ public:
     {
     public:
         PropPitch() : Component("Prop Pitch","deg") {};
+        Component* clone() const { return new PropPitch(*this); }
         double get() const
         {
             return m_fdm->GetPropulsion()->GetEngine(0)->GetThruster()->GetPitch();
@@ -743,6 +794,7 @@ public:
     {
     public:
         Longitude() : Component("Longitude","rad") {};
+        Component* clone() const { return new Longitude(*this); }
         double get() const
         {
             return m_fdm->GetPropagate()->GetLongitude();
@@ -761,6 +813,7 @@ public:
     {
     public:
         Latitude() : Component("Latitude","rad") {};
+        Component* clone() const { return new Latitude(*this); }
         double get() const
         {
             return m_fdm->GetPropagate()->GetLatitude();
@@ -779,6 +832,7 @@ public:
     {
     public:
         Pi() : Component("P inertial","rad/s") {};
+        Component* clone() const { return new Pi(*this); }
         double get() const
         {
             return m_fdm->GetPropagate()->GetPQRi(1);
@@ -800,6 +854,7 @@ public:
     {
     public:
         Qi() : Component("Q inertial","rad/s") {};
+        Component* clone() const { return new Qi(*this); }
         double get() const
         {
             return m_fdm->GetPropagate()->GetPQRi(2);
@@ -821,6 +876,7 @@ public:
     {
     public:
         Ri() : Component("R inertial","rad/s") {};
+        Component* clone() const { return new Ri(*this); }
         double get() const
         {
             return m_fdm->GetPropagate()->GetPQRi(3);
@@ -842,6 +898,7 @@ public:
     {
     public:
         Vn() : Component("Vel north","feet/s") {};
+        Component* clone() const { return new Vn(*this); }
         double get() const
         {
             return m_fdm->GetPropagate()->GetVel(1);
@@ -861,6 +918,7 @@ public:
     {
     public:
         Ve() : Component("Vel east","feet/s") {};
+        Component* clone() const { return new Ve(*this); }
         double get() const
         {
             return m_fdm->GetPropagate()->GetVel(2);
@@ -880,6 +938,7 @@ public:
     {
     public:
         Vd() : Component("Vel down","feet/s") {};
+        Component* clone() const { return new Vd(*this); }
         double get() const
         {
             return m_fdm->GetPropagate()->GetVel(3);
@@ -899,6 +958,7 @@ public:
     {
     public:
         COG() : Component("Course Over Ground","rad") {};
+        Component* clone() const { return new COG(*this); }
         double get() const
         {
             //cog = atan2(Ve,Vn)
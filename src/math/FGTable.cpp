@@ -38,6 +38,8 @@ INCLUDES
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
 #include <assert.h>
+#include <cmath>
+#include <cstring>
 #include <limits>
 #include <optional>
 
@@ -178,17 +180,19 @@ string LookupAxisName(unsigned int axis)
   return "axis" + std::to_string(axis + 1u);
 }
 
-void AppendNumericData(Element* tableData, stringstream& buf)
+void AppendNumericData(Element* tableData, vector<double>& data)
 {
   for (unsigned int i=0; i<tableData->GetNumDataLines(); ++i) {
-    const string line = tableData->GetDataLine(i);
-    if (line.find_first_not_of("0123456789.-+eE \t\n") != string::npos) {
+    const string& line = tableData->GetDataLine(i);
+    try {
+      read_numbers_locale_c(line, data);
+    } catch (InvalidNumber& e) {
       XMLLogException err(tableData);
-      err << "   Illegal character found in line "
-          << tableData->GetLineNumber() + i + 1 << ": \n" << line << "\n";
+      err << "   Illegal number found in line "
+          << tableData->GetLineNumber() + i + 1 << ": \n" << line << "\n"
+          << e.what() << "\n";
       throw err;
     }
-    buf << line << " ";
   }
 }
 
@@ -202,6 +206,7 @@ FGTable::FGTable(int NRows)
   : nRows(NRows), nCols(1u), nDims(1u)
 {
   Type = tt1D;
+  lookupPropertyValues.resize(nDims);
   // Fill unused elements with NaNs to detect illegal access.
   Data.push_back(std::numeric_limits<double>::quiet_NaN());
   Data.push_back(std::numeric_limits<double>::quiet_NaN());
@@ -214,6 +219,7 @@ FGTable::FGTable(int NRows, int NCols)
   : nRows(NRows), nCols(NCols), nDims(2u)
 {
   Type = tt2D;
+  lookupPropertyValues.resize(nDims);
   // Fill unused elements with NaNs to detect illegal access.
   Data.push_back(std::numeric_limits<double>::quiet_NaN());
   Debug(0);
@@ -231,6 +237,8 @@ FGTable::FGTable(const FGTable& t)
   internal = t.internal;
   Name = t.Name;
   lookupProperty = t.lookupProperty;
+  rowBreakpoints = t.rowBreakpoints;
+  colBreakpoints = t.colBreakpoints;
 
   // Deep copy of t.Tables
   Tables.reserve(t.Tables.size());
@@ -382,9 +390,6 @@ FGTable::FGTable(std::shared_ptr<FGPropertyManager> pm, Element* el,
   }
 
   if (leafData) {
-    stringstream buf;
-    AppendNumericData(leafData, buf);
-
     nDims = InferLeafDimension(leafData);
 
     switch (nDims) {
@@ -395,7 +400,8 @@ FGTable::FGTable(std::shared_ptr<FGPropertyManager> pm, Element* el,
       // Fill unused elements with NaNs to detect illegal access.
       Data.push_back(std::numeric_limits<double>::quiet_NaN());
       Data.push_back(std::numeric_limits<double>::quiet_NaN());
-      *this << buf;
+      Data.reserve(Data.size() + 2*nRows);
+      AppendNumericData(leafData, Data);
       break;
     case 2u:
       nRows = leafData->GetNumDataLines()-1u;
@@ -403,7 +409,8 @@ FGTable::FGTable(std::shared_ptr<FGPropertyManager> pm, Element* el,
       Type = tt2D;
       // Fill unused elements with NaNs to detect illegal access.
       Data.push_back(std::numeric_limits<double>::quiet_NaN());
-      *this << buf;
+      Data.reserve(Data.size() + (nRows+1)*(nCols+1) - 1);
+      AppendNumericData(leafData, Data);
       break;
     default:
       UNREACHABLE("invalid table type") // Should never be called
@@ -494,6 +501,16 @@ FGTable::FGTable(std::shared_ptr<FGPropertyManager> pm, Element* el,
     break;
   }
 
+  // Check if the lookups can use uniformly spaced breakpoints.
+  if (Type == tt1D)
+    SetUniformSpacing(rowBreakpoints, 2u, nRows);
+  else if (Type == tt2D) {
+    SetUniformSpacing(rowBreakpoints, nCols+1u, nRows);
+    SetUniformSpacing(colBreakpoints, 1u, nCols);
+  }
+  else
+    SetUniformSpacing(rowBreakpoints, 1u, nRows);
+
   lookupPropertyValues.resize(nDims);
 
   bind(el, Prefix);
@@ -518,6 +535,81 @@ void FGTable::missingData(Element* el, unsigned int expected_size, size_t actual
   throw err;
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// The breakpoints of an axis are stored in Data[stride], Data[2*stride], ...,
+// Data[n*stride]. If they are uniformly spaced, the interval that contains a
+// key can be computed directly instead of being searched.
+
+void FGTable::SetUniformSpacing(Breakpoints& axis, unsigned int stride,
+                                unsigned int n)
+{
+  axis.invSpacing = 0.0;
+  if (n < 3u) return;
+
+  const double x1 = Data[stride];
+  const double spacing = (Data[n*stride] - x1) / (n-1);
+
+  for (unsigned int i=2; i<n; ++i) {
+    if (fabs(Data[i*stride] - (x1 + (i-1)*spacing)) > 1E-9*spacing)
+      return;
+  }
+
+  axis.invSpacing = 1.0 / spacing;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Returns the index i of the first breakpoint in [2, n] which is not lower
+// than key (or n if there are none) so that key belongs to the interval
+// ]Data[(i-1)*stride], Data[i*stride]]. The result is the same as a linear
+// search from the index 2 but the interval of the previous lookup is checked
+// first, then the intervals next to it and the binary search is only used as
+// a last resort.
+
+unsigned int FGTable::FindBreakpoint(const Breakpoints& axis, double key,
+                                     unsigned int stride, unsigned int n) const
+{
+  assert(n >= 2u);
+  const double* x = Data.data();
+  auto isBracket = [x, key, stride, n](unsigned int i)->bool {
+                     return (i == 2u || x[(i-1)*stride] < key)
+                       && (i == n || !(x[i*stride] < key));
+                   };
+
+  unsigned int i = axis.last;
+
+  if (axis.invSpacing > 0.0) {
+    double t = (key - x[stride]) * axis.invSpacing;
+    if (!(t > 0.0))
+      i = 2u;
+    else if (t >= n-1)
+      i = n;
+    else
+      i = static_cast<unsigned int>(ceil(t)) + 1u;
+  }
+
+  if (i > n || !isBracket(i)) {
+    if (i < n && isBracket(i+1))
+      ++i;
+    else if (i > 2u && i <= n && isBracket(i-1))
+      --i;
+    else {
+      // Binary search
+      unsigned int lo = 2u, hi = n;
+      while (lo < hi) {
+        unsigned int mid = (lo + hi) / 2u;
+        if (x[mid*stride] < key)
+          lo = mid + 1u;
+        else
+          hi = mid;
+      }
+      i = lo;
+    }
+  }
+
+  axis.last = i;
+  return i;
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
 FGTable::~FGTable()
@@ -553,25 +645,28 @@ double FGTable::GetValue(void) const
 {
   assert(!internal);
   assert(nDims > 0u);
-
-  switch(Type) {
-  case tt1D:
-    return GetValue(lookupProperty[eRow]->getDoubleValue());
-  case tt2D:
-    return GetValue(lookupProperty[eRow]->getDoubleValue(),
-                    lookupProperty[eColumn]->getDoubleValue());
-  case ttND:
-  {
-    for (unsigned int axis=0u; axis<nDims; ++axis) {
-      assert(HasLookupProperty(axis));
-      lookupPropertyValues[axis] = lookupProperty[axis]->getDoubleValue();
+  assert(lookupPropertyValues.size() == nDims);
+
+  // The table is only interpolated if one of the keys has changed since the
+  // previous call. The keys are compared bitwise so that 0.0 and -0.0 are
+  // distinguished and so that a NaN is equal to itself.
+  bool changed = !lastValueValid;
+
+  for (unsigned int axis=0u; axis<nDims; ++axis) {
+    assert(HasLookupProperty(axis));
+    double key = lookupProperty[axis]->getDoubleValue();
+    if (memcmp(&key, &lookupPropertyValues[axis], sizeof(double)) != 0) {
+      lookupPropertyValues[axis] = key;
+      changed = true;
     }
-
-    return GetValue(lookupPropertyValues.data());
   }
-  default:
-    UNREACHABLE("invalid table type") // Should never be called
+
+  if (changed) {
+    lastValue = GetValue(lookupPropertyValues.data());
+    lastValueValid = true;
   }
+
+  return lastValue;
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -610,10 +705,7 @@ double FGTable::GetValue(const double* keys) const
   else if (outerKey >= Data[nRows])
     return Tables[nRows-1]->GetValue(keys);
 
-  // Search for the right breakpoint.
-  // This is a linear search, the algorithm is O(n).
-  unsigned int r = 2u;
-  while (Data[r] < outerKey) r++;
+  unsigned int r = FindBreakpoint(rowBreakpoints, outerKey, 1u, nRows);
 
   double x0 = Data[r-1u];
   double Span = Data[r] - x0;
@@ -638,10 +730,7 @@ double FGTable::GetValue(double key) const
   else if (key >= Data[2*nRows])
     return Data[2*nRows+1];
 
-  // Search for the right breakpoint.
-  // This is a linear search, the algorithm is O(n).
-  unsigned int r = 2;
-  while (Data[2*r] < key) r++;
+  unsigned int r = FindBreakpoint(rowBreakpoints, key, 2u, nRows);
 
   double x0 = Data[2*r-2];
   double Span = Data[2*r] - x0;
@@ -662,8 +751,7 @@ double FGTable::GetValue(double rowKey, double colKey) const
 
   if (nCols == 1) return GetValue(rowKey);
 
-  unsigned int c = 2;
-  while(Data[c] < colKey && c < nCols) c++;
+  unsigned int c = FindBreakpoint(colBreakpoints, colKey, 1u, nCols);
   double x0 = Data[c-1];
   double Span = Data[c] - x0;
   assert(Span > 0.0);
@@ -674,8 +762,7 @@ double FGTable::GetValue(double rowKey, double colKey) const
     return cFactor*(Data[(nCols+1)+c] - y0) + y0;
   }
 
-  size_t r = 2;
-  while(Data[r*(nCols+1)] < rowKey && r < nRows) r++;
+  size_t r = FindBreakpoint(rowBreakpoints, rowKey, nCols+1u, nRows);
   x0 = Data[(r-1)*(nCols+1)];
   Span = Data[r*(nCols+1)] - x0;
   assert(Span > 0.0);
@@ -750,6 +837,8 @@ void FGTable::operator<<(istream& in_stream)
     Data.push_back(x);
     in_stream >> x;
   }
+
+  lastValueValid = false;
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -758,6 +847,7 @@ FGTable& FGTable::operator<<(const double x)
 {
   assert(Type != ttND);
   Data.push_back(x);
+  lastValueValid = false;
 
   // Check column is monotically increasing
   size_t n = Data.size();
@@ -411,6 +411,10 @@ public:
 
   unsigned int GetNumRows() const {return nRows;}
 
+  /// Returns the properties used to look up the table (may contain nulls).
+  const std::vector<FGPropertyValue_ptr>& GetLookupProperties(void) const
+  { return lookupProperty; }
+
   void Print();
   void Print(FGLogging& out);
 
@@ -423,11 +427,22 @@ private:
   std::shared_ptr<FGPropertyManager> PropertyManager; // Property root used to do late binding.
   std::vector<FGPropertyValue_ptr> lookupProperty;
   mutable std::vector<double> lookupPropertyValues;
+  mutable double lastValue = 0.0; // Result of the last property driven lookup
+  mutable bool lastValueValid = false;
   std::vector<double> Data;
   std::vector<std::unique_ptr<FGTable>> Tables;
   unsigned int nRows = 0u, nCols = 0u, nDims = 0u;
   std::string Name;
 
+  // Lookup state of an axis (rows or columns) of the table. The interval
+  // found by the previous lookup is remembered since the key seldom moves by
+  // more than one breakpoint between two successive calls.
+  struct Breakpoints {
+    double invSpacing = 0.0; // Inverse of the spacing of uniform breakpoints
+    mutable unsigned int last = 2u; // Upper bound of the last interval found
+  };
+  Breakpoints rowBreakpoints, colBreakpoints;
+
   void SetLookupProperty(unsigned int axis, FGPropertyValue_ptr node)
   {
     if (lookupProperty.size() <= axis) lookupProperty.resize(axis + 1u);
@@ -440,6 +455,10 @@ private:
   }
 
   double GetValue(const double* keys) const;
+  unsigned int FindBreakpoint(const Breakpoints& axis, double key,
+                              unsigned int stride, unsigned int n) const;
+  void SetUniformSpacing(Breakpoints& axis, unsigned int stride,
+                         unsigned int n);
   void bind(Element* el, const std::string& Prefix);
   void missingData(Element *el, unsigned int expected_size, size_t actual_size);
   void Debug(int from);
@@ -54,6 +54,7 @@ FGTemplateFunc::FGTemplateFunc(FGFDMExec* fdmex, Element* element)
   Load(element, var, fdmex);
   CheckMinArguments(element, 1);
   CheckMaxArguments(element, 1);
+  Compile();
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
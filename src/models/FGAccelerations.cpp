@@ -56,6 +56,7 @@ INCLUDES
 #include "FGAccelerations.h"
 #include "FGFDMExec.h"
 #include "input_output/FGLog.h"
+#include "input_output/FGStateStream.h"
 
 using namespace std;
 
@@ -381,6 +382,36 @@ void FGAccelerations::bind(void)
   PropertyManager->Tie("forces/fbz-gear-lbs", this, eZ, &FGAccelerations::GetGroundForces);
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGAccelerations::SaveState(FGStateWriter& state) const
+{
+  FGModel::SaveState(state);
+
+  state.Write(vPQRdot);
+  state.Write(vPQRidot);
+  state.Write(vUVWdot);
+  state.Write(vUVWidot);
+  state.Write(vBodyAccel);
+  state.Write(vFrictionForces);
+  state.Write(vFrictionMoments);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGAccelerations::RestoreState(FGStateReader& state)
+{
+  FGModel::RestoreState(state);
+
+  state.Read(vPQRdot);
+  state.Read(vPQRidot);
+  state.Read(vUVWdot);
+  state.Read(vUVWidot);
+  state.Read(vBodyAccel);
+  state.Read(vFrictionForces);
+  state.Read(vFrictionMoments);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
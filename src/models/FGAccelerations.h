@@ -115,6 +115,9 @@ public:
       @return false if no error */
   bool Run(bool Holding) override;
 
+  void SaveState(FGStateWriter& state) const override;
+  void RestoreState(FGStateReader& state) override;
+
   /** Retrieves the body axis acceleration.
       Retrieves the computed body axis accelerations based on the
       applied forces and accounting for a rotating body frame.
@@ -40,6 +40,8 @@ INCLUDES
 #include "FGFDMExec.h"
 #include "input_output/FGXMLElement.h"
 #include "input_output/FGLog.h"
+#include "input_output/FGStateStream.h"
+#include "input_output/FGProfiler.h"
 
 using namespace std;
 
@@ -185,22 +187,22 @@ bool FGAerodynamics::Run(bool Holding)
   BuildStabilityTransformMatrices();
 
   for (axis_ctr = 0; axis_ctr < 3; ++axis_ctr) {
-    AeroFunctionArray::iterator f;
-
-    AeroFunctionArray* array = &AeroFunctions[axis_ctr];
-    for (f=array->begin(); f != array->end(); ++f) {
+    AeroFunctionArray& array = AeroFunctions[axis_ctr];
+    for (size_t i=0; i<array.size(); ++i) {
+      FGProfileScope profile(AeroProfiles[axis_ctr][i]);
       // Tell the Functions to cache values, so when the function values are
       // being requested for output, the functions do not get calculated again
       // in a context that might have changed, but instead use the values that
       // have already been calculated for this frame.
-      (*f)->cacheValue(true);
-      vFnative(axis_ctr+1) += (*f)->GetValue();
+      array[i]->cacheValue(true);
+      vFnative(axis_ctr+1) += array[i]->GetValue();
     }
 
-    array = &AeroFunctionsAtCG[axis_ctr];
-    for (f=array->begin(); f != array->end(); ++f) {
-      (*f)->cacheValue(true); // Same as above
-      vFnativeAtCG(axis_ctr+1) += (*f)->GetValue();
+    AeroFunctionArray& arrayAtCG = AeroFunctionsAtCG[axis_ctr];
+    for (size_t i=0; i<arrayAtCG.size(); ++i) {
+      FGProfileScope profile(AeroProfilesAtCG[axis_ctr][i]);
+      arrayAtCG[i]->cacheValue(true); // Same as above
+      vFnativeAtCG(axis_ctr+1) += arrayAtCG[i]->GetValue();
     }
   }
 
@@ -252,14 +254,15 @@ bool FGAerodynamics::Run(bool Holding)
   vMomentsMRC.InitMatrix();
 
   for (axis_ctr = 0; axis_ctr < 3; axis_ctr++) {
-    AeroFunctionArray* array = &AeroFunctions[axis_ctr+3];
-    for (AeroFunctionArray::iterator f=array->begin(); f != array->end(); ++f) {
+    AeroFunctionArray& array = AeroFunctions[axis_ctr+3];
+    for (size_t i=0; i<array.size(); ++i) {
+      FGProfileScope profile(AeroProfiles[axis_ctr+3][i]);
       // Tell the Functions to cache values, so when the function values are
       // being requested for output, the functions do not get calculated again
       // in a context that might have changed, but instead use the values that
       // have already been calculated for this frame.
-      (*f)->cacheValue(true);
-      vMomentsMRC(axis_ctr+1) += (*f)->GetValue();
+      array[i]->cacheValue(true);
+      vMomentsMRC(axis_ctr+1) += array[i]->GetValue();
     }
   }
 
@@ -389,6 +392,20 @@ bool FGAerodynamics::Load(Element *document)
     }
     AeroFunctions[AxisIdx[axis]] = ca;
     AeroFunctionsAtCG[AxisIdx[axis]] = ca_atCG;
+
+    // Register the profile entries of the functions.
+    auto profiler = FDMExec->GetProfiler();
+    auto profilePath = [&axis](FGFunction* f) {
+      string name = f->GetName();
+      if (name.empty()) name = "axis-" + axis + "/function";
+      return "aerodynamics/" + name;
+    };
+    AeroProfiles[AxisIdx[axis]].clear();
+    for (auto f: ca)
+      AeroProfiles[AxisIdx[axis]].push_back(profiler->Register(profilePath(f)));
+    AeroProfilesAtCG[AxisIdx[axis]].clear();
+    for (auto f: ca_atCG)
+      AeroProfilesAtCG[AxisIdx[axis]].push_back(profiler->Register(profilePath(f)));
     axis_element = document->FindNextElement("axis");
   }
 
@@ -660,6 +677,66 @@ void FGAerodynamics::BuildStabilityTransformMatrices(void)
   Tb2s = Ts2b.Transposed();
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGAerodynamics::SaveState(FGStateWriter& state) const
+{
+  FGModel::SaveState(state);
+
+  state.Write(vFnative);
+  state.Write(vFw);
+  state.Write(vForces);
+  state.Write(vFnativeAtCG);
+  state.Write(vForcesAtCG);
+  state.Write(vMoments);
+  state.Write(vMomentsMRC);
+  state.Write(vMomentsMRCBodyXYZ);
+  state.Write(vDXYZcg);
+  state.Write(vDeltaRP);
+  state.Write(alphaclmax);
+  state.Write(alphaclmin);
+  state.Write(alphahystmax);
+  state.Write(alphahystmin);
+  state.Write(impending_stall);
+  state.Write(stall_hyst);
+  state.Write(bi2vel);
+  state.Write(ci2vel);
+  state.Write(alphaw);
+  state.Write(clsq);
+  state.Write(lod);
+  state.Write(qbar_area);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGAerodynamics::RestoreState(FGStateReader& state)
+{
+  FGModel::RestoreState(state);
+
+  state.Read(vFnative);
+  state.Read(vFw);
+  state.Read(vForces);
+  state.Read(vFnativeAtCG);
+  state.Read(vForcesAtCG);
+  state.Read(vMoments);
+  state.Read(vMomentsMRC);
+  state.Read(vMomentsMRCBodyXYZ);
+  state.Read(vDXYZcg);
+  state.Read(vDeltaRP);
+  state.Read(alphaclmax);
+  state.Read(alphaclmin);
+  state.Read(alphahystmax);
+  state.Read(alphahystmin);
+  state.Read(impending_stall);
+  state.Read(stall_hyst);
+  state.Read(bi2vel);
+  state.Read(ci2vel);
+  state.Read(alphaw);
+  state.Read(clsq);
+  state.Read(lod);
+  state.Read(qbar_area);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
@@ -53,6 +53,8 @@ FORWARD DECLARATIONS
 
 namespace JSBSim {
 
+struct FGProfileEntry;
+
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 CLASS DOCUMENTATION
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
@@ -131,6 +133,9 @@ public:
       @return false if no error */
   bool Run(bool Holding) override;
 
+  void SaveState(FGStateWriter& state) const override;
+  void RestoreState(FGStateReader& state) override;
+
   /** Loads the Aerodynamics model.
       The Load function for this class expects the XML parser to
       have found the aerodynamics keyword in the configuration file.
@@ -256,6 +261,10 @@ private:
   FGFunction* AeroRPShift;
   typedef std::vector <FGFunction*> AeroFunctionArray;
   AeroFunctionArray* AeroFunctions;
+  // Entries that profile the aerodynamic functions (see FGProfiler)
+  typedef std::vector <FGProfileEntry*> AeroProfileArray;
+  AeroProfileArray AeroProfiles[6];
+  AeroProfileArray AeroProfilesAtCG[6];
   FGMatrix33 Ts2b, Tb2s;
   FGColumnVector3 vFnative;
   FGColumnVector3 vFw;
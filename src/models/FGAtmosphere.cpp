@@ -45,6 +45,7 @@ INCLUDES
 #include "FGFDMExec.h"
 #include "FGAtmosphere.h"
 #include "input_output/FGLog.h"
+#include "input_output/FGStateStream.h"
 
 using namespace std;
 
@@ -358,6 +359,46 @@ void FGAtmosphere::bind(void)
   PropertyManager->Tie("atmosphere/pressure-altitude", this, &FGAtmosphere::GetPressureAltitude);
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGAtmosphere::SaveState(FGStateWriter& state) const
+{
+  FGModel::SaveState(state);
+
+  state.Write(SLtemperature);
+  state.Write(SLdensity);
+  state.Write(SLpressure);
+  state.Write(SLsoundspeed);
+  state.Write(Temperature);
+  state.Write(Density);
+  state.Write(Pressure);
+  state.Write(Soundspeed);
+  state.Write(PressureAltitude);
+  state.Write(DensityAltitude);
+  state.Write(Viscosity);
+  state.Write(KinematicViscosity);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGAtmosphere::RestoreState(FGStateReader& state)
+{
+  FGModel::RestoreState(state);
+
+  state.Read(SLtemperature);
+  state.Read(SLdensity);
+  state.Read(SLpressure);
+  state.Read(SLsoundspeed);
+  state.Read(Temperature);
+  state.Read(Density);
+  state.Read(Pressure);
+  state.Read(Soundspeed);
+  state.Read(PressureAltitude);
+  state.Read(DensityAltitude);
+  state.Read(Viscosity);
+  state.Read(KinematicViscosity);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
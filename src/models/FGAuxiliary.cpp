@@ -49,6 +49,7 @@ INCLUDES
 #include "FGInertial.h"
 #include "FGAtmosphere.h"
 #include "input_output/FGLog.h"
+#include "input_output/FGStateStream.h"
 
 using namespace std;
 
@@ -480,6 +481,95 @@ double FGAuxiliary::BadUnits(void) const
   return 0.0;
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGAuxiliary::SaveState(FGStateWriter& state) const
+{
+  FGModel::SaveState(state);
+
+  state.Write(vcas);
+  state.Write(veas);
+  state.Write(pt);
+  state.Write(tat);
+  state.Write(tatc);
+  state.Write(mTw2b);
+  state.Write(mTb2w);
+  state.Write(vPilotAccel);
+  state.Write(vPilotAccelN);
+  state.Write(vNcg);
+  state.Write(vNwcg);
+  state.Write(vAeroPQR);
+  state.Write(vAeroUVW);
+  state.Write(vEulerRates);
+  state.Write(vMachUVW);
+  state.Write(vLocationVRP);
+  state.Write(NEUStartLocation);
+  state.Write(Vt);
+  state.Write(Vground);
+  state.Write(Mach);
+  state.Write(MachU);
+  state.Write(qbar);
+  state.Write(qbarUW);
+  state.Write(qbarUV);
+  state.Write(Re);
+  state.Write(alpha);
+  state.Write(beta);
+  state.Write(adot);
+  state.Write(bdot);
+  state.Write(psigt);
+  state.Write(gamma);
+  state.Write(Nx);
+  state.Write(Ny);
+  state.Write(Nz);
+  state.Write(hoverbcg);
+  state.Write(hoverbmac);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGAuxiliary::RestoreState(FGStateReader& state)
+{
+  FGModel::RestoreState(state);
+
+  state.Read(vcas);
+  state.Read(veas);
+  state.Read(pt);
+  state.Read(tat);
+  state.Read(tatc);
+  state.Read(mTw2b);
+  state.Read(mTb2w);
+  state.Read(vPilotAccel);
+  state.Read(vPilotAccelN);
+  state.Read(vNcg);
+  state.Read(vNwcg);
+  state.Read(vAeroPQR);
+  state.Read(vAeroUVW);
+  state.Read(vEulerRates);
+  state.Read(vMachUVW);
+  state.Read(vLocationVRP);
+  state.Read(NEUStartLocation);
+  state.Read(Vt);
+  state.Read(Vground);
+  state.Read(Mach);
+  state.Read(MachU);
+  state.Read(qbar);
+  state.Read(qbarUW);
+  state.Read(qbarUV);
+  state.Read(Re);
+  state.Read(alpha);
+  state.Read(beta);
+  state.Read(adot);
+  state.Read(bdot);
+  state.Read(psigt);
+  state.Read(gamma);
+  state.Read(Nx);
+  state.Read(Ny);
+  state.Read(Nz);
+  state.Read(hoverbcg);
+  state.Read(hoverbmac);
+  NEUCalcValid = false;
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
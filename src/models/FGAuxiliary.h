@@ -120,6 +120,9 @@ public:
                      false if no error */
   bool Run(bool Holding) override;
 
+  void SaveState(FGStateWriter& state) const override;
+  void RestoreState(FGStateReader& state) override;
+
 // GET functions
 
   /** Compute the total pressure in front of the Pitot tube. It uses the
@@ -40,6 +40,7 @@ INCLUDES
 #include "FGBuoyantForces.h"
 #include "input_output/FGXMLElement.h"
 #include "input_output/FGLog.h"
+#include "input_output/FGStateStream.h"
 
 using namespace std;
 
@@ -257,6 +258,42 @@ void FGBuoyantForces::bind(void)
                        &FGBuoyantForces::GetForces, (PSF)nullptr);
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGBuoyantForces::SaveState(FGStateWriter& state) const
+{
+  FGModel::SaveState(state);
+
+  state.Write(vTotalForces);
+  state.Write(vTotalMoments);
+  state.Write(gasCellJ);
+  state.Write(vGasCellXYZ);
+  state.Write(vXYZgasCell_arm);
+
+  state.Write(static_cast<uint32_t>(Cells.size()));
+  for (auto cell: Cells)
+    cell->SaveState(state);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGBuoyantForces::RestoreState(FGStateReader& state)
+{
+  FGModel::RestoreState(state);
+
+  state.Read(vTotalForces);
+  state.Read(vTotalMoments);
+  state.Read(gasCellJ);
+  state.Read(vGasCellXYZ);
+  state.Read(vXYZgasCell_arm);
+
+  uint32_t count;
+  state.Read(count);
+  state.CheckCount(count, Cells.size());
+  for (auto cell: Cells)
+    cell->RestoreState(state);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
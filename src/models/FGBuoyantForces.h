@@ -116,6 +116,9 @@ public:
       @return false if no error */
   bool Run(bool Holding) override;
 
+  void SaveState(FGStateWriter& state) const override;
+  void RestoreState(FGStateReader& state) override;
+
   /** Loads the Buoyant forces model.
       The Load function for this class expects the XML parser to
       have found the Buoyant_forces keyword in the configuration file.
@@ -142,6 +142,10 @@ public:
                      "Resume" command to be given.
       @return true always.  */
   bool Run(bool Holding) override;
+
+  void SaveState(FGStateWriter& state) const override;
+  void RestoreState(FGStateReader& state) override;
+
   
   /** Loads the external forces from the XML configuration file.
       If the external_reactions section is encountered in the vehicle configuration
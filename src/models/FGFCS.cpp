@@ -62,6 +62,7 @@ INCLUDES
 #include "models/flight_control/FGLinearActuator.h"
 
 #include "FGFCSChannel.h"
+#include "input_output/FGStateStream.h"
 
 using namespace std;
 
@@ -513,6 +514,10 @@ bool FGFCS::Load(Element* document)
     else
       ChannelRate = 1;
 
+    int ChannelPhase = 0;
+    if (!channel_element->GetAttributeValue("execphase").empty())
+      ChannelPhase = channel_element->GetAttributeValueAsNumber("execphase");
+
     if (sOnOffProperty.length() > 0) {
       SGPropertyNode* OnOffPropertyNode = PropertyManager->GetNode(sOnOffProperty);
       if (OnOffPropertyNode == nullptr) {
@@ -524,9 +529,10 @@ bool FGFCS::Load(Element* document)
         throw err;
       } else
         newChannel = new FGFCSChannel(this, sChannelName, ChannelRate,
-                                      OnOffPropertyNode);
+                                      OnOffPropertyNode, ChannelPhase);
     } else
-      newChannel = new FGFCSChannel(this, sChannelName, ChannelRate);
+      newChannel = new FGFCSChannel(this, sChannelName, ChannelRate, nullptr,
+                                    ChannelPhase);
 
     SystemChannels.push_back(newChannel);
 
@@ -565,15 +571,19 @@ bool FGFCS::Load(Element* document)
         } else if (component_element->GetName() == string("integrator")) {
           // <integrator> is equivalent to <pid type="trap">
           Element* c1_el = component_element->FindElement("c1");
-          if (!c1_el) {
+          if (c1_el) {
+            c1_el->ChangeName("ki");
+            if (!c1_el->HasAttribute("type"))
+              c1_el->AddAttribute("type", "trap");
+          }
+          // <c1> has already been renamed if the model is built again from a
+          // cached document (see FGFDMExec::Clone).
+          else if (!component_element->FindElement("ki")) {
             XMLLogException err(component_element);
             err << "INTEGRATOR component " << component_element->GetAttributeValue("name")
                 << " does not provide the parameter <c1>" << endl;
             throw err;
           }
-          c1_el->ChangeName("ki");
-          if (!c1_el->HasAttribute("type"))
-            c1_el->AddAttribute("type", "trap");
           newChannel->Add(new FGPID(this, component_element));
         } else if (component_element->GetName() == string("actuator")) {
           newChannel->Add(new FGActuator(this, component_element));
@@ -607,6 +617,16 @@ bool FGFCS::Load(Element* document)
       }
       component_element = channel_element->GetNextElement();
     }
+
+    // Register the profile entries of the channel and of its components.
+    auto profiler = FDMExec->GetProfiler();
+    newChannel->SetProfile(profiler->Register("systems/" + PropertyManager->mkPropertyName(sChannelName, true)));
+    const string& path = newChannel->GetProfile()->path;
+    for (unsigned int i=0; i<newChannel->GetNumComponents(); i++) {
+      string name = PropertyManager->mkPropertyName(newChannel->GetComponent(i)->GetName(), true);
+      newChannel->SetComponentProfile(i, profiler->Register(path + "/" + name));
+    }
+
     channel_element = document->FindNextElement("channel");
   }
 
@@ -808,6 +828,90 @@ void FGFCS::bindThrottle(unsigned int num)
                                         &FGFCS::SetPropFeather);
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGFCS::SaveState(FGStateWriter& state) const
+{
+  FGModel::SaveState(state);
+
+  state.Write(DaCmd);
+  state.Write(DeCmd);
+  state.Write(DrCmd);
+  state.Write(DfCmd);
+  state.Write(DsbCmd);
+  state.Write(DspCmd);
+  state.Write(DePos);
+  state.Write(DaLPos);
+  state.Write(DaRPos);
+  state.Write(DrPos);
+  state.Write(DfPos);
+  state.Write(DsbPos);
+  state.Write(DspPos);
+  state.Write(PTrimCmd);
+  state.Write(YTrimCmd);
+  state.Write(RTrimCmd);
+  state.Write(ThrottleCmd);
+  state.Write(ThrottlePos);
+  state.Write(MixtureCmd);
+  state.Write(MixturePos);
+  state.Write(PropAdvanceCmd);
+  state.Write(PropAdvance);
+  state.Write(PropFeatherCmd);
+  state.Write(PropFeather);
+  state.Write(BrakePos);
+  state.Write(GearCmd);
+  state.Write(GearPos);
+  state.Write(TailhookPos);
+  state.Write(WingFoldPos);
+
+  state.Write(static_cast<uint32_t>(SystemChannels.size()));
+  for (auto channel: SystemChannels)
+    channel->SaveState(state);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGFCS::RestoreState(FGStateReader& state)
+{
+  FGModel::RestoreState(state);
+
+  state.Read(DaCmd);
+  state.Read(DeCmd);
+  state.Read(DrCmd);
+  state.Read(DfCmd);
+  state.Read(DsbCmd);
+  state.Read(DspCmd);
+  state.Read(DePos);
+  state.Read(DaLPos);
+  state.Read(DaRPos);
+  state.Read(DrPos);
+  state.Read(DfPos);
+  state.Read(DsbPos);
+  state.Read(DspPos);
+  state.Read(PTrimCmd);
+  state.Read(YTrimCmd);
+  state.Read(RTrimCmd);
+  state.ReadFixed(ThrottleCmd);
+  state.ReadFixed(ThrottlePos);
+  state.ReadFixed(MixtureCmd);
+  state.ReadFixed(MixturePos);
+  state.ReadFixed(PropAdvanceCmd);
+  state.ReadFixed(PropAdvance);
+  state.ReadFixed(PropFeatherCmd);
+  state.ReadFixed(PropFeather);
+  state.ReadFixed(BrakePos);
+  state.Read(GearCmd);
+  state.Read(GearPos);
+  state.Read(TailhookPos);
+  state.Read(WingFoldPos);
+
+  uint32_t count;
+  state.Read(count);
+  state.CheckCount(count, SystemChannels.size());
+  for (auto channel: SystemChannels)
+    channel->RestoreState(state);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
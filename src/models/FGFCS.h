@@ -206,6 +206,9 @@ public:
       @return false if no error */
   bool Run(bool Holding) override;
 
+  void SaveState(FGStateWriter& state) const override;
+  void RestoreState(FGStateReader& state) override;
+
   /// @name Pilot input command retrieval
   //@{
   /** Gets the aileron command.
@@ -40,6 +40,9 @@ INCLUDES
 
 #include <iostream>
 
+#include "input_output/FGStateStream.h"
+#include "input_output/FGProfiler.h"
+
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 FORWARD DECLARATIONS
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
@@ -55,12 +58,22 @@ CLASS DOCUMENTATION
       element. Channels are a way to group sets of components that perform
       a specific purpose or algorithm.
       Created within a <system> tag, the channel is defined as follows
-      <channel name="name" [execute="property"] [execrate="rate"]>
+      <channel name="name" [execute="property"] [execrate="rate"] [execphase="phase"]>
       name is the name of the channel - in the old way this would also be used to bind elements
       execute [optional] is the property that defines when to execute this channel; an on/off switch
       execrate [optional] is the rate at which the channel should execute.
                A value of 0 or 1 will execute the channel every frame, a value of 2
                every other frame (half rate), a value of 4 is every 4th frame (quarter rate)
+      execphase [optional] is the frame, within the execrate period, at which the channel
+               executes. It allows to spread the channels that run at the same rate over
+               different frames: two channels with an execrate of 2 and an execphase of 0
+               and 1 execute at alternate frames. The frames are counted from 1 after the
+               initialization and the channel executes at the frames which number modulo
+               execrate equals execphase: the default phase 0 executes at the frames
+               execrate, 2*execrate, etc. (as the channels did before the phase was
+               introduced) and a phase of 1 executes at the first frame. Note that this
+               differs from the phase of the models (simulation/models/<name>/phase)
+               which counts the frames from 0.
       */
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -73,12 +86,13 @@ class FGFCSChannel {
 public:
   /// Constructor
   FGFCSChannel(FGFCS* FCS, const std::string &name, int execRate,
-               SGPropertyNode* node=nullptr)
+               SGPropertyNode* node=nullptr, int execPhase=0)
     : fcs(FCS), OnOffNode(node), Name(name)
   {
     ExecRate = execRate < 1 ? 1 : execRate;
+    ExecPhase = execPhase < 0 ? 0 : execPhase % ExecRate;
     // Set ExecFrameCountSinceLastRun so that each components are initialized
-    ExecFrameCountSinceLastRun = ExecRate;
+    ResetFrameCount();
   }
 
   /// Destructor
@@ -92,6 +106,14 @@ public:
   /// Adds a component to a channel
   void Add(FGFCSComponent* comp) {
     FCSComponents.push_back(comp);
+    ComponentProfiles.push_back(nullptr);
+  }
+  /// Sets the entry that profiles the channel execution (see FGProfiler).
+  void SetProfile(FGProfileEntry* entry) { Profile = entry; }
+  FGProfileEntry* GetProfile(void) const { return Profile; }
+  /// Sets the entry that profiles the execution of the i-th component.
+  void SetComponentProfile(unsigned int i, FGProfileEntry* entry) {
+    ComponentProfiles[i] = entry;
   }
   /// Returns the number of components in the channel.
   size_t GetNumComponents() {return FCSComponents.size();}
@@ -112,7 +134,7 @@ public:
 
     // Set ExecFrameCountSinceLastRun so that each components are initialized
     // after a reset.
-    ExecFrameCountSinceLastRun = ExecRate;
+    ResetFrameCount();
   }
   /// Executes all the components in a channel.
   void Execute() {
@@ -123,7 +145,7 @@ public:
 
     if (fcs->GetDt() != 0.0) {
       if (ExecFrameCountSinceLastRun >= ExecRate) {
-        ExecFrameCountSinceLastRun = 0;
+        ExecFrameCountSinceLastRun -= ExecRate;
       }
 
       ++ExecFrameCountSinceLastRun;
@@ -132,21 +154,52 @@ public:
     // channel will be run at rate 1 if trimming, or when the next execrate
     // frame is reached
     if (fcs->GetTrimStatus() || ExecFrameCountSinceLastRun >= ExecRate) {
-      for (unsigned int i=0; i<FCSComponents.size(); i++)
+      FGProfileScope profile(Profile);
+      for (unsigned int i=0; i<FCSComponents.size(); i++) {
+        FGProfileScope component(ComponentProfiles[i]);
         FCSComponents[i]->Run();
+      }
     }
   }
   /// Get the channel rate
   int GetRate(void) const { return ExecRate; }
+  /// Get the channel phase
+  int GetPhase(void) const { return ExecPhase; }
+  /// Saves the state of the channel and of its components.
+  void SaveState(FGStateWriter& state) const {
+    state.Write(ExecFrameCountSinceLastRun);
+    state.Write(static_cast<uint32_t>(FCSComponents.size()));
+    for (auto comp: FCSComponents)
+      comp->SaveState(state);
+  }
+  /// Restores the state of the channel and of its components.
+  void RestoreState(FGStateReader& state) {
+    uint32_t count;
+    state.Read(ExecFrameCountSinceLastRun);
+    state.Read(count);
+    state.CheckCount(count, FCSComponents.size());
+    for (auto comp: FCSComponents)
+      comp->RestoreState(state);
+  }
 
   private:
     FGFCS* fcs;
     FCSCompVec FCSComponents;
+    FGProfileEntry* Profile = nullptr;
+    std::vector<FGProfileEntry*> ComponentProfiles;
     SGConstPropertyNode_ptr OnOffNode;
     std::string Name;
 
     int ExecRate;        // rate at which this system executes, 0 or 1 every frame, 2 every second frame etc..
+    int ExecPhase;       // frame of the ExecRate period at which this system executes
     int ExecFrameCountSinceLastRun;
+
+    // The count is offset by the phase so that the first execution after the
+    // initialization happens at the frame ExecPhase (or ExecRate if the phase
+    // is 0), the first frame being numbered 1.
+    void ResetFrameCount(void) {
+      ExecFrameCountSinceLastRun = ExecRate + (ExecRate - ExecPhase) % ExecRate;
+    }
 };
 
 }
@@ -40,6 +40,7 @@ INCLUDES
 #include "FGGasCell.h"
 #include "input_output/FGXMLElement.h"
 #include "input_output/FGLog.h"
+#include "input_output/FGStateStream.h"
 
 using std::string;
 using std::max;
@@ -424,6 +425,52 @@ void FGGasCell::Calculate(double dt)
   }
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGGasCell::SaveState(FGStateWriter& state) const
+{
+  state.Write(vFn);
+  state.Write(vMn);
+  state.Write(Pressure);
+  state.Write(Contents);
+  state.Write(Volume);
+  state.Write(dVolumeIdeal);
+  state.Write(Temperature);
+  state.Write(Buoyancy);
+  state.Write(ValveOpen);
+  state.Write(Mass);
+  state.Write(gasCellJ);
+  state.Write(gasCellM);
+
+  state.Write(static_cast<uint32_t>(Ballonet.size()));
+  for (auto ballonet: Ballonet)
+    ballonet->SaveState(state);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGGasCell::RestoreState(FGStateReader& state)
+{
+  state.Read(vFn);
+  state.Read(vMn);
+  state.Read(Pressure);
+  state.Read(Contents);
+  state.Read(Volume);
+  state.Read(dVolumeIdeal);
+  state.Read(Temperature);
+  state.Read(Buoyancy);
+  state.Read(ValveOpen);
+  state.Read(Mass);
+  state.Read(gasCellJ);
+  state.Read(gasCellM);
+
+  uint32_t count;
+  state.Read(count);
+  state.CheckCount(count, Ballonet.size());
+  for (auto ballonet: Ballonet)
+    ballonet->RestoreState(state);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
@@ -776,6 +823,34 @@ void FGBallonet::Calculate(double dt)
   ballonetJ += MassBalance->GetPointmassInertia(GetMass(), GetXYZ());
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGBallonet::SaveState(FGStateWriter& state) const
+{
+  state.Write(Pressure);
+  state.Write(Contents);
+  state.Write(Volume);
+  state.Write(dVolumeIdeal);
+  state.Write(dU);
+  state.Write(Temperature);
+  state.Write(ValveOpen);
+  state.Write(ballonetJ);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGBallonet::RestoreState(FGStateReader& state)
+{
+  state.Read(Pressure);
+  state.Read(Contents);
+  state.Read(Volume);
+  state.Read(dVolumeIdeal);
+  state.Read(dU);
+  state.Read(Temperature);
+  state.Read(ValveOpen);
+  state.Read(ballonetJ);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
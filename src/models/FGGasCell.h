@@ -54,6 +54,8 @@ namespace JSBSim {
 
 class FGBallonet;
 class FGMassBalance;
+class FGStateWriter;
+class FGStateReader;
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 CLASS DOCUMENTATION
@@ -185,6 +187,9 @@ public:
    */
   void Calculate(double dt);
 
+  void SaveState(FGStateWriter& state) const;
+  void RestoreState(FGStateReader& state);
+
   /** Get the index of this gas cell
       @return gas cell index. */
   int GetIndex(void) const {return CellNum;}
@@ -310,6 +315,8 @@ public:
    */
   void Calculate(double dt);
 
+  void SaveState(FGStateWriter& state) const;
+  void RestoreState(FGStateReader& state);
 
   /** Get the center of gravity location of the ballonet
       @return CoG location in the structural frame in inches. */
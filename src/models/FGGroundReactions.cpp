@@ -42,6 +42,7 @@ INCLUDES
 #include "FGAccelerations.h"
 #include "input_output/FGXMLElement.h"
 #include "input_output/FGLog.h"
+#include "input_output/FGStateStream.h"
 
 using namespace std;
 
@@ -248,6 +249,38 @@ void FGGroundReactions::bind(void)
                        &FGGroundReactions::SetDsCmd);
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGGroundReactions::SaveState(FGStateWriter& state) const
+{
+  FGModel::SaveState(state);
+
+  state.Write(vForces);
+  state.Write(vMoments);
+  state.Write(DsCmd);
+
+  state.Write(static_cast<uint32_t>(lGear.size()));
+  for (auto& gear: lGear)
+    gear->SaveState(state);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGGroundReactions::RestoreState(FGStateReader& state)
+{
+  FGModel::RestoreState(state);
+
+  state.Read(vForces);
+  state.Read(vMoments);
+  state.Read(DsCmd);
+
+  uint32_t count;
+  state.Read(count);
+  state.CheckCount(count, lGear.size());
+  for (auto& gear: lGear)
+    gear->RestoreState(state);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
@@ -41,6 +41,7 @@ INCLUDES
 #include "FGInput.h"
 #include "FGFDMExec.h"
 #include "input_output/FGUDPInputSocket.h"
+#include "input_output/FGInputSharedMemory.h"
 #include "input_output/FGXMLFileRead.h"
 #include "input_output/FGModelLoader.h"
 #include "input_output/FGLog.h"
@@ -102,8 +103,10 @@ bool FGInput::Load(Element* el)
 
   if (type.empty() || type == "SOCKET") {
     Input = new FGInputSocket(FDMExec, enabled);
-  } else if (type == "QTJSBSIM") {
+  } else if (type == "QTJSBSIM" || type == "UDP") {
     Input = new FGUDPInputSocket(FDMExec, enabled);
+  } else if (type == "SHM") {
+    Input = new FGInputSharedMemory(FDMExec, enabled);
   } else if (type != string("NONE")) {
     FGXMLLogging log(element, LogLevel::ERROR);
     log << "Unknown type of input specified in config file" << endl;
@@ -63,6 +63,11 @@ CLASS DOCUMENTATION
       SOCKET      Will eventually send data to a socket input, where NAME
                   would then be the IP address of the machine the data should
                   be sent to. DON'T USE THIS YET!
+      UDP         Reads the values of properties from UDP datagrams, either as
+                  text or as packed binary records (see FGUDPInputSocket).
+      QTJSBSIM    Same as UDP.
+      SHM         Reads the values of properties from a POSIX shared memory
+                  segment named NAME (see FGInputSharedMemory).
       NONE        Specifies to do nothing. This setting makes it easy to turn on and
                   off the data input without having to mess with anything else.
 
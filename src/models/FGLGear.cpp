@@ -48,6 +48,7 @@ INCLUDES
 #include "math/FGTable.h"
 #include "input_output/FGXMLElement.h"
 #include "input_output/FGLog.h"
+#include "input_output/FGStateStream.h"
 
 using namespace std;
 
@@ -905,6 +906,98 @@ void FGLGear::Report(ReportType repType)
   }
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGLGear::SaveState(FGStateWriter& state) const
+{
+  state.Section(name);
+  state.Write(mT);
+  state.Write(vFn);
+  state.Write(vMn);
+  state.Write(mTGear);
+  state.Write(vWhlVelVec);
+  state.Write(vGroundWhlVel);
+  state.Write(vGroundNormal);
+  state.Write(SteerAngle);
+  state.Write(compressLength);
+  state.Write(compressSpeed);
+  state.Write(SinkRate);
+  state.Write(GroundSpeed);
+  state.Write(TakeoffDistanceTraveled);
+  state.Write(TakeoffDistanceTraveled50ft);
+  state.Write(LandingDistanceTraveled);
+  state.Write(MaximumStrutForce);
+  state.Write(StrutForce);
+  state.Write(MaximumStrutTravel);
+  state.Write(FCoeff);
+  state.Write(WheelSlip);
+  state.Write(GearPos);
+  state.Write(WOW);
+  state.Write(lastWOW);
+  state.Write(FirstContact);
+  state.Write(StartedGroundRun);
+  state.Write(LandingReported);
+  state.Write(TakeoffReported);
+  state.Write(ReportEnable);
+  state.Write(StaticFriction);
+  state.Write(AGL);
+  state.Write(useFCSGearPos);
+
+  for (const auto& lm: LMultiplier) {
+    state.Write(lm.ForceJacobian);
+    state.Write(lm.LeverArm);
+    state.Write(lm.Min);
+    state.Write(lm.Max);
+    state.Write(lm.value);
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGLGear::RestoreState(FGStateReader& state)
+{
+  state.Section(name);
+  state.Read(mT);
+  state.Read(vFn);
+  state.Read(vMn);
+  state.Read(mTGear);
+  state.Read(vWhlVelVec);
+  state.Read(vGroundWhlVel);
+  state.Read(vGroundNormal);
+  state.Read(SteerAngle);
+  state.Read(compressLength);
+  state.Read(compressSpeed);
+  state.Read(SinkRate);
+  state.Read(GroundSpeed);
+  state.Read(TakeoffDistanceTraveled);
+  state.Read(TakeoffDistanceTraveled50ft);
+  state.Read(LandingDistanceTraveled);
+  state.Read(MaximumStrutForce);
+  state.Read(StrutForce);
+  state.Read(MaximumStrutTravel);
+  state.Read(FCoeff);
+  state.Read(WheelSlip);
+  state.Read(GearPos);
+  state.Read(WOW);
+  state.Read(lastWOW);
+  state.Read(FirstContact);
+  state.Read(StartedGroundRun);
+  state.Read(LandingReported);
+  state.Read(TakeoffReported);
+  state.Read(ReportEnable);
+  state.Read(StaticFriction);
+  state.Read(AGL);
+  state.Read(useFCSGearPos);
+
+  for (auto& lm: LMultiplier) {
+    state.Read(lm.ForceJacobian);
+    state.Read(lm.LeverArm);
+    state.Read(lm.Min);
+    state.Read(lm.Max);
+    state.Read(lm.value);
+  }
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
@@ -55,6 +55,8 @@ class Element;
 class FGPropertyManager;
 class FGGroundReactions;
 class FGFunction;
+class FGStateWriter;
+class FGStateReader;
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 CLASS DOCUMENTATION
@@ -320,6 +322,9 @@ public:
 
   void ResetToIC(void);
 
+  void SaveState(FGStateWriter& state) const;
+  void RestoreState(FGStateReader& state);
+
 private:
   int GearNumber;
   static const FGMatrix33 Tb2s;
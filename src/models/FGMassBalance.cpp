@@ -44,6 +44,7 @@ INCLUDES
 #include "FGFDMExec.h"
 #include "input_output/FGXMLElement.h"
 #include "input_output/FGLog.h"
+#include "input_output/FGStateStream.h"
 
 using namespace std;
 
@@ -481,6 +482,68 @@ void FGMassBalance::GetMassPropertiesReport(int i)
       << LogFormat::NORMAL << endl;
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGMassBalance::SaveState(FGStateWriter& state) const
+{
+  FGModel::SaveState(state);
+
+  state.Write(Weight);
+  state.Write(EmptyWeight);
+  state.Write(Mass);
+  state.Write(mJ);
+  state.Write(mJinv);
+  state.Write(pmJ);
+  state.Write(baseJ);
+  state.Write(vXYZcg);
+  state.Write(vLastXYZcg);
+  state.Write(vDeltaXYZcg);
+  state.Write(vDeltaXYZcgBody);
+  state.Write(vXYZtank);
+  state.Write(vbaseXYZcg);
+  state.Write(vPMxyz);
+  state.Write(PointMassCG);
+
+  state.Write(static_cast<uint32_t>(PointMasses.size()));
+  for (auto pm: PointMasses) {
+    state.Write(pm->Location);
+    state.Write(pm->Weight);
+    state.Write(pm->mPMInertia);
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGMassBalance::RestoreState(FGStateReader& state)
+{
+  FGModel::RestoreState(state);
+
+  state.Read(Weight);
+  state.Read(EmptyWeight);
+  state.Read(Mass);
+  state.Read(mJ);
+  state.Read(mJinv);
+  state.Read(pmJ);
+  state.Read(baseJ);
+  state.Read(vXYZcg);
+  state.Read(vLastXYZcg);
+  state.Read(vDeltaXYZcg);
+  state.Read(vDeltaXYZcgBody);
+  state.Read(vXYZtank);
+  state.Read(vbaseXYZcg);
+  state.Read(vPMxyz);
+  state.Read(PointMassCG);
+
+  uint32_t count;
+  state.Read(count);
+  state.CheckCount(count, PointMasses.size());
+  for (auto pm: PointMasses) {
+    state.Read(pm->Location);
+    state.Read(pm->Weight);
+    state.Read(pm->mPMInertia);
+  }
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
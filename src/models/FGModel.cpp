@@ -42,6 +42,7 @@ INCLUDES
 #include "FGFDMExec.h"
 #include "input_output/FGModelLoader.h"
 #include "input_output/FGLog.h"
+#include "input_output/FGStateStream.h"
 
 using namespace std;
 
@@ -64,8 +65,10 @@ FGModel::FGModel(FGFDMExec* fdmex)
   //must be brought up now.
   PropertyManager = FDMExec->GetPropertyManager();
 
-  exe_ctr     = 1;
+  exe_ctr     = 0;
   rate        = 1;
+  phase       = 0;
+  scheduled   = false;
 
   Debug(0);
 }
@@ -81,7 +84,7 @@ FGModel::~FGModel()
 
 bool FGModel::InitModel(void)
 {
-  exe_ctr = 1;
+  exe_ctr = 0;
   return FGModelFunctions::InitModel();
 }
 
@@ -91,12 +94,48 @@ bool FGModel::Run(bool Holding)
 {
   FGModel::Debug(2);
 
-  if (rate == 1) return false; // Fast exit if nothing to do
+  if (rate == 1 || scheduled) return false; // Fast exit if nothing to do
 
-  if (exe_ctr >= rate) exe_ctr = 0;
+  // A rate of 0 disables the model.
+  bool skip = rate == 0 || exe_ctr != phase % rate;
 
-  if (exe_ctr++ == 1) return false;
-  else              return true;
+  if (++exe_ctr >= rate) exe_ctr = 0;
+
+  return skip;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGModel::SetRate(unsigned int tt)
+{
+  rate = tt;
+  FDMExec->InvalidateSchedule();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGModel::SetPhase(unsigned int ph)
+{
+  phase = ph;
+  FDMExec->InvalidateSchedule();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGModel::SaveState(FGStateWriter& state) const
+{
+  state.Write(exe_ctr);
+  state.Write(rate);
+  state.Write(phase);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGModel::RestoreState(FGStateReader& state)
+{
+  state.Read(exe_ctr);
+  state.Read(rate);
+  state.Read(phase);
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -140,7 +179,10 @@ bool FGModel::Upload(Element* el, bool preLoad)
 
     Element* element = document->FindElement();
     while (element) {
-      el->AddChildElement(element);
+      // The elements have already been copied if the model is built again
+      // from a cached document (see FGFDMExec::Clone).
+      if (!el->HasChildElement(element))
+        el->AddChildElement(element);
       element->SetParent(el);
       element = document->FindNextElement();
     }
@@ -53,6 +53,8 @@ namespace JSBSim {
 class FGFDMExec;
 class Element;
 class FGPropertyManager;
+class FGStateWriter;
+class FGStateReader;
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 CLASS DOCUMENTATION
@@ -88,9 +90,16 @@ public:
 
   bool InitModel(void) override;
   /// Set the ouput rate for the model in frames
-  void SetRate(unsigned int tt) {rate = tt;}
+  void SetRate(unsigned int tt);
   /// Get the output rate for the model in frames
   unsigned int GetRate(void) const { return rate; }
+  /** Set the phase of the model in frames.
+      A model which rate is N runs at the frames which index modulo N equals
+      its phase, the frames being counted from the initialization of the model
+      (index 0 is the first frame). */
+  void SetPhase(unsigned int ph);
+  /// Get the phase of the model in frames
+  unsigned int GetPhase(void) const { return phase; }
   FGFDMExec* GetExec(void) const { return FDMExec; }
 
   void SetPropertyManager(std::shared_ptr<FGPropertyManager> fgpm) { PropertyManager=fgpm;}
@@ -98,9 +107,22 @@ public:
   const std::string& GetName(void) const { return Name; }
   virtual bool Load(Element* el) { return true; }
 
+  /** Saves the internal state of the model.
+      The models must save all the members that are not recomputed from
+      scratch during the next call to Run() so that a simulation restored from
+      the state continues exactly as the original one.
+      @see FGFDMExec::SaveState */
+  virtual void SaveState(FGStateWriter& state) const;
+  /** Restores the internal state of the model.
+      The members must be read in the same order than they have been saved by
+      SaveState().
+      @see FGFDMExec::RestoreState */
+  virtual void RestoreState(FGStateReader& state);
+
 protected:
   unsigned int exe_ctr;
   unsigned int rate;
+  unsigned int phase;
   std::string Name;
 
   /** Uploads this model in memory.
@@ -116,6 +138,12 @@ protected:
 
   FGFDMExec*         FDMExec;
   std::shared_ptr<FGPropertyManager> PropertyManager;
+
+private:
+  // The models run by the executive are only called at the frames they are
+  // scheduled (see FGFDMExec::Run) and must not skip frames on their own.
+  bool scheduled;
+  friend class FGFDMExec;
 };
 }
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
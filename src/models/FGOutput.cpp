@@ -41,6 +41,8 @@ INCLUDES
 
 #include "FGOutput.h"
 #include "input_output/FGOutputTextFile.h"
+#include "input_output/FGOutputBinaryFile.h"
+#include "input_output/FGOutputSharedMemory.h"
 #include "input_output/FGOutputFG.h"
 #include "input_output/FGXMLFileRead.h"
 #include "input_output/FGModelLoader.h"
@@ -110,7 +112,7 @@ bool FGOutput::Run(bool Holding)
 void FGOutput::Print(void)
 {
   for (auto output: OutputTypes)
-    output->Print();
+    output->Generate();
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -144,7 +146,7 @@ void FGOutput::SetRateHz(double rate)
 void FGOutput::ForceOutput(int idx)
 {
   if (idx >= (int)0 && idx < (int)OutputTypes.size())
-    OutputTypes[idx]->Print();
+    OutputTypes[idx]->Generate();
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -213,6 +215,10 @@ bool FGOutput::Load(int subSystems, std::string protocol, std::string type,
     FGOutputTextFile* OutputTextFile = new FGOutputTextFile(FDMExec);
     OutputTextFile->SetDelimiter("\t");
     Output = OutputTextFile;
+  } else if (type == "BINARY") {
+    Output = new FGOutputBinaryFile(FDMExec);
+  } else if (type == "SHM") {
+    Output = new FGOutputSharedMemory(FDMExec);
   } else if (type == "SOCKET") {
     Output = new FGOutputSocket(FDMExec);
     name += ":" + port + "/" + protocol;
@@ -266,6 +272,10 @@ bool FGOutput::Load(Element* document, const SGPath& dir)
     Output = new FGOutputTextFile(FDMExec);
   } else if (type == "TABULAR") {
     Output = new FGOutputTextFile(FDMExec);
+  } else if (type == "BINARY") {
+    Output = new FGOutputBinaryFile(FDMExec);
+  } else if (type == "SHM") {
+    Output = new FGOutputSharedMemory(FDMExec);
   } else if (type == "SOCKET") {
     Output = new FGOutputSocket(FDMExec);
   } else if (type == "FLIGHTGEAR") {
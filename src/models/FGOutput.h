@@ -72,6 +72,11 @@ CLASS DOCUMENTATION
                   an external instance of FlightGear for visuals.  Parameters
                   defining the socket are given on the \<output> line.
       TABULAR     Columnar data.
+      BINARY      Raw little-endian doubles stored in column blocks, preceded
+                  by a header with the names and units of the columns. See
+                  FGOutputBinaryFile for the description of the format.
+      SHM         The values are written to a POSIX shared memory segment
+                  named NAME (see FGOutputSharedMemory).
       TERMINAL    Output to terminal. NOT IMPLEMENTED YET!
       NONE        Specifies to do nothing. This setting makes it easy to turn on
                   and off the data output without having to mess with anything
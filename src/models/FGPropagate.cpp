@@ -71,6 +71,7 @@ INCLUDES
 #include "simgear/io/iostreams/sgstream.hxx"
 #include "FGInertial.h"
 #include "input_output/FGLog.h"
+#include "input_output/FGStateStream.h"
 
 using namespace std;
 
@@ -94,11 +95,15 @@ FGPropagate::FGPropagate(FGFDMExec* fdmex)
   integrator_translational_rate = eAdamsBashforth2;
   integrator_rotational_position = eRectEuler;
   integrator_translational_position = eAdamsBashforth3;
+  SelectIntegrators();
 
-  VState.dqPQRidot.resize(5, FGColumnVector3(0.0,0.0,0.0));
-  VState.dqUVWidot.resize(5, FGColumnVector3(0.0,0.0,0.0));
-  VState.dqInertialVelocity.resize(5, FGColumnVector3(0.0,0.0,0.0));
-  VState.dqQtrndot.resize(5, FGQuaternion(0.0,0.0,0.0));
+  substeps = 1;
+  adaptive = false;
+
+  VState.dqPQRidot.assign(FGColumnVector3(0.0,0.0,0.0));
+  VState.dqUVWidot.assign(FGColumnVector3(0.0,0.0,0.0));
+  VState.dqInertialVelocity.assign(FGColumnVector3(0.0,0.0,0.0));
+  VState.dqQtrndot.assign(FGQuaternion(0.0,0.0,0.0));
 
   epa = 0.0;
 
@@ -123,15 +128,18 @@ bool FGPropagate::InitModel(void)
   VState.vLocation.SetEllipse(in.SemiMajor, in.SemiMinor);
   Inertial->SetAltitudeAGL(VState.vLocation, 4.0);
 
-  VState.dqPQRidot.resize(5, FGColumnVector3(0.0,0.0,0.0));
-  VState.dqUVWidot.resize(5, FGColumnVector3(0.0,0.0,0.0));
-  VState.dqInertialVelocity.resize(5, FGColumnVector3(0.0,0.0,0.0));
-  VState.dqQtrndot.resize(5, FGColumnVector3(0.0,0.0,0.0));
+  VState.dqPQRidot.assign(FGColumnVector3(0.0,0.0,0.0));
+  VState.dqUVWidot.assign(FGColumnVector3(0.0,0.0,0.0));
+  VState.dqInertialVelocity.assign(FGColumnVector3(0.0,0.0,0.0));
+  VState.dqQtrndot.assign(FGQuaternion(0.0,0.0,0.0));
 
   integrator_rotational_rate = eRectEuler;
   integrator_translational_rate = eAdamsBashforth2;
   integrator_rotational_position = eRectEuler;
   integrator_translational_position = eAdamsBashforth3;
+  SelectIntegrators();
+
+  Stepper.setStepSize(0.0);
 
   epa = 0.0;
 
@@ -185,14 +193,14 @@ void FGPropagate::SetInitialState(const FGInitialCondition* FGIC)
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
-// Initialize the past value deques
+// Initialize the past values of the derivatives
 
 void FGPropagate::InitializeDerivatives()
 {
-  VState.dqPQRidot.assign(5, in.vPQRidot);
-  VState.dqUVWidot.assign(5, in.vUVWidot);
-  VState.dqInertialVelocity.assign(5, VState.vInertialVelocity);
-  VState.dqQtrndot.assign(5, VState.vQtrndot);
+  VState.dqPQRidot.assign(in.vPQRidot);
+  VState.dqUVWidot.assign(in.vUVWidot);
+  VState.dqInertialVelocity.assign(VState.vInertialVelocity);
+  VState.dqQtrndot.assign(VState.vQtrndot);
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -225,20 +233,32 @@ bool FGPropagate::Run(bool Holding)
   // Propagate rotational / translational velocity, angular /translational position, respectively.
 
   if (!FDMExec->IntegrationSuspended()) {
-    Integrate(VState.qAttitudeECI,      VState.vQtrndot,      VState.dqQtrndot,          dt, integrator_rotational_position);
-    Integrate(VState.vPQRi,             in.vPQRidot,          VState.dqPQRidot,          dt, integrator_rotational_rate);
-    Integrate(VState.vInertialPosition, VState.vInertialVelocity, VState.dqInertialVelocity, dt, integrator_translational_position);
-    Integrate(VState.vInertialVelocity, in.vUVWidot,          VState.dqUVWidot,          dt, integrator_translational_rate);
+    (this->*IntegrateRotationalPosition)(VState.qAttitudeECI, VState.vQtrndot, VState.dqQtrndot, dt);
+    (this->*IntegrateRotationalRate)(VState.vPQRi, in.vPQRidot, VState.dqPQRidot, dt);
+    (this->*IntegrateTranslationalPosition)(VState.vInertialPosition, VState.vInertialVelocity, VState.dqInertialVelocity, dt);
+    (this->*IntegrateTranslationalRate)(VState.vInertialVelocity, in.vUVWidot, VState.dqUVWidot, dt);
   }
 
+  // Update the Earth position angle (EPA)
+  epa += in.vOmegaPlanet(eZ)*dt;
+
+  UpdateFromInertialState();
+
+  Debug(2);
+  return false;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Updates the quantities derived from the EPA, the inertial position and
+// velocity, the orientation and the inertial body rates.
+
+void FGPropagate::UpdateFromInertialState(void)
+{
   // CAUTION : the order of the operations below is very important to get
   // transformation matrices that are consistent with the new state of the
   // vehicle
 
-  // 1. Update the Earth position angle (EPA)
-  epa += in.vOmegaPlanet(eZ)*dt;
-
-  // 2. Update the Ti2ec and Tec2i transforms from the updated EPA
+  // 1. Update the Ti2ec and Tec2i transforms from the EPA
   double cos_epa = cos(epa);
   double sin_epa = sin(epa);
   Ti2ec = { cos_epa, sin_epa, 0.0,
@@ -246,14 +266,14 @@ bool FGPropagate::Run(bool Holding)
             0.0, 0.0, 1.0 };
   Tec2i = Ti2ec.Transposed();          // ECEF to ECI frame transform
 
-  // 3. Update the location from the updated Ti2ec and inertial position
+  // 2. Update the location from the updated Ti2ec and inertial position
   VState.vLocation = Ti2ec*VState.vInertialPosition;
 
-  // 4. Update the other "Location-based" transformation matrices from the
+  // 3. Update the other "Location-based" transformation matrices from the
   //    updated vLocation vector.
   UpdateLocationMatrices();
 
-  // 5. Update the "Orientation-based" transformation matrices from the updated
+  // 4. Update the "Orientation-based" transformation matrices from the updated
   //    orientation quaternion and vLocation vector.
   UpdateBodyMatrices();
 
@@ -277,9 +297,62 @@ bool FGPropagate::Run(bool Holding)
 
   // Compute orbital parameters in the inertial frame
   ComputeOrbitalParameters();
+}
 
-  Debug(2);
-  return false;
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGPropagate::GetStateVector(vector<double>& y) const
+{
+  y.resize(StateVectorSize);
+  y[0] = epa;
+  for (unsigned int i=0; i<3; i++) {
+    y[1+i] = VState.vInertialPosition(i+1);
+    y[4+i] = VState.vInertialVelocity(i+1);
+    y[11+i] = VState.vPQRi(i+1);
+  }
+  for (unsigned int i=0; i<4; i++)
+    y[7+i] = VState.qAttitudeECI(i+1);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGPropagate::SetStateVector(const vector<double>& y)
+{
+  epa = y[0];
+  for (unsigned int i=0; i<3; i++) {
+    VState.vInertialPosition(i+1) = y[1+i];
+    VState.vInertialVelocity(i+1) = y[4+i];
+    VState.vPQRi(i+1) = y[11+i];
+  }
+  for (unsigned int i=0; i<4; i++)
+    VState.qAttitudeECI(i+1) = y[7+i];
+  VState.qAttitudeECI.Normalize();
+
+  UpdateFromInertialState();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGPropagate::GetStateVectorDerivatives(vector<double>& dydt) const
+{
+  dydt.resize(StateVectorSize);
+  dydt[0] = in.vOmegaPlanet(eZ);
+  for (unsigned int i=0; i<3; i++) {
+    dydt[1+i] = VState.vInertialVelocity(i+1);
+    dydt[4+i] = in.vUVWidot(i+1);
+    dydt[11+i] = in.vPQRidot(i+1);
+  }
+  for (unsigned int i=0; i<4; i++)
+    dydt[7+i] = VState.vQtrndot(i+1);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGPropagate::SetAdaptive(bool ad)
+{
+  // The past derivatives are not updated by the adaptive integration.
+  if (adaptive && !ad) InitializeDerivatives();
+  adaptive = ad;
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -333,150 +406,187 @@ void FGPropagate::CalculateUVW(void)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+namespace {
+
+// Increment of the integrand computed by the explicit methods from the latest
+// values of its derivative. The history is filled with the values of the
+// derivative whatever the method, so that the method can be changed at any
+// time.
+template <FGPropagate::eIntegrateType integration_type, typename T>
+inline void Increment(T& Integrand, FGHistory <T, 5>& ValDot, double dt)
+{
+  if constexpr (integration_type == FGPropagate::eRectEuler)
+    Integrand += dt*ValDot[0];
+  else if constexpr (integration_type == FGPropagate::eTrapezoidal)
+    Integrand += 0.5*dt*(ValDot[0] + ValDot[1]);
+  else if constexpr (integration_type == FGPropagate::eAdamsBashforth2)
+    Integrand += dt*(1.5*ValDot[0] - 0.5*ValDot[1]);
+  else if constexpr (integration_type == FGPropagate::eAdamsBashforth3)
+    Integrand += (1/12.0)*dt*(23.0*ValDot[0] - 16.0*ValDot[1] + 5.0*ValDot[2]);
+  else if constexpr (integration_type == FGPropagate::eAdamsBashforth4)
+    Integrand += (1/24.0)*dt*(55.0*ValDot[0] - 59.0*ValDot[1] + 37.0*ValDot[2] - 9.0*ValDot[3]);
+  else if constexpr (integration_type == FGPropagate::eAdamsBashforth5)
+    Integrand += dt*((1901./720.)*ValDot[0] - (1387./360.)*ValDot[1] + (109./30.)*ValDot[2] - (637./360.)*ValDot[3] + (251./720.)*ValDot[4]);
+  // eNone: do nothing, freeze the integrand
+}
+
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+template <FGPropagate::eIntegrateType integration_type>
 void FGPropagate::Integrate( FGColumnVector3& Integrand,
                              FGColumnVector3& Val,
-                             deque <FGColumnVector3>& ValDot,
-                             double dt,
-                             eIntegrateType integration_type)
+                             FGHistory <FGColumnVector3, 5>& ValDot,
+                             double dt)
 {
-  ValDot.push_front(Val);
-  ValDot.pop_back();
+  ValDot.push(Val);
 
-  switch(integration_type) {
-  case eRectEuler:       Integrand += dt*ValDot[0];
-    break;
-  case eTrapezoidal:     Integrand += 0.5*dt*(ValDot[0] + ValDot[1]);
-    break;
-  case eAdamsBashforth2: Integrand += dt*(1.5*ValDot[0] - 0.5*ValDot[1]);
-    break;
-  case eAdamsBashforth3: Integrand += (1/12.0)*dt*(23.0*ValDot[0] - 16.0*ValDot[1] + 5.0*ValDot[2]);
-    break;
-  case eAdamsBashforth4: Integrand += (1/24.0)*dt*(55.0*ValDot[0] - 59.0*ValDot[1] + 37.0*ValDot[2] - 9.0*ValDot[3]);
-    break;
-  case eAdamsBashforth5: Integrand += dt*((1901./720.)*ValDot[0] - (1387./360.)*ValDot[1] + (109./30.)*ValDot[2] - (637./360.)*ValDot[3] + (251./720.)*ValDot[4]);
-    break;
-  case eNone: // do nothing, freeze translational rate
-    break;
-  case eBuss1:
-  case eBuss2:
-  case eLocalLinearization:
-    {
-      LogException err;
-      err << "Can only use Buss (1 & 2) or local linearization integration methods in for rotational position!";
-      throw err;
-    }
-  default:
-    break;
+  if constexpr (integration_type == eBuss1 || integration_type == eBuss2
+                || integration_type == eLocalLinearization) {
+    LogException err;
+    err << "Can only use Buss (1 & 2) or local linearization integration methods in for rotational position!";
+    throw err;
   }
+  else
+    Increment<integration_type>(Integrand, ValDot, dt);
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+template <FGPropagate::eIntegrateType integration_type>
 void FGPropagate::Integrate( FGQuaternion& Integrand,
                              FGQuaternion& Val,
-                             deque <FGQuaternion>& ValDot,
-                             double dt,
-                             eIntegrateType integration_type)
+                             FGHistory <FGQuaternion, 5>& ValDot,
+                             double dt)
 {
-  ValDot.push_front(Val);
-  ValDot.pop_back();
-
-  switch(integration_type) {
-  case eRectEuler:       Integrand += dt*ValDot[0];
-    break;
-  case eTrapezoidal:     Integrand += 0.5*dt*(ValDot[0] + ValDot[1]);
-    break;
-  case eAdamsBashforth2: Integrand += dt*(1.5*ValDot[0] - 0.5*ValDot[1]);
-    break;
-  case eAdamsBashforth3: Integrand += (1/12.0)*dt*(23.0*ValDot[0] - 16.0*ValDot[1] + 5.0*ValDot[2]);
-    break;
-  case eAdamsBashforth4: Integrand += (1/24.0)*dt*(55.0*ValDot[0] - 59.0*ValDot[1] + 37.0*ValDot[2] - 9.0*ValDot[3]);
-    break;
-  case eAdamsBashforth5: Integrand += dt*((1901./720.)*ValDot[0] - (1387./360.)*ValDot[1] + (109./30.)*ValDot[2] - (637./360.)*ValDot[3] + (251./720.)*ValDot[4]);
-    break;
-  case eBuss1:
-    {
-      // This is the first order method as described in Samuel R. Buss paper[6].
-      // The formula from Buss' paper is transposed below to quaternions and is
-      // actually the exact solution of the quaternion differential equation
-      // qdot = 1/2*w*q when w is constant.
-      Integrand = Integrand * QExp(0.5 * dt * VState.vPQRi);
-    }
+  ValDot.push(Val);
+
+  if constexpr (integration_type == eBuss1) {
+    // This is the first order method as described in Samuel R. Buss paper[6].
+    // The formula from Buss' paper is transposed below to quaternions and is
+    // actually the exact solution of the quaternion differential equation
+    // qdot = 1/2*w*q when w is constant.
+    Integrand = Integrand * QExp(0.5 * dt * VState.vPQRi);
     return; // No need to normalize since the quaternion exponential is always normal
-  case eBuss2:
-    {
-      // This is the 'augmented second-order method' from S.R. Buss paper [6].
-      // Unlike Runge-Kutta or Adams-Bashforth, it is a one-pass second-order
-      // method (see reference [6]).
-      FGColumnVector3 wi = VState.vPQRi;
-      FGColumnVector3 wdoti = in.vPQRidot;
-      FGColumnVector3 omega = wi + 0.5*dt*wdoti + dt*dt/12.*wdoti*wi;
-      Integrand = Integrand * QExp(0.5 * dt * omega);
-    }
+  }
+  else if constexpr (integration_type == eBuss2) {
+    // This is the 'augmented second-order method' from S.R. Buss paper [6].
+    // Unlike Runge-Kutta or Adams-Bashforth, it is a one-pass second-order
+    // method (see reference [6]).
+    FGColumnVector3 wi = VState.vPQRi;
+    FGColumnVector3 wdoti = in.vPQRidot;
+    FGColumnVector3 omega = wi + 0.5*dt*wdoti + dt*dt/12.*wdoti*wi;
+    Integrand = Integrand * QExp(0.5 * dt * omega);
     return; // No need to normalize since the quaternion exponential is always normal
-  case eLocalLinearization:
-    {
-      // This is the local linearization algorithm of Barker et al. (see ref. [7])
-      // It is also a one-pass second-order method. The code below is based on the
-      // more compact formulation issued from equation (107) of ref. [8]. The
-      // constants C1, C2, C3 and C4 have the same value than those in ref. [7] pp. 11
-      FGColumnVector3 wi = 0.5 * VState.vPQRi;
-      FGColumnVector3 wdoti = 0.5 * in.vPQRidot;
-      double omegak2 = DotProduct(VState.vPQRi, VState.vPQRi);
-      double omegak = omegak2 > 1E-6 ? sqrt(omegak2) : 1E-6;
-      double rhok = 0.5 * dt * omegak;
-      double C1 = cos(rhok);
-      double C2 = 2.0 * sin(rhok) / omegak;
-      double C3 = 4.0 * (1.0 - C1) / (omegak*omegak);
-      double C4 = 4.0 * (dt - C2) / (omegak*omegak);
-      FGColumnVector3 Omega = C2*wi + C3*wdoti + C4*wi*wdoti;
-      FGQuaternion q;
-
-      q(1) = C1 - C4*DotProduct(wi, wdoti);
-      q(2) = Omega(eP);
-      q(3) = Omega(eQ);
-      q(4) = Omega(eR);
-
-      Integrand = Integrand * q;
-
-      /* Cross check with ref. [7] pp.11-12 formulas and code pp. 20
-      double pk = VState.vPQRi(eP);
-      double qk = VState.vPQRi(eQ);
-      double rk = VState.vPQRi(eR);
-      double pdotk = in.vPQRidot(eP);
-      double qdotk = in.vPQRidot(eQ);
-      double rdotk = in.vPQRidot(eR);
-      double Ap = -0.25 * (pk*pdotk + qk*qdotk + rk*rdotk);
-      double Bp = 0.25 * (pk*qdotk - qk*pdotk);
-      double Cp = 0.25 * (pdotk*rk - pk*rdotk);
-      double Dp = 0.25 * (qk*rdotk - qdotk*rk);
-      double C2p = sin(rhok) / omegak;
-      double C3p = 2.0 * (1.0 - cos(rhok)) / (omegak*omegak);
-      double H = C1 + C4 * Ap;
-      double G = -C2p*rk - C3p*rdotk + C4*Bp;
-      double J = C2p*qk + C3p*qdotk - C4*Cp;
-      double K = C2p*pk + C3p*pdotk - C4*Dp;
-
-      FGLogging log(LogLevel::INFO);
-      log << "q:       " << q << "\n";
-
-      // Warning! In the paper of Barker et al. the quaternion components are not
-      // ordered the same way as in JSBSim (see equations (2) and (3) of ref. [7]
-      // as well as the comment just below equation (3))
-      log << "FORTRAN: " << H << " , " << K << " , " << J << " , " << -G << "\n";*/
-    }
-    break; // The quaternion q is not normal so the normalization needs to be done.
-  case eNone: // do nothing, freeze rotational rate
-    break;
-  default:
-    break;
   }
+  else if constexpr (integration_type == eLocalLinearization) {
+    // This is the local linearization algorithm of Barker et al. (see ref. [7])
+    // It is also a one-pass second-order method. The code below is based on the
+    // more compact formulation issued from equation (107) of ref. [8]. The
+    // constants C1, C2, C3 and C4 have the same value than those in ref. [7] pp. 11
+    FGColumnVector3 wi = 0.5 * VState.vPQRi;
+    FGColumnVector3 wdoti = 0.5 * in.vPQRidot;
+    double omegak2 = DotProduct(VState.vPQRi, VState.vPQRi);
+    double omegak = omegak2 > 1E-6 ? sqrt(omegak2) : 1E-6;
+    double rhok = 0.5 * dt * omegak;
+    double C1 = cos(rhok);
+    double C2 = 2.0 * sin(rhok) / omegak;
+    double C3 = 4.0 * (1.0 - C1) / (omegak*omegak);
+    double C4 = 4.0 * (dt - C2) / (omegak*omegak);
+    FGColumnVector3 Omega = C2*wi + C3*wdoti + C4*wi*wdoti;
+    FGQuaternion q;
+
+    q(1) = C1 - C4*DotProduct(wi, wdoti);
+    q(2) = Omega(eP);
+    q(3) = Omega(eQ);
+    q(4) = Omega(eR);
+
+    Integrand = Integrand * q;
+
+    /* Cross check with ref. [7] pp.11-12 formulas and code pp. 20
+    double pk = VState.vPQRi(eP);
+    double qk = VState.vPQRi(eQ);
+    double rk = VState.vPQRi(eR);
+    double pdotk = in.vPQRidot(eP);
+    double qdotk = in.vPQRidot(eQ);
+    double rdotk = in.vPQRidot(eR);
+    double Ap = -0.25 * (pk*pdotk + qk*qdotk + rk*rdotk);
+    double Bp = 0.25 * (pk*qdotk - qk*pdotk);
+    double Cp = 0.25 * (pdotk*rk - pk*rdotk);
+    double Dp = 0.25 * (qk*rdotk - qdotk*rk);
+    double C2p = sin(rhok) / omegak;
+    double C3p = 2.0 * (1.0 - cos(rhok)) / (omegak*omegak);
+    double H = C1 + C4 * Ap;
+    double G = -C2p*rk - C3p*rdotk + C4*Bp;
+    double J = C2p*qk + C3p*qdotk - C4*Cp;
+    double K = C2p*pk + C3p*pdotk - C4*Dp;
+
+    FGLogging log(LogLevel::INFO);
+    log << "q:       " << q << "\n";
+
+    // Warning! In the paper of Barker et al. the quaternion components are not
+    // ordered the same way as in JSBSim (see equations (2) and (3) of ref. [7]
+    // as well as the comment just below equation (3))
+    log << "FORTRAN: " << H << " , " << K << " , " << J << " , " << -G << "\n";*/
+    // The quaternion q is not normal so the normalization needs to be done.
+  }
+  else
+    Increment<integration_type>(Integrand, ValDot, dt);
 
   Integrand.Normalize();
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+FGPropagate::VectorIntegrator
+FGPropagate::GetVectorIntegrator(eIntegrateType integration_type)
+{
+  switch(integration_type) {
+  case eRectEuler:          return &FGPropagate::Integrate<eRectEuler>;
+  case eTrapezoidal:        return &FGPropagate::Integrate<eTrapezoidal>;
+  case eAdamsBashforth2:    return &FGPropagate::Integrate<eAdamsBashforth2>;
+  case eAdamsBashforth3:    return &FGPropagate::Integrate<eAdamsBashforth3>;
+  case eAdamsBashforth4:    return &FGPropagate::Integrate<eAdamsBashforth4>;
+  case eAdamsBashforth5:    return &FGPropagate::Integrate<eAdamsBashforth5>;
+  case eBuss1:              return &FGPropagate::Integrate<eBuss1>;
+  case eBuss2:              return &FGPropagate::Integrate<eBuss2>;
+  case eLocalLinearization: return &FGPropagate::Integrate<eLocalLinearization>;
+  default:                  return &FGPropagate::Integrate<eNone>;
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGPropagate::QuaternionIntegrator
+FGPropagate::GetQuaternionIntegrator(eIntegrateType integration_type)
+{
+  switch(integration_type) {
+  case eRectEuler:          return &FGPropagate::Integrate<eRectEuler>;
+  case eTrapezoidal:        return &FGPropagate::Integrate<eTrapezoidal>;
+  case eAdamsBashforth2:    return &FGPropagate::Integrate<eAdamsBashforth2>;
+  case eAdamsBashforth3:    return &FGPropagate::Integrate<eAdamsBashforth3>;
+  case eAdamsBashforth4:    return &FGPropagate::Integrate<eAdamsBashforth4>;
+  case eAdamsBashforth5:    return &FGPropagate::Integrate<eAdamsBashforth5>;
+  case eBuss1:              return &FGPropagate::Integrate<eBuss1>;
+  case eBuss2:              return &FGPropagate::Integrate<eBuss2>;
+  case eLocalLinearization: return &FGPropagate::Integrate<eLocalLinearization>;
+  default:                  return &FGPropagate::Integrate<eNone>;
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGPropagate::SelectIntegrators(void)
+{
+  IntegrateRotationalRate = GetVectorIntegrator(integrator_rotational_rate);
+  IntegrateTranslationalRate = GetVectorIntegrator(integrator_translational_rate);
+  IntegrateRotationalPosition = GetQuaternionIntegrator(integrator_rotational_position);
+  IntegrateTranslationalPosition = GetVectorIntegrator(integrator_translational_position);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 void FGPropagate::UpdateLocationMatrices(void)
 {
   Tl2ec = VState.vLocation.GetTl2ec(); // local to ECEF transform
@@ -912,15 +1022,146 @@ void FGPropagate::bind(void)
   PropertyManager->Tie("orbital/periapsis-radius-ft", &PeriapsisRadius);
   PropertyManager->Tie("orbital/period-sec", &OrbitalPeriod);
 
-  PropertyManager->Tie("simulation/integrator/rate/rotational", (int*)&integrator_rotational_rate);
-  PropertyManager->Tie("simulation/integrator/rate/translational", (int*)&integrator_translational_rate);
-  PropertyManager->Tie("simulation/integrator/position/rotational", (int*)&integrator_rotational_position);
-  PropertyManager->Tie("simulation/integrator/position/translational", (int*)&integrator_translational_position);
+  PropertyManager->Tie("simulation/integrator/rate/rotational", this, &FGPropagate::GetRotationalRateIntegrator, &FGPropagate::SetRotationalRateIntegrator);
+  PropertyManager->Tie("simulation/integrator/rate/translational", this, &FGPropagate::GetTranslationalRateIntegrator, &FGPropagate::SetTranslationalRateIntegrator);
+  PropertyManager->Tie("simulation/integrator/position/rotational", this, &FGPropagate::GetRotationalPositionIntegrator, &FGPropagate::SetRotationalPositionIntegrator);
+  PropertyManager->Tie("simulation/integrator/position/translational", this, &FGPropagate::GetTranslationalPositionIntegrator, &FGPropagate::SetTranslationalPositionIntegrator);
+  PropertyManager->Tie("simulation/integrator/substeps", this, &FGPropagate::GetSubsteps, &FGPropagate::SetSubsteps);
+  PropertyManager->Tie("simulation/integrator/adaptive", this, &FGPropagate::GetAdaptive, &FGPropagate::SetAdaptive);
+  PropertyManager->Tie("simulation/integrator/tolerance", this, &FGPropagate::GetTolerance, &FGPropagate::SetTolerance);
+  PropertyManager->Tie("simulation/integrator/max-substeps", this, &FGPropagate::GetMaxSubsteps, &FGPropagate::SetMaxSubsteps);
+  PropertyManager->Tie("simulation/integrator/steps", this, &FGPropagate::GetStepsTaken);
 
   PropertyManager->Tie<FGPropagate, int>("simulation/write-state-file", this,
                                          nullptr, &FGPropagate::WriteStateFile);
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGPropagate::SaveState(FGStateWriter& state) const
+{
+  FGModel::SaveState(state);
+
+  state.Write(VState.vLocation);
+  state.Write(VState.vUVW);
+  state.Write(VState.vPQR);
+  state.Write(VState.vPQRi);
+  state.Write(VState.qAttitudeLocal);
+  state.Write(VState.qAttitudeECI);
+  state.Write(VState.vQtrndot);
+  state.Write(VState.vInertialVelocity);
+  state.Write(VState.vInertialPosition);
+  state.Write(VState.dqPQRidot);
+  state.Write(VState.dqUVWidot);
+  state.Write(VState.dqInertialVelocity);
+  state.Write(VState.dqQtrndot);
+
+  state.Write(vVel);
+  state.Write(Tec2b);
+  state.Write(Tb2ec);
+  state.Write(Tl2b);
+  state.Write(Tb2l);
+  state.Write(Tl2ec);
+  state.Write(Tec2l);
+  state.Write(Tec2i);
+  state.Write(Ti2ec);
+  state.Write(Ti2b);
+  state.Write(Tb2i);
+  state.Write(Ti2l);
+  state.Write(Tl2i);
+  state.Write(epa);
+
+  state.Write(h);
+  state.Write(Inclination);
+  state.Write(RightAscension);
+  state.Write(Eccentricity);
+  state.Write(PerigeeArgument);
+  state.Write(TrueAnomaly);
+  state.Write(ApoapsisRadius);
+  state.Write(PeriapsisRadius);
+  state.Write(OrbitalPeriod);
+
+  state.Write(Qec2b);
+  state.Write(LocalTerrainVelocity);
+  state.Write(LocalTerrainAngularVelocity);
+
+  state.Write(integrator_rotational_rate);
+  state.Write(integrator_translational_rate);
+  state.Write(integrator_rotational_position);
+  state.Write(integrator_translational_position);
+  state.Write(substeps);
+  state.Write(adaptive);
+  state.Write(Stepper.getTolerance());
+  state.Write(Stepper.getMaxSteps());
+  state.Write(Stepper.getStepSize());
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGPropagate::RestoreState(FGStateReader& state)
+{
+  FGModel::RestoreState(state);
+
+  state.Read(VState.vLocation);
+  state.Read(VState.vUVW);
+  state.Read(VState.vPQR);
+  state.Read(VState.vPQRi);
+  state.Read(VState.qAttitudeLocal);
+  state.Read(VState.qAttitudeECI);
+  state.Read(VState.vQtrndot);
+  state.Read(VState.vInertialVelocity);
+  state.Read(VState.vInertialPosition);
+  state.Read(VState.dqPQRidot);
+  state.Read(VState.dqUVWidot);
+  state.Read(VState.dqInertialVelocity);
+  state.Read(VState.dqQtrndot);
+
+  state.Read(vVel);
+  state.Read(Tec2b);
+  state.Read(Tb2ec);
+  state.Read(Tl2b);
+  state.Read(Tb2l);
+  state.Read(Tl2ec);
+  state.Read(Tec2l);
+  state.Read(Tec2i);
+  state.Read(Ti2ec);
+  state.Read(Ti2b);
+  state.Read(Tb2i);
+  state.Read(Ti2l);
+  state.Read(Tl2i);
+  state.Read(epa);
+
+  state.Read(h);
+  state.Read(Inclination);
+  state.Read(RightAscension);
+  state.Read(Eccentricity);
+  state.Read(PerigeeArgument);
+  state.Read(TrueAnomaly);
+  state.Read(ApoapsisRadius);
+  state.Read(PeriapsisRadius);
+  state.Read(OrbitalPeriod);
+
+  state.Read(Qec2b);
+  state.Read(LocalTerrainVelocity);
+  state.Read(LocalTerrainAngularVelocity);
+
+  state.Read(integrator_rotational_rate);
+  state.Read(integrator_translational_rate);
+  state.Read(integrator_rotational_position);
+  state.Read(integrator_translational_position);
+  state.Read(substeps);
+  state.Read(adaptive);
+
+  double tolerance, step_size;
+  int max_steps;
+  state.Read(tolerance);
+  state.Read(max_steps);
+  state.Read(step_size);
+  Stepper.setTolerance(tolerance);
+  Stepper.setMaxSteps(max_steps);
+  Stepper.setStepSize(step_size);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
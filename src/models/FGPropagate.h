@@ -38,12 +38,15 @@ SENTRY
 INCLUDES
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
+#include <algorithm>
 #include <memory>
-#include <deque>
+#include <vector>
 
 #include "models/FGModel.h"
+#include "math/FGHistory.h"
 #include "math/FGLocation.h"
 #include "math/FGQuaternion.h"
+#include "math/FGRungeKutta.h"
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 FORWARD DECLARATIONS
@@ -86,6 +89,26 @@ CLASS DOCUMENTATION
     5: Adams Bashforth 4
     @endcode
 
+    Stiff forces such as the landing gear contact forces may require a time
+    step shorter than the one needed by the rest of the simulation. The rigid
+    body equations of motion can be integrated with a shorter step while the
+    other models (FCS, aerodynamics, output, etc.) keep running at the
+    executive rate:
+
+    @code
+    simulation/integrator/substeps       number of sub-steps per time step
+    simulation/integrator/adaptive       0: fixed sub-steps, 1: Dormand-Prince
+    simulation/integrator/tolerance      relative error tolerance (adaptive)
+    simulation/integrator/max-substeps   maximum number of sub-steps (adaptive)
+    simulation/integrator/steps          sub-steps taken by the last time step
+    @endcode
+
+    At each sub-step, the ground reactions and the accelerations are updated
+    from the vehicle state while the other forces are held constant over the
+    time step (see FGFDMExec::Run). In adaptive mode, the 4 integrators above
+    are ignored: the whole state is integrated by an embedded Runge-Kutta
+    method which adjusts the sub-step size to the estimated local error.
+
     @author Jon S. Berndt, Mathias Froehlich, Bertrand Coconnier
   */
 
@@ -133,10 +156,12 @@ public:
 
     FGColumnVector3 vInertialPosition;
 
-    std::deque <FGColumnVector3> dqPQRidot;
-    std::deque <FGColumnVector3> dqUVWidot;
-    std::deque <FGColumnVector3> dqInertialVelocity;
-    std::deque <FGQuaternion>    dqQtrndot;
+    /** Past values of the derivatives, as many as the highest order
+        Adams-Bashforth integrator needs. */
+    FGHistory <FGColumnVector3, 5> dqPQRidot;
+    FGHistory <FGColumnVector3, 5> dqUVWidot;
+    FGHistory <FGColumnVector3, 5> dqInertialVelocity;
+    FGHistory <FGQuaternion, 5>    dqQtrndot;
   };
 
   /** Constructor.
@@ -163,6 +188,48 @@ public:
 
   void InitializeDerivatives();
 
+  /// Number of values in the state vector (see GetStateVector()).
+  static constexpr unsigned int StateVectorSize = 14;
+
+  /** Retrieves the state integrated by the adaptive integrator: the Earth
+      position angle, the inertial position and velocity, the orientation
+      quaternion relative to the inertial frame and the body rates relative
+      to the inertial frame.
+      @param y the state vector, resized to StateVectorSize. */
+  void GetStateVector(std::vector<double>& y) const;
+
+  /** Sets the vehicle state from a state vector and updates the quantities
+      that are derived from it (location, transformation matrices, etc.)
+      @param y the state vector (see GetStateVector()). */
+  void SetStateVector(const std::vector<double>& y);
+
+  /** Retrieves the time derivatives of the state vector computed from the
+      current state and inputs.
+      @param dydt the derivatives, resized to StateVectorSize. */
+  void GetStateVectorDerivatives(std::vector<double>& dydt) const;
+
+  /// Number of sub-steps in which the executive time step is divided.
+  int GetSubsteps(void) const { return substeps; }
+  void SetSubsteps(int n) { substeps = std::max(n, 1); }
+
+  /// Selects the adaptive Dormand-Prince integration of the state.
+  bool GetAdaptive(void) const { return adaptive; }
+  void SetAdaptive(bool ad);
+
+  /// Error tolerance of the adaptive integration.
+  double GetTolerance(void) const { return Stepper.getTolerance(); }
+  void SetTolerance(double tol) { Stepper.setTolerance(tol); }
+
+  /// Maximum number of sub-steps of the adaptive integration.
+  int GetMaxSubsteps(void) const { return Stepper.getMaxSteps(); }
+  void SetMaxSubsteps(int n) { Stepper.setMaxSteps(std::max(n, 1)); }
+
+  /// Number of sub-steps taken by the last time step.
+  int GetStepsTaken(void) const { return adaptive ? Stepper.getSteps() : substeps; }
+
+  /// Returns the adaptive integrator.
+  FGDormandPrince& GetStepper(void) { return Stepper; }
+
   /** Runs the state propagation model; called by the Executive
       Can pass in a value indicating if the executive is directing the simulation to Hold.
       @param Holding if true, the executive has been directed to hold the sim from
@@ -172,6 +239,9 @@ public:
       @return false if no error */
   bool Run(bool Holding);
 
+  void SaveState(FGStateWriter& state) const override;
+  void RestoreState(FGStateReader& state) override;
+
   /** Retrieves the velocity vector.
       The vector returned is represented by an FGColumnVector reference. The vector
       for the velocity in Local frame is organized (Vnorth, Veast, Vdown). The vector
@@ -660,22 +730,69 @@ private:
   eIntegrateType integrator_rotational_position;
   eIntegrateType integrator_translational_position;
 
+  int substeps;
+  bool adaptive;
+  FGDormandPrince Stepper;
+
   void CalculateInertialVelocity(void);
   void CalculateUVW(void);
   void CalculateQuatdot(void);
 
+  /** The integrators are instantiated for each method so that the terms of
+      the multistep methods are known at compile time. The instance used for
+      each quantity is selected when the associated property is modified. */
+  typedef void (FGPropagate::*VectorIntegrator)(FGColumnVector3&,
+                                                FGColumnVector3&,
+                                                FGHistory <FGColumnVector3, 5>&,
+                                                double);
+  typedef void (FGPropagate::*QuaternionIntegrator)(FGQuaternion&,
+                                                    FGQuaternion&,
+                                                    FGHistory <FGQuaternion, 5>&,
+                                                    double);
+
+  VectorIntegrator IntegrateRotationalRate;
+  VectorIntegrator IntegrateTranslationalRate;
+  QuaternionIntegrator IntegrateRotationalPosition;
+  VectorIntegrator IntegrateTranslationalPosition;
+
+  template <eIntegrateType integration_type>
   void Integrate( FGColumnVector3& Integrand,
                   FGColumnVector3& Val,
-                  std::deque <FGColumnVector3>& ValDot,
-                  double dt,
-                  eIntegrateType integration_type);
+                  FGHistory <FGColumnVector3, 5>& ValDot,
+                  double dt);
 
+  template <eIntegrateType integration_type>
   void Integrate( FGQuaternion& Integrand,
                   FGQuaternion& Val,
-                  std::deque <FGQuaternion>& ValDot,
-                  double dt,
-                  eIntegrateType integration_type);
+                  FGHistory <FGQuaternion, 5>& ValDot,
+                  double dt);
+
+  static VectorIntegrator GetVectorIntegrator(eIntegrateType integration_type);
+  static QuaternionIntegrator GetQuaternionIntegrator(eIntegrateType integration_type);
+  void SelectIntegrators(void);
+
+  int GetRotationalRateIntegrator(void) const { return integrator_rotational_rate; }
+  int GetTranslationalRateIntegrator(void) const { return integrator_translational_rate; }
+  int GetRotationalPositionIntegrator(void) const { return integrator_rotational_position; }
+  int GetTranslationalPositionIntegrator(void) const { return integrator_translational_position; }
+  void SetRotationalRateIntegrator(int type) {
+    integrator_rotational_rate = static_cast<eIntegrateType>(type);
+    IntegrateRotationalRate = GetVectorIntegrator(integrator_rotational_rate);
+  }
+  void SetTranslationalRateIntegrator(int type) {
+    integrator_translational_rate = static_cast<eIntegrateType>(type);
+    IntegrateTranslationalRate = GetVectorIntegrator(integrator_translational_rate);
+  }
+  void SetRotationalPositionIntegrator(int type) {
+    integrator_rotational_position = static_cast<eIntegrateType>(type);
+    IntegrateRotationalPosition = GetQuaternionIntegrator(integrator_rotational_position);
+  }
+  void SetTranslationalPositionIntegrator(int type) {
+    integrator_translational_position = static_cast<eIntegrateType>(type);
+    IntegrateTranslationalPosition = GetVectorIntegrator(integrator_translational_position);
+  }
 
+  void UpdateFromInertialState(void);
   void UpdateLocationMatrices(void);
   void UpdateBodyMatrices(void);
   void UpdateVehicleState(void);
@@ -60,6 +60,7 @@ INCLUDES
 #include "models/propulsion/FGTank.h"
 #include "models/propulsion/FGBrushLessDCMotor.h"
 #include "models/FGFCS.h"
+#include "input_output/FGStateStream.h"
 
 
 using namespace std;
@@ -859,6 +860,67 @@ void FGPropulsion::bind(void)
                                            nullptr, &FGPropulsion::SetFuelFreeze);
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGPropulsion::SaveState(FGStateWriter& state) const
+{
+  FGModel::SaveState(state);
+
+  state.Write(ActiveEngine);
+  state.Write(vForces);
+  state.Write(vMoments);
+  state.Write(vTankXYZ);
+  state.Write(vXYZtank_arm);
+  state.Write(tankJ);
+  state.Write(refuel);
+  state.Write(dump);
+  state.Write(FuelFreeze);
+  state.Write(TotalFuelQuantity);
+  state.Write(TotalOxidizerQuantity);
+  state.Write(DumpRate);
+  state.Write(RefuelRate);
+
+  state.Write(static_cast<uint32_t>(Engines.size()));
+  for (auto& engine: Engines)
+    engine->SaveState(state);
+
+  state.Write(static_cast<uint32_t>(Tanks.size()));
+  for (auto& tank: Tanks)
+    tank->SaveState(state);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGPropulsion::RestoreState(FGStateReader& state)
+{
+  FGModel::RestoreState(state);
+
+  state.Read(ActiveEngine);
+  state.Read(vForces);
+  state.Read(vMoments);
+  state.Read(vTankXYZ);
+  state.Read(vXYZtank_arm);
+  state.Read(tankJ);
+  state.Read(refuel);
+  state.Read(dump);
+  state.Read(FuelFreeze);
+  state.Read(TotalFuelQuantity);
+  state.Read(TotalOxidizerQuantity);
+  state.Read(DumpRate);
+  state.Read(RefuelRate);
+
+  uint32_t count;
+  state.Read(count);
+  state.CheckCount(count, Engines.size());
+  for (auto& engine: Engines)
+    engine->RestoreState(state);
+
+  state.Read(count);
+  state.CheckCount(count, Tanks.size());
+  for (auto& tank: Tanks)
+    tank->RestoreState(state);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
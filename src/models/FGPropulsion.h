@@ -114,6 +114,9 @@ public:
       @return false if no error */
   bool Run(bool Holding) override;
 
+  void SaveState(FGStateWriter& state) const override;
+  void RestoreState(FGStateReader& state) override;
+
   bool InitModel(void) override;
 
   /** Loads the propulsion system (engine[s] and tank[s]).
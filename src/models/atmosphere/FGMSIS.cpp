@@ -58,6 +58,8 @@ HISTORY
 INCLUDES
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
+#include <mutex>
+
 #include "FGFDMExec.h"
 #include "FGMSIS.h"
 #include "input_output/FGLog.h"
@@ -66,6 +68,11 @@ using namespace std;
 
 namespace JSBSim {
 
+// NRLMSISE-00 keeps its intermediate results in file scope static variables so
+// the calls to gtd7() must be serialized between the FGFDMExec instances that
+// are running in different threads.
+static mutex msis_mutex;
+
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 CLASS IMPLEMENTATION
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
@@ -176,7 +183,10 @@ void FGMSIS::Compute(double altitude, double& pressure, double& temperature,
   input.lst = utc_seconds/3600 + lon/15;  // Local Solar Time (hours)
   assert(flags.switches[9] != -1);        // Make sure that input.ap is used.
 
-  gtd7(&input, &flags, &output);
+  {
+    lock_guard<mutex> lock(msis_mutex);
+    gtd7(&input, &flags, &output);
+  }
 
   temperature = KelvinToRankine(output.t[1]);
   density = output.d[5] * kgm3_to_slugft3;
@@ -47,6 +47,7 @@ INCLUDES
 #include "FGFDMExec.h"
 #include "math/FGTable.h"
 #include "input_output/FGLog.h"
+#include "input_output/FGStateStream.h"
 
 using namespace std;
 
@@ -590,6 +591,160 @@ void FGWinds::bind(void)
   PropertyManager->Tie("atmosphere/randomseed", this, &FGWinds::GetRandomSeed, &FGWinds::SetRandomSeed);
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGWinds::SaveState(FGStateWriter& state) const
+{
+  FGModel::SaveState(state);
+
+  state.Write(turbType);
+  state.Write(MagnitudedAccelDt);
+  state.Write(MagnitudeAccel);
+  state.Write(Magnitude);
+  state.Write(TurbDirection);
+  state.Write(TurbGain);
+  state.Write(TurbRate);
+  state.Write(Rhythmicity);
+  state.Write(wind_from_clockwise);
+  state.Write(spike);
+  state.Write(target_time);
+  state.Write(strength);
+  state.Write(vTurbulenceGrad);
+  state.Write(vBodyTurbGrad);
+  state.Write(vTurbPQR);
+
+  state.Write(oneMinusCosineGust.vWind);
+  state.Write(oneMinusCosineGust.vWindTransformed);
+  state.Write(oneMinusCosineGust.magnitude);
+  state.Write(oneMinusCosineGust.gustFrame);
+  state.Write(oneMinusCosineGust.gustProfile);
+
+  state.Write(static_cast<uint32_t>(UpDownBurstCells.size()));
+  for (auto cell: UpDownBurstCells) {
+    state.Write(cell->ringLatitude);
+    state.Write(cell->ringLongitude);
+    state.Write(cell->ringAltitude);
+    state.Write(cell->ringRadius);
+    state.Write(cell->ringCoreRadius);
+    state.Write(cell->circulation);
+    state.Write(cell->oneMCosineProfile);
+  }
+
+  state.Write(windspeed_at_20ft);
+  state.Write(probability_of_exceedence_index);
+  state.Write(xi_u_km1);
+  state.Write(nu_u_km1);
+  state.Write(xi_v_km1);
+  state.Write(xi_v_km2);
+  state.Write(nu_v_km1);
+  state.Write(nu_v_km2);
+  state.Write(xi_w_km1);
+  state.Write(xi_w_km2);
+  state.Write(nu_w_km1);
+  state.Write(nu_w_km2);
+  state.Write(xi_p_km1);
+  state.Write(nu_p_km1);
+  state.Write(xi_q_km1);
+  state.Write(xi_r_km1);
+
+  state.Write(psiw);
+  state.Write(vTotalWindNED);
+  state.Write(vWindNED);
+  state.Write(vGustNED);
+  state.Write(vCosineGust);
+  state.Write(vBurstGust);
+  state.Write(vTurbulenceNED);
+
+  // The random number generator of the executive is saved by FGFDMExec.
+  state.Write(RandomSeed.has_value());
+  if (RandomSeed) {
+    state.Write(*RandomSeed);
+    state.Write(generator->GetState());
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGWinds::RestoreState(FGStateReader& state)
+{
+  FGModel::RestoreState(state);
+
+  state.Read(turbType);
+  state.Read(MagnitudedAccelDt);
+  state.Read(MagnitudeAccel);
+  state.Read(Magnitude);
+  state.Read(TurbDirection);
+  state.Read(TurbGain);
+  state.Read(TurbRate);
+  state.Read(Rhythmicity);
+  state.Read(wind_from_clockwise);
+  state.Read(spike);
+  state.Read(target_time);
+  state.Read(strength);
+  state.Read(vTurbulenceGrad);
+  state.Read(vBodyTurbGrad);
+  state.Read(vTurbPQR);
+
+  state.Read(oneMinusCosineGust.vWind);
+  state.Read(oneMinusCosineGust.vWindTransformed);
+  state.Read(oneMinusCosineGust.magnitude);
+  state.Read(oneMinusCosineGust.gustFrame);
+  state.Read(oneMinusCosineGust.gustProfile);
+
+  uint32_t cells;
+  state.Read(cells);
+  state.CheckCount(cells, UpDownBurstCells.size());
+  for (auto cell: UpDownBurstCells) {
+    state.Read(cell->ringLatitude);
+    state.Read(cell->ringLongitude);
+    state.Read(cell->ringAltitude);
+    state.Read(cell->ringRadius);
+    state.Read(cell->ringCoreRadius);
+    state.Read(cell->circulation);
+    state.Read(cell->oneMCosineProfile);
+  }
+
+  state.Read(windspeed_at_20ft);
+  state.Read(probability_of_exceedence_index);
+  state.Read(xi_u_km1);
+  state.Read(nu_u_km1);
+  state.Read(xi_v_km1);
+  state.Read(xi_v_km2);
+  state.Read(nu_v_km1);
+  state.Read(nu_v_km2);
+  state.Read(xi_w_km1);
+  state.Read(xi_w_km2);
+  state.Read(nu_w_km1);
+  state.Read(nu_w_km2);
+  state.Read(xi_p_km1);
+  state.Read(nu_p_km1);
+  state.Read(xi_q_km1);
+  state.Read(xi_r_km1);
+
+  state.Read(psiw);
+  state.Read(vTotalWindNED);
+  state.Read(vWindNED);
+  state.Read(vGustNED);
+  state.Read(vCosineGust);
+  state.Read(vBurstGust);
+  state.Read(vTurbulenceNED);
+
+  bool ownGenerator;
+  state.Read(ownGenerator);
+  if (ownGenerator) {
+    unsigned int seed;
+    std::string generatorState;
+    state.Read(seed);
+    state.Read(generatorState);
+    SetRandomSeed(seed);
+    generator->SetState(generatorState);
+  }
+  else if (RandomSeed) {
+    RandomSeed.reset();
+    generator = FDMExec->GetRandomGenerator();
+  }
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
@@ -179,6 +179,10 @@ public:
                      on a socket for the "Resume" command to be given.
       @return false if no error */
   bool Run(bool Holding) override;
+
+  void SaveState(FGStateWriter& state) const override;
+  void RestoreState(FGStateReader& state) override;
+
   bool InitModel(void) override;
   enum tType {ttNone, ttStandard, ttCulp, ttMilspec, ttTustin} turbType;
 
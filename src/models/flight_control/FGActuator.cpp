@@ -42,6 +42,7 @@ INCLUDES
 #include "math/FGParameterValue.h"
 #include "models/FGFCS.h"
 #include "input_output/FGLog.h"
+#include "input_output/FGStateStream.h"
 
 using namespace std;
 
@@ -312,6 +313,48 @@ void FGActuator::InitializeLagCoefficients()
   cb = (2.00 - dt * lagVal) / denom;
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGActuator::SaveState(FGStateWriter& state) const
+{
+  FGFCSComponent::SaveState(state);
+
+  state.Write(lagVal);
+  state.Write(ca);
+  state.Write(cb);
+  state.Write(PreviousOutput);
+  state.Write(PreviousHystOutput);
+  state.Write(PreviousRateLimOutput);
+  state.Write(PreviousLagInput);
+  state.Write(PreviousLagOutput);
+  state.Write(fail_zero);
+  state.Write(fail_hardover);
+  state.Write(fail_stuck);
+  state.Write(initialized);
+  state.Write(saturated);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGActuator::RestoreState(FGStateReader& state)
+{
+  FGFCSComponent::RestoreState(state);
+
+  state.Read(lagVal);
+  state.Read(ca);
+  state.Read(cb);
+  state.Read(PreviousOutput);
+  state.Read(PreviousHystOutput);
+  state.Read(PreviousRateLimOutput);
+  state.Read(PreviousLagInput);
+  state.Read(PreviousLagOutput);
+  state.Read(fail_zero);
+  state.Read(fail_hardover);
+  state.Read(fail_stuck);
+  state.Read(initialized);
+  state.Read(saturated);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
@@ -138,6 +138,9 @@ public:
   bool Run (void) override;
   void ResetPastStates(void) override;
 
+  void SaveState(FGStateWriter& state) const override;
+  void RestoreState(FGStateReader& state) override;
+
   // these may need to have the bool argument replaced with a double
   /** This function fails the actuator to zero. The motion to zero
       will flow through the lag, hysteresis, and rate limiting
@@ -41,6 +41,7 @@ INCLUDES
 #include "models/FGFCS.h"
 #include "math/FGParameterValue.h"
 #include "input_output/FGLog.h"
+#include "input_output/FGStateStream.h"
 
 using namespace std;
 
@@ -216,6 +217,28 @@ void FGFCSComponent::ResetPastStates(void)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGFCSComponent::SaveState(FGStateWriter& state) const
+{
+  state.Section(Name);
+  state.Write(Input);
+  state.Write(Output);
+  state.Write(output_array);
+  state.Write(index);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGFCSComponent::RestoreState(FGStateReader& state)
+{
+  state.Section(Name);
+  state.Read(Input);
+  state.Read(Output);
+  state.ReadFixed(output_array);
+  state.Read(index);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 void FGFCSComponent::CheckInputNodes(size_t MinNodes, size_t MaxNodes, Element* el)
 {
   size_t num = InputNodes.size();
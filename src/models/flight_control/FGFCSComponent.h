@@ -48,6 +48,8 @@ namespace JSBSim {
 
 class FGFCS;
 class Element;
+class FGStateWriter;
+class FGStateReader;
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 CLASS DOCUMENTATION
@@ -96,6 +98,12 @@ public:
   std::string GetType(void) const { return Type; }
   virtual double GetOutputPct(void) const { return 0; }
   virtual void ResetPastStates(void);
+  /** Saves the past states of the component.
+      The components that maintain additional past states must override this
+      method and call the base class method first. */
+  virtual void SaveState(FGStateWriter& state) const;
+  /// Restores the past states of the component saved by SaveState().
+  virtual void RestoreState(FGStateReader& state);
 
 protected:
   FGFCS* fcs;
@@ -41,6 +41,7 @@ INCLUDES
 #include "models/FGFCS.h"
 #include "math/FGParameterValue.h"
 #include "input_output/FGLog.h"
+#include "input_output/FGStateStream.h"
 
 using namespace std;
 
@@ -195,6 +196,42 @@ bool FGFilter::Run(void)
   return true;
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGFilter::SaveState(FGStateWriter& state) const
+{
+  FGFCSComponent::SaveState(state);
+
+  state.Write(Initialize);
+  state.Write(ca);
+  state.Write(cb);
+  state.Write(cc);
+  state.Write(cd);
+  state.Write(ce);
+  state.Write(PreviousInput1);
+  state.Write(PreviousInput2);
+  state.Write(PreviousOutput1);
+  state.Write(PreviousOutput2);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGFilter::RestoreState(FGStateReader& state)
+{
+  FGFCSComponent::RestoreState(state);
+
+  state.Read(Initialize);
+  state.Read(ca);
+  state.Read(cb);
+  state.Read(cc);
+  state.Read(cd);
+  state.Read(ce);
+  state.Read(PreviousInput1);
+  state.Read(PreviousInput2);
+  state.Read(PreviousOutput1);
+  state.Read(PreviousOutput2);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
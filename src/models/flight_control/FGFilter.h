@@ -222,6 +222,9 @@ public:
 
   void ResetPastStates(void) override;
 
+  void SaveState(FGStateWriter& state) const override;
+  void RestoreState(FGStateReader& state) override;
+
 private:
   bool DynamicFilter;
   /** When true, causes previous values to be set to current values. This
@@ -41,6 +41,7 @@ INCLUDES
 #include "models/FGFCS.h"
 #include "math/FGParameterValue.h"
 #include "input_output/FGLog.h"
+#include "input_output/FGStateStream.h"
 
 using namespace std;
 
@@ -280,4 +281,39 @@ void FGLinearActuator::Debug(int from)
     }
   }
 }
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGLinearActuator::SaveState(FGStateWriter& state) const
+{
+  FGFCSComponent::SaveState(state);
+
+  state.Write(set);
+  state.Write(reset);
+  state.Write(direction);
+  state.Write(countSpin);
+  state.Write(versus);
+  state.Write(bias);
+  state.Write(inputLast);
+  state.Write(inputMem);
+  state.Write(previousLagInput);
+  state.Write(previousLagOutput);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGLinearActuator::RestoreState(FGStateReader& state)
+{
+  FGFCSComponent::RestoreState(state);
+
+  state.Read(set);
+  state.Read(reset);
+  state.Read(direction);
+  state.Read(countSpin);
+  state.Read(versus);
+  state.Read(bias);
+  state.Read(inputLast);
+  state.Read(inputMem);
+  state.Read(previousLagInput);
+  state.Read(previousLagOutput);
+}
 }
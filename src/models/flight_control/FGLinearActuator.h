@@ -229,6 +229,9 @@ public:
 
   /// The execution method for this FCS component.
   bool Run(void) override;
+
+  void SaveState(FGStateWriter& state) const override;
+  void RestoreState(FGStateReader& state) override;
         
 private:
   FGParameter_ptr ptrSet;
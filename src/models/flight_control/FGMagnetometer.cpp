@@ -37,15 +37,23 @@ COMMENTS, REFERENCES,  and NOTES
 INCLUDES
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
+#include <mutex>
+
 #include "FGMagnetometer.h"
 #include "simgear/magvar/coremag.hxx"
 #include "models/FGFCS.h"
 #include "models/FGMassBalance.h"
+#include "input_output/FGStateStream.h"
 
 using namespace std;
 
 namespace JSBSim {
 
+// calc_magvar() stores its Legendre polynomials and model coefficients in file
+// scope static arrays so the calls must be serialized between the FGFDMExec
+// instances that are running in different threads.
+static mutex magvar_mutex;
+
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 CLASS IMPLEMENTATION
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
@@ -119,6 +127,7 @@ void FGMagnetometer::updateInertialMag(void)
     usedAlt = (Propagate->GetGeodeticAltitude()*fttom*0.001);//km
 
     //this should be done whenever the position changes significantly (in nTesla)
+    lock_guard<mutex> lock(magvar_mutex);
     calc_magvar( usedLat, usedLon, usedAlt, date, field );
   }
 }
@@ -148,6 +157,32 @@ bool FGMagnetometer::Run(void )
   return true;
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGMagnetometer::SaveState(FGStateWriter& state) const
+{
+  FGSensor::SaveState(state);
+
+  state.Write(field);
+  state.Write(usedLat);
+  state.Write(usedLon);
+  state.Write(usedAlt);
+  state.Write(counter);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGMagnetometer::RestoreState(FGStateReader& state)
+{
+  FGSensor::RestoreState(state);
+
+  state.Read(field);
+  state.Read(usedLat);
+  state.Read(usedLon);
+  state.Read(usedAlt);
+  state.Read(counter);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
@@ -127,6 +127,9 @@ public:
   bool Run (void) override;
   void ResetPastStates(void) override;
 
+  void SaveState(FGStateWriter& state) const override;
+  void RestoreState(FGStateReader& state) override;
+
 private:
   std::shared_ptr<FGPropagate> Propagate;
   std::shared_ptr<FGMassBalance> MassBalance;
@@ -39,6 +39,7 @@ INCLUDES
 #include "models/FGFCS.h"
 #include "math/FGParameterValue.h"
 #include "input_output/FGLog.h"
+#include "input_output/FGStateStream.h"
 
 using namespace std;
 
@@ -211,6 +212,28 @@ bool FGPID::Run(void )
   return true;
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGPID::SaveState(FGStateWriter& state) const
+{
+  FGFCSComponent::SaveState(state);
+
+  state.Write(I_out_total);
+  state.Write(Input_prev);
+  state.Write(Input_prev2);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGPID::RestoreState(FGStateReader& state)
+{
+  FGFCSComponent::RestoreState(state);
+
+  state.Read(I_out_total);
+  state.Read(Input_prev);
+  state.Read(Input_prev2);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
@@ -131,6 +131,9 @@ public:
   bool Run (void) override;
   void ResetPastStates(void) override;
 
+  void SaveState(FGStateWriter& state) const override;
+  void RestoreState(FGStateReader& state) override;
+
     /// These define the indices use to select the various integrators.
   enum eIntegrateType {eNone = 0, eRectEuler, eTrapezoidal, eAdamsBashforth2,
                        eAdamsBashforth3};
@@ -41,6 +41,7 @@ INCLUDES
 #include "models/FGFCS.h"
 #include "input_output/FGXMLElement.h"
 #include "input_output/FGLog.h"
+#include "input_output/FGStateStream.h"
 
 using namespace std;
 
@@ -300,6 +301,56 @@ int FGSensor::GetNoiseRandomSeed(void) const
     return fcs->GetExec()->SRand();
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGSensor::SaveState(FGStateWriter& state) const
+{
+  FGFCSComponent::SaveState(state);
+
+  state.Write(drift);
+  state.Write(PreviousOutput);
+  state.Write(PreviousInput);
+  state.Write(fail_low);
+  state.Write(fail_high);
+  state.Write(fail_stuck);
+
+  // The random number generator of the executive is saved by FGFDMExec.
+  state.Write(RandomSeed.has_value());
+  if (RandomSeed) {
+    state.Write(*RandomSeed);
+    state.Write(generator->GetState());
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGSensor::RestoreState(FGStateReader& state)
+{
+  FGFCSComponent::RestoreState(state);
+
+  state.Read(drift);
+  state.Read(PreviousOutput);
+  state.Read(PreviousInput);
+  state.Read(fail_low);
+  state.Read(fail_high);
+  state.Read(fail_stuck);
+
+  bool ownGenerator;
+  state.Read(ownGenerator);
+  if (ownGenerator) {
+    unsigned int seed;
+    std::string generatorState;
+    state.Read(seed);
+    state.Read(generatorState);
+    SetNoiseRandomSeed(seed);
+    generator->SetState(generatorState);
+  }
+  else if (RandomSeed) {
+    RandomSeed.reset();
+    generator = fcs->GetExec()->GetRandomGenerator();
+  }
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
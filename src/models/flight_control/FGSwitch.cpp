@@ -66,6 +66,7 @@ INCLUDES
 #include "math/FGCondition.h"
 #include "input_output/FGLog.h"
 #include "math/FGRealValue.h"
+#include "input_output/FGStateStream.h"
 
 using namespace std;
 
@@ -181,6 +182,22 @@ void FGSwitch::VerifyProperties(void)
   }
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGSwitch::SaveState(FGStateWriter& state) const
+{
+  FGFCSComponent::SaveState(state);
+  state.Write(initialized);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGSwitch::RestoreState(FGStateReader& state)
+{
+  FGFCSComponent::RestoreState(state);
+  state.Read(initialized);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
@@ -143,6 +143,9 @@ public:
       @return true - always*/
   bool Run(void) override;
 
+  void SaveState(FGStateWriter& state) const override;
+  void RestoreState(FGStateReader& state) override;
+
 private:
 
   struct Test {
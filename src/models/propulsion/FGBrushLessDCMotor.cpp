@@ -53,6 +53,7 @@ INCLUDES
 #include "FGBrushLessDCMotor.h"
 #include "FGPropeller.h"
 #include "input_output/FGXMLElement.h"
+#include "input_output/FGStateStream.h"
 
 using namespace std;
 
@@ -231,4 +232,23 @@ void FGBrushLessDCMotor::Debug(int from)
   }
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGBrushLessDCMotor::SaveState(FGStateWriter& state) const
+{
+  FGEngine::SaveState(state);
+
+  state.Write(HP);
+  state.Write(Current);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGBrushLessDCMotor::RestoreState(FGStateReader& state)
+{
+  FGEngine::RestoreState(state);
+
+  state.Read(HP);
+  state.Read(Current);
+}
 } // namespace JSBSim
@@ -87,6 +87,10 @@ public:
   ~FGBrushLessDCMotor();
 
   void Calculate(void);
+
+  void SaveState(FGStateWriter& state) const;
+  void RestoreState(FGStateReader& state);
+
   double GetPowerAvailable(void) const {return (HP * hptoftlbssec);}
   double CalcFuelNeed(void) { return 0.; }
   std::string GetEngineLabels(const std::string& delimiter);
@@ -46,6 +46,7 @@ INCLUDES
 #include "FGElectric.h"
 #include "FGPropeller.h"
 #include "input_output/FGXMLElement.h"
+#include "input_output/FGStateStream.h"
 
 using namespace std;
 
@@ -184,4 +185,23 @@ void FGElectric::Debug(int from)
   }
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGElectric::SaveState(FGStateWriter& state) const
+{
+  FGEngine::SaveState(state);
+
+  state.Write(RPM);
+  state.Write(HP);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGElectric::RestoreState(FGStateReader& state)
+{
+  FGEngine::RestoreState(state);
+
+  state.Read(RPM);
+  state.Read(HP);
+}
 } // namespace JSBSim
@@ -73,6 +73,10 @@ public:
   ~FGElectric();
 
   void Calculate(void);
+
+  void SaveState(FGStateWriter& state) const;
+  void RestoreState(FGStateReader& state);
+
   double GetPowerAvailable(void) const {return (HP * hptoftlbssec);}
   double getRPM(void) {return RPM;}
   std::string GetEngineLabels(const std::string& delimiter);
@@ -43,6 +43,7 @@ INCLUDES
 #include "FGNozzle.h"
 #include "FGRotor.h"
 #include "input_output/FGXMLElement.h"
+#include "input_output/FGStateStream.h"
 
 using namespace std;
 
@@ -250,6 +251,50 @@ bool FGEngine::Load(FGFDMExec *exec, Element *engine_element)
   return true;
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGEngine::SaveState(FGStateWriter& state) const
+{
+  state.Section(Name);
+  state.Write(FuelExpended);
+  state.Write(FuelFlowRate);
+  state.Write(PctPower);
+  state.Write(Starter);
+  state.Write(Starved);
+  state.Write(Running);
+  state.Write(Cranking);
+  state.Write(FuelFreeze);
+  state.Write(FuelFlow_gph);
+  state.Write(FuelFlow_pph);
+  state.Write(FuelUsedLbs);
+  state.Write(FuelDensity);
+  state.Write(SourceTanks);
+
+  Thruster->SaveState(state);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGEngine::RestoreState(FGStateReader& state)
+{
+  state.Section(Name);
+  state.Read(FuelExpended);
+  state.Read(FuelFlowRate);
+  state.Read(PctPower);
+  state.Read(Starter);
+  state.Read(Starved);
+  state.Read(Running);
+  state.Read(Cranking);
+  state.Read(FuelFreeze);
+  state.Read(FuelFlow_gph);
+  state.Read(FuelFlow_pph);
+  state.Read(FuelUsedLbs);
+  state.Read(FuelDensity);
+  state.Read(SourceTanks);
+
+  Thruster->RestoreState(state);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
@@ -59,6 +59,8 @@ class FGFDMExec;
 class FGThruster;
 class Element;
 class FGPropertyManager;
+class FGStateWriter;
+class FGStateReader;
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 CLASS DOCUMENTATION
@@ -167,6 +169,9 @@ public:
   /** Resets the Engine parameters to the initial conditions */
   virtual void ResetToIC(void);
 
+  virtual void SaveState(FGStateWriter& state) const;
+  virtual void RestoreState(FGStateReader& state);
+
   /** Calculates the thrust of the engine, and other engine functions. */
   virtual void Calculate(void) = 0;
 
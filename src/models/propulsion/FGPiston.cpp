@@ -47,6 +47,7 @@ INCLUDES
 #include "FGPiston.h"
 #include "FGPropeller.h"
 #include "input_output/FGXMLElement.h"
+#include "input_output/FGStateStream.h"
 
 using namespace std;
 
@@ -1081,4 +1082,87 @@ void FGPiston::Debug(int from)
     }
   }
 }
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGPiston::SaveState(FGStateWriter& state) const
+{
+  FGEngine::SaveState(state);
+
+  state.Write(crank_counter);
+  state.Write(IndicatedHorsePower);
+  state.Write(PMEP);
+  state.Write(FMEP);
+  state.Write(FMEPDynamic);
+  state.Write(FMEPStatic);
+  state.Write(BoostSpeed);
+  state.Write(MAP);
+  state.Write(TMAP);
+  state.Write(p_amb);
+  state.Write(p_ram);
+  state.Write(T_amb);
+  state.Write(RPM);
+  state.Write(IAS);
+  state.Write(Magneto_Left);
+  state.Write(Magneto_Right);
+  state.Write(Magnetos);
+  state.Write(rho_air);
+  state.Write(volumetric_efficiency);
+  state.Write(volumetric_efficiency_reduced);
+  state.Write(m_dot_air);
+  state.Write(v_dot_air);
+  state.Write(equivalence_ratio);
+  state.Write(m_dot_fuel);
+  state.Write(HP);
+  state.Write(BoostLossHP);
+  state.Write(combustion_efficiency);
+  state.Write(ExhaustGasTemp_degK);
+  state.Write(EGT_degC);
+  state.Write(ManifoldPressure_inHg);
+  state.Write(CylinderHeadTemp_degK);
+  state.Write(OilPressure_psi);
+  state.Write(OilTemp_degK);
+  state.Write(MeanPistonSpeed_fps);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGPiston::RestoreState(FGStateReader& state)
+{
+  FGEngine::RestoreState(state);
+
+  state.Read(crank_counter);
+  state.Read(IndicatedHorsePower);
+  state.Read(PMEP);
+  state.Read(FMEP);
+  state.Read(FMEPDynamic);
+  state.Read(FMEPStatic);
+  state.Read(BoostSpeed);
+  state.Read(MAP);
+  state.Read(TMAP);
+  state.Read(p_amb);
+  state.Read(p_ram);
+  state.Read(T_amb);
+  state.Read(RPM);
+  state.Read(IAS);
+  state.Read(Magneto_Left);
+  state.Read(Magneto_Right);
+  state.Read(Magnetos);
+  state.Read(rho_air);
+  state.Read(volumetric_efficiency);
+  state.Read(volumetric_efficiency_reduced);
+  state.Read(m_dot_air);
+  state.Read(v_dot_air);
+  state.Read(equivalence_ratio);
+  state.Read(m_dot_fuel);
+  state.Read(HP);
+  state.Read(BoostLossHP);
+  state.Read(combustion_efficiency);
+  state.Read(ExhaustGasTemp_degK);
+  state.Read(EGT_degC);
+  state.Read(ManifoldPressure_inHg);
+  state.Read(CylinderHeadTemp_degK);
+  state.Read(OilPressure_psi);
+  state.Read(OilTemp_degK);
+  state.Read(MeanPistonSpeed_fps);
+}
 } // namespace JSBSim
@@ -236,6 +236,10 @@ public:
   double CalcFuelNeed(void);
 
   void ResetToIC(void);
+
+  void SaveState(FGStateWriter& state) const;
+  void RestoreState(FGStateReader& state);
+
   void SetMagnetos(int magnetos) {Magnetos = magnetos;}
 
   double  GetEGT(void) const { return EGT_degC; }
@@ -39,6 +39,7 @@ INCLUDES
 #include "FGPropeller.h"
 #include "input_output/FGXMLElement.h"
 #include "input_output/FGLog.h"
+#include "input_output/FGStateStream.h"
 
 using namespace std;
 
@@ -419,6 +420,44 @@ string FGPropeller::GetThrusterValues(int id, const string& delimeter)
   return buf.str();
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGPropeller::SaveState(FGStateWriter& state) const
+{
+  FGThruster::SaveState(state);
+
+  state.Write(J);
+  state.Write(RPM);
+  state.Write(Pitch);
+  state.Write(Advance);
+  state.Write(ExcessTorque);
+  state.Write(HelicalTipMach);
+  state.Write(Vinduced);
+  state.Write(vTorque);
+  state.Write(Reversed);
+  state.Write(Reverse_coef);
+  state.Write(Feathered);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGPropeller::RestoreState(FGStateReader& state)
+{
+  FGThruster::RestoreState(state);
+
+  state.Read(J);
+  state.Read(RPM);
+  state.Read(Pitch);
+  state.Read(Advance);
+  state.Read(ExcessTorque);
+  state.Read(HelicalTipMach);
+  state.Read(Vinduced);
+  state.Read(vTorque);
+  state.Read(Reversed);
+  state.Read(Reverse_coef);
+  state.Read(Feathered);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
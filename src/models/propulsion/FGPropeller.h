@@ -181,6 +181,9 @@ public:
   /// Reset the initial conditions.
   void ResetToIC(void);
 
+  void SaveState(FGStateWriter& state) const;
+  void RestoreState(FGStateReader& state);
+
   /** Sets the Revolutions Per Minute for the propeller. Normally the propeller
       instance will calculate its own rotational velocity, given the Torque
       produced by the engine and integrating over time using the standard
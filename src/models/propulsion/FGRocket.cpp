@@ -42,6 +42,7 @@ INCLUDES
 #include "FGRocket.h"
 #include "FGThruster.h"
 #include "input_output/FGXMLElement.h"
+#include "input_output/FGStateStream.h"
 
 using namespace std;
 
@@ -312,6 +313,50 @@ void FGRocket::bindmodel(FGPropertyManager* PropertyManager)
   }
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGRocket::SaveState(FGStateWriter& state) const
+{
+  FGEngine::SaveState(state);
+
+  state.Write(Isp);
+  state.Write(It);
+  state.Write(ItVac);
+  state.Write(MxR);
+  state.Write(ThrustVariation);
+  state.Write(TotalIspVariation);
+  state.Write(VacThrust);
+  state.Write(previousFuelNeedPerTank);
+  state.Write(previousOxiNeedPerTank);
+  state.Write(OxidizerExpended);
+  state.Write(TotalPropellantExpended);
+  state.Write(OxidizerFlowRate);
+  state.Write(PropellantFlowRate);
+  state.Write(Flameout);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGRocket::RestoreState(FGStateReader& state)
+{
+  FGEngine::RestoreState(state);
+
+  state.Read(Isp);
+  state.Read(It);
+  state.Read(ItVac);
+  state.Read(MxR);
+  state.Read(ThrustVariation);
+  state.Read(TotalIspVariation);
+  state.Read(VacThrust);
+  state.Read(previousFuelNeedPerTank);
+  state.Read(previousOxiNeedPerTank);
+  state.Read(OxidizerExpended);
+  state.Read(TotalPropellantExpended);
+  state.Read(OxidizerFlowRate);
+  state.Read(PropellantFlowRate);
+  state.Read(Flameout);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
@@ -137,6 +137,9 @@ public:
   /** Determines the thrust.*/
   void Calculate(void);
 
+  void SaveState(FGStateWriter& state) const;
+  void RestoreState(FGStateReader& state);
+
   /** The fuel need is calculated based on power levels and flow rate for that
       power level. It is also turned from a rate into an actual amount (pounds)
       by multiplying it by the delta T and the rate.
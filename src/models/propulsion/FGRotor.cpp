@@ -49,6 +49,7 @@ INCLUDES
 #include "input_output/FGXMLElement.h"
 #include "input_output/string_utilities.h"
 #include "input_output/FGLog.h"
+#include "input_output/FGStateStream.h"
 
 using std::string;
 using std::ostringstream;
@@ -816,6 +817,76 @@ string FGRotor::GetThrusterValues(int id, const string& delimeter)
 
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGRotor::SaveState(FGStateWriter& state) const
+{
+  FGThruster::SaveState(state);
+
+  state.Write(rho);
+  state.Write(damp_hagl);
+  state.Write(RPM);
+  state.Write(Omega);
+  state.Write(beta_orient);
+  state.Write(a0);
+  state.Write(a_1);
+  state.Write(b_1);
+  state.Write(a_dw);
+  state.Write(a1s);
+  state.Write(b1s);
+  state.Write(H_drag);
+  state.Write(J_side);
+  state.Write(Torque);
+  state.Write(C_T);
+  state.Write(lambda);
+  state.Write(mu);
+  state.Write(nu);
+  state.Write(v_induced);
+  state.Write(theta_downwash);
+  state.Write(phi_downwash);
+  state.Write(CollectiveCtrl);
+  state.Write(LateralCtrl);
+  state.Write(LongitudinalCtrl);
+  state.Write(EngineRPM);
+
+  if (Transmission) Transmission->SaveState(state);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGRotor::RestoreState(FGStateReader& state)
+{
+  FGThruster::RestoreState(state);
+
+  state.Read(rho);
+  state.Read(damp_hagl);
+  state.Read(RPM);
+  state.Read(Omega);
+  state.Read(beta_orient);
+  state.Read(a0);
+  state.Read(a_1);
+  state.Read(b_1);
+  state.Read(a_dw);
+  state.Read(a1s);
+  state.Read(b1s);
+  state.Read(H_drag);
+  state.Read(J_side);
+  state.Read(Torque);
+  state.Read(C_T);
+  state.Read(lambda);
+  state.Read(mu);
+  state.Read(nu);
+  state.Read(v_induced);
+  state.Read(theta_downwash);
+  state.Read(phi_downwash);
+  state.Read(CollectiveCtrl);
+  state.Read(LateralCtrl);
+  state.Read(LongitudinalCtrl);
+  state.Read(EngineRPM);
+
+  if (Transmission) Transmission->RestoreState(state);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
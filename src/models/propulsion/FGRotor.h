@@ -253,6 +253,8 @@ public:
   /// Returns the scalar thrust of the rotor, and adjusts the RPM value.
   double Calculate(double EnginePower);
 
+  void SaveState(FGStateWriter& state) const;
+  void RestoreState(FGStateReader& state);
 
   /// Retrieves the RPMs of the rotor.
   double GetRPM(void) const { return RPM; }
@@ -39,6 +39,7 @@ INCLUDES
 #include "FGTank.h"
 #include "FGFDMExec.h"
 #include "input_output/FGXMLElement.h"
+#include "input_output/FGStateStream.h"
 
 using namespace std;
 
@@ -504,6 +505,50 @@ void FGTank::bind(FGPropertyManager* PropertyManager)
 
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGTank::SaveState(FGStateWriter& state) const
+{
+  state.Write(Contents);
+  state.Write(PctFull);
+  state.Write(Temperature);
+  state.Write(Standpipe);
+  state.Write(ExternalFlow);
+  state.Write(Selected);
+  state.Write(Priority);
+  state.Write(Density);
+  state.Write(Radius);
+  state.Write(InnerRadius);
+  state.Write(Length);
+  state.Write(Volume);
+  state.Write(Area);
+  state.Write(Ixx);
+  state.Write(Iyy);
+  state.Write(Izz);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGTank::RestoreState(FGStateReader& state)
+{
+  state.Read(Contents);
+  state.Read(PctFull);
+  state.Read(Temperature);
+  state.Read(Standpipe);
+  state.Read(ExternalFlow);
+  state.Read(Selected);
+  state.Read(Priority);
+  state.Read(Density);
+  state.Read(Radius);
+  state.Read(InnerRadius);
+  state.Read(Length);
+  state.Read(Volume);
+  state.Read(Area);
+  state.Read(Ixx);
+  state.Read(Iyy);
+  state.Read(Izz);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
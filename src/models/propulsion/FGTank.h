@@ -55,6 +55,8 @@ namespace JSBSim {
 
 class Element;
 class FGPropertyManager;
+class FGStateWriter;
+class FGStateReader;
 class FGFDMExec;
 class FGFunction;
 
@@ -245,6 +247,9 @@ public:
   /** Resets the tank parameters to the initial conditions */
   void ResetToIC(void);
 
+  void SaveState(FGStateWriter& state) const;
+  void RestoreState(FGStateReader& state);
+
   /** If the tank is set to supply fuel, this function returns true.
       @return true if this tank is set to a non-zero priority.*/
   bool GetSelected(void) const {return Selected;}
@@ -40,6 +40,7 @@ INCLUDES
 #include "FGThruster.h"
 #include "input_output/FGXMLElement.h"
 #include "input_output/FGLog.h"
+#include "input_output/FGStateStream.h"
 
 using namespace std;
 
@@ -169,6 +170,30 @@ string FGThruster::GetThrusterValues(int id, const string& delimeter)
   return buf.str();
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGThruster::SaveState(FGStateWriter& state) const
+{
+  state.Section(Name);
+  state.Write(vFn);
+  state.Write(vMn);
+  state.Write(Thrust);
+  state.Write(PowerRequired);
+  state.Write(ReverserAngle);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGThruster::RestoreState(FGStateReader& state)
+{
+  state.Section(Name);
+  state.Read(vFn);
+  state.Read(vMn);
+  state.Read(Thrust);
+  state.Read(PowerRequired);
+  state.Read(ReverserAngle);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
@@ -50,6 +50,8 @@ namespace JSBSim {
 
 class Element;
 class FGPropertyManager;
+class FGStateWriter;
+class FGStateReader;
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 CLASS DOCUMENTATION
@@ -106,6 +108,9 @@ public:
 
   virtual void ResetToIC(void);
 
+  virtual void SaveState(FGStateWriter& state) const;
+  virtual void RestoreState(FGStateReader& state);
+
   struct Inputs {
     double TotalDeltaT;
     double H_agl;
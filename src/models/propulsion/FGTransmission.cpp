@@ -41,6 +41,7 @@ INCLUDES
 
 
 #include "FGTransmission.h"
+#include "input_output/FGStateStream.h"
 
 using std::string;
 
@@ -153,6 +154,30 @@ bool FGTransmission::BindModel(int num, FGPropertyManager* PropertyManager)
   return true;
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGTransmission::SaveState(FGStateWriter& state) const
+{
+  state.Write(FreeWheelLag);
+  state.Write(FreeWheelTransmission);
+  state.Write(ClutchCtrlNorm);
+  state.Write(BrakeCtrlNorm);
+  state.Write(EngineRPM);
+  state.Write(ThrusterRPM);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGTransmission::RestoreState(FGStateReader& state)
+{
+  state.Read(FreeWheelLag);
+  state.Read(FreeWheelTransmission);
+  state.Read(ClutchCtrlNorm);
+  state.Read(BrakeCtrlNorm);
+  state.Read(EngineRPM);
+  state.Read(ThrusterRPM);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
@@ -119,6 +119,9 @@ public:
 
   void Calculate(double EnginePower, double ThrusterTorque, double dt);
 
+  void SaveState(FGStateWriter& state) const;
+  void RestoreState(FGStateReader& state);
+
   void   SetMaxBrakePower(double x) {MaxBrakePower=x;}
   double GetMaxBrakePower() const {return MaxBrakePower;}
   void   SetEngineFriction(double x) {EngineFriction=x;}
@@ -49,6 +49,7 @@ INCLUDES
 #include "FGThruster.h"
 #include "input_output/FGXMLElement.h"
 #include "input_output/string_utilities.h"
+#include "input_output/FGStateStream.h"
 
 using namespace std;
 
@@ -620,6 +621,72 @@ int FGTurbine::InitRunning(void)
   return phase=tpRun;
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGTurbine::SaveState(FGStateWriter& state) const
+{
+  FGEngine::SaveState(state);
+
+  state.Write(phase);
+  state.Write(N1);
+  state.Write(N2);
+  state.Write(N2norm);
+  state.Write(ThrottlePos);
+  state.Write(AugmentCmd);
+  state.Write(Stalled);
+  state.Write(Seized);
+  state.Write(Overtemp);
+  state.Write(Fire);
+  state.Write(Injection);
+  state.Write(Augmentation);
+  state.Write(Reversed);
+  state.Write(Cutoff);
+  state.Write(Ignition);
+  state.Write(EGT_degC);
+  state.Write(EPR);
+  state.Write(OilPressure_psi);
+  state.Write(OilTemp_degK);
+  state.Write(BleedDemand);
+  state.Write(InletPosition);
+  state.Write(NozzlePosition);
+  state.Write(correctedTSFC);
+  state.Write(InjectionTimer);
+  state.Write(InjWaterNorm);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGTurbine::RestoreState(FGStateReader& state)
+{
+  FGEngine::RestoreState(state);
+
+  state.Read(phase);
+  state.Read(N1);
+  state.Read(N2);
+  state.Read(N2norm);
+  state.Read(ThrottlePos);
+  state.Read(AugmentCmd);
+  state.Read(Stalled);
+  state.Read(Seized);
+  state.Read(Overtemp);
+  state.Read(Fire);
+  state.Read(Injection);
+  state.Read(Augmentation);
+  state.Read(Reversed);
+  state.Read(Cutoff);
+  state.Read(Ignition);
+  state.Read(EGT_degC);
+  state.Read(EPR);
+  state.Read(OilPressure_psi);
+  state.Read(OilTemp_degK);
+  state.Read(BleedDemand);
+  state.Read(InletPosition);
+  state.Read(NozzlePosition);
+  state.Read(correctedTSFC);
+  state.Read(InjectionTimer);
+  state.Read(InjWaterNorm);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
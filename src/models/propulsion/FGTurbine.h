@@ -237,6 +237,9 @@ public:
   int InitRunning(void);
   void ResetToIC(void);
 
+  void SaveState(FGStateWriter& state) const;
+  void RestoreState(FGStateReader& state);
+
   std::string GetEngineLabels(const std::string& delimiter);
   std::string GetEngineValues(const std::string& delimiter);
 
@@ -50,6 +50,7 @@ INCLUDES
 #include "FGRotor.h"
 #include "math/FGFunction.h"
 #include "input_output/FGXMLElement.h"
+#include "input_output/FGStateStream.h"
 
 using namespace std;
 
@@ -549,6 +550,58 @@ void FGTurboProp::bindmodel(FGPropertyManager* PropertyManager)
   PropertyManager->Tie( property_name.c_str(), &CombustionEfficiency);
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGTurboProp::SaveState(FGStateWriter& state) const
+{
+  FGEngine::SaveState(state);
+
+  state.Write(phase);
+  state.Write(N1);
+  state.Write(ThrottlePos);
+  state.Write(Reversed);
+  state.Write(Cutoff);
+  state.Write(OilPressure_psi);
+  state.Write(OilTemp_degK);
+  state.Write(Ielu_intervent);
+  state.Write(OldThrottle);
+  state.Write(RPM);
+  state.Write(CombustionEfficiency);
+  state.Write(HP);
+  state.Write(StartTime);
+  state.Write(Eng_ITT_degC);
+  state.Write(Eng_Temperature);
+  state.Write(EngStarting);
+  state.Write(GeneratorPower);
+  state.Write(Condition);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGTurboProp::RestoreState(FGStateReader& state)
+{
+  FGEngine::RestoreState(state);
+
+  state.Read(phase);
+  state.Read(N1);
+  state.Read(ThrottlePos);
+  state.Read(Reversed);
+  state.Read(Cutoff);
+  state.Read(OilPressure_psi);
+  state.Read(OilTemp_degK);
+  state.Read(Ielu_intervent);
+  state.Read(OldThrottle);
+  state.Read(RPM);
+  state.Read(CombustionEfficiency);
+  state.Read(HP);
+  state.Read(StartTime);
+  state.Read(Eng_ITT_degC);
+  state.Read(Eng_Temperature);
+  state.Read(EngStarting);
+  state.Read(GeneratorPower);
+  state.Read(Condition);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
@@ -101,6 +101,10 @@ public:
   enum phaseType { tpOff, tpRun, tpSpinUp, tpStart, tpTrim };
 
   void Calculate(void);
+
+  void SaveState(FGStateWriter& state) const;
+  void RestoreState(FGStateReader& state);
+
   double CalcFuelNeed(void);
 
   double GetPowerAvailable(void) const { return (HP * hptoftlbssec); }
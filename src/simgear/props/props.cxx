@@ -16,6 +16,10 @@
 #include <limits>
 
 #include <set>
+#include <list>
+#include <atomic>
+#include <string_view>
+#include <unordered_map>
 #include <sstream>
 #include <iomanip>
 #include <iterator>
@@ -366,6 +370,75 @@ find_last_child (const char * name, const PropertyList& nodes)
   return index;
 }
 
+////////////////////////////////////////////////////////////////////////
+// Hashed lookup of the children and of the paths.
+////////////////////////////////////////////////////////////////////////
+
+/**
+ * Number of children from which they are looked up in a hash table rather
+ * than with a linear search.
+ */
+static const size_t CHILD_INDEX_MIN_SIZE = 8;
+
+/**
+ * Maximum number of paths cached per node. The cache is emptied when it is
+ * full so that code building many distinct paths does not grow it forever.
+ */
+static const size_t PATH_CACHE_MAX_SIZE = 1024;
+
+/**
+ * Source of the generations of the trees (see SGPropertyNode::_generation).
+ * Each value is used only once so that the path caches of the nodes which end
+ * up in another tree, when they are detached or their root is destroyed, are
+ * invalidated as well. The counter is atomic so that the trees of executives
+ * running in separate threads can be modified concurrently.
+ */
+static std::atomic<unsigned int> last_generation(0);
+
+/**
+ * Hash a child name and index (FNV-1a).
+ */
+template<typename Itr>
+static size_t
+hash_child (Itr begin, Itr end, int index)
+{
+  size_t hash = 2166136261u;
+  for (; begin != end; ++begin)
+    hash = (hash ^ static_cast<unsigned char>(*begin)) * 16777619u;
+  return (hash ^ static_cast<unsigned int>(index)) * 16777619u;
+}
+
+struct SGPropertyNode::ChildIndex
+{
+  std::unordered_multimap<size_t, SGPropertyNode*> nodes;
+
+  void add(SGPropertyNode* node) {
+    const std::string& name = node->getNameString();
+    nodes.emplace(hash_child(name.begin(), name.end(), node->getIndex()),
+                  node);
+  }
+
+  void remove(SGPropertyNode* node) {
+    const std::string& name = node->getNameString();
+    auto range = nodes.equal_range(hash_child(name.begin(), name.end(),
+                                              node->getIndex()));
+    for (auto it = range.first; it != range.second; ++it) {
+      if (it->second == node) {
+        nodes.erase(it);
+        return;
+      }
+    }
+  }
+};
+
+struct SGPropertyNode::PathCache
+{
+  unsigned int generation;
+  // The keys of the hash table are views of the interned paths.
+  std::list<std::string> paths;
+  std::unordered_map<std::string_view, SGPropertyNode*> nodes;
+};
+
 /**
  * Get first unused index for child nodes with the given name
  */
@@ -389,14 +462,42 @@ first_unused_index( const char * name,
 
 template<typename Itr>
 inline SGPropertyNode*
-SGPropertyNode::getExistingChild (Itr begin, Itr end, int index)
+SGPropertyNode::getExistingChild (Itr begin, Itr end, int index) const
 {
-  int pos = find_child(begin, end, index, _children);
-  if (pos >= 0)
-    return _children[pos];
+  if (_children.size() < CHILD_INDEX_MIN_SIZE) {
+    for (SGPropertyNode* node: _children) {
+      if (node->_index == index
+          && std::equal(begin, end, node->_name.begin(), node->_name.end()))
+        return node;
+    }
+    return 0;
+  }
+
+  auto range = _child_index->nodes.equal_range(hash_child(begin, end, index));
+  for (auto it = range.first; it != range.second; ++it) {
+    SGPropertyNode* node = it->second;
+    if (node->_index == index
+        && std::equal(begin, end, node->_name.begin(), node->_name.end()))
+      return node;
+  }
   return 0;
 }
 
+void
+SGPropertyNode::appendChild (SGPropertyNode * node)
+{
+  _children.push_back(node);
+  // The index is built here rather than on the first lookup so that the
+  // lookups do not modify the node.
+  if (_child_index)
+    _child_index->add(node);
+  else if (_children.size() >= CHILD_INDEX_MIN_SIZE) {
+    _child_index = new ChildIndex;
+    for (SGPropertyNode* child: _children)
+      _child_index->add(child);
+  }
+}
+
 template<typename Itr>
 SGPropertyNode *
 SGPropertyNode::getChildImpl (Itr begin, Itr end, int index, bool create)
@@ -407,7 +508,7 @@ SGPropertyNode::getChildImpl (Itr begin, Itr end, int index, bool create)
       return node;
     } else if (create) {
       node = new SGPropertyNode(begin, end, index, this);
-      _children.push_back(node);
+      appendChild(node);
       fireChildAdded(node);
       return node;
     } else {
@@ -763,6 +864,7 @@ SGPropertyNode::clearValue ()
     }
     _tied = false;
     _type = props::NONE;
+    _serial++;
 }
 
 
@@ -858,7 +960,11 @@ SGPropertyNode::SGPropertyNode ()
     _type(props::NONE),
     _tied(false),
     _attr(READ|WRITE),
-    _listeners(nullptr)
+    _serial(0),
+    _listeners(nullptr),
+    _child_index(nullptr),
+    _path_cache(nullptr),
+    _generation(0)
 {
   _local_val.string_val = 0;
   _value.val = 0;
@@ -876,7 +982,11 @@ SGPropertyNode::SGPropertyNode (const SGPropertyNode &node)
     _type(node._type),
     _tied(node._tied),
     _attr(node._attr),
-    _listeners(nullptr)	// CHECK!!
+    _serial(0),
+    _listeners(nullptr),	// CHECK!!
+    _child_index(nullptr),
+    _path_cache(nullptr),
+    _generation(0)
 {
   _local_val.string_val = 0;
   _value.val = 0;
@@ -931,7 +1041,11 @@ SGPropertyNode::SGPropertyNode (Itr begin, Itr end,
     _type(props::NONE),
     _tied(false),
     _attr(READ|WRITE),
-    _listeners(nullptr)
+    _serial(0),
+    _listeners(nullptr),
+    _child_index(nullptr),
+    _path_cache(nullptr),
+    _generation(0)
 {
   _local_val.string_val = 0;
   _value.val = 0;
@@ -948,7 +1062,11 @@ SGPropertyNode::SGPropertyNode( const std::string& name,
     _type(props::NONE),
     _tied(false),
     _attr(READ|WRITE),
-    _listeners(nullptr)
+    _serial(0),
+    _listeners(nullptr),
+    _child_index(nullptr),
+    _path_cache(nullptr),
+    _generation(0)
 {
   _local_val.string_val = 0;
   _value.val = 0;
@@ -962,8 +1080,12 @@ SGPropertyNode::SGPropertyNode( const std::string& name,
 SGPropertyNode::~SGPropertyNode ()
 {
   // zero out all parent pointers, else they might be dangling
-  for (unsigned i = 0; i < _children.size(); ++i)
+  for (unsigned i = 0; i < _children.size(); ++i) {
     _children[i]->_parent = nullptr;
+    _children[i]->_generation = ++last_generation;
+  }
+  delete _child_index;
+  delete _path_cache;
   clearValue();
 
   if (_listeners) {
@@ -1068,7 +1190,7 @@ SGPropertyNode::addChild(const char * name, int min_index, bool append)
 
   SGPropertyNode_ptr node;
   node = new SGPropertyNode(name, name + strlen(name), pos, this);
-  _children.push_back(node);
+  appendChild(node);
   fireChildAdded(node);
   return node;
 }
@@ -1111,7 +1233,7 @@ SGPropertyNode::addChildren( const std::string& name,
     {
       SGPropertyNode_ptr node;
       node = new SGPropertyNode(name, index, this);
-      _children.push_back(node);
+      appendChild(node);
       fireChildAdded(node);
       nodes.push_back(node);
     }
@@ -1159,19 +1281,12 @@ SGPropertyNode::getChild (const char * name, int index, bool create)
 SGPropertyNode *
 SGPropertyNode::getChild (const std::string& name, int index, bool create)
 {
-#if PROPS_STANDALONE
-  const char *n = name.c_str();
-  int pos = find_child(n, n + strlen(n), index, _children);
-  if (pos >= 0) {
-    return _children[pos];
-#else
   SGPropertyNode* node = getExistingChild(name.begin(), name.end(), index);
   if (node) {
       return node;
-#endif
     } else if (create) {
       SGPropertyNode* node = new SGPropertyNode(name, index, this);
-      _children.push_back(node);
+      appendChild(node);
       fireChildAdded(node);
       return node;
     } else {
@@ -1185,11 +1300,7 @@ SGPropertyNode::getChild (const std::string& name, int index, bool create)
 const SGPropertyNode *
 SGPropertyNode::getChild (const char * name, int index) const
 {
-  int pos = find_child(name, name + strlen(name), index, _children);
-  if (pos >= 0)
-    return _children[pos];
-  else
-    return 0;
+  return getExistingChild(name, name + strlen(name), index);
 }
 
 
@@ -1272,12 +1383,16 @@ SGPropertyNode::removeAllChildren()
   {
     SGPropertyNode_ptr& node = _children[i];
     node->_parent = nullptr;
+    node->_generation = ++last_generation;
     node->setAttribute(REMOVED, true);
     node->clearValue();
     fireChildRemoved(node);
   }
 
   _children.clear();
+  delete _child_index;
+  _child_index = nullptr;
+  getRootNode()->_generation = ++last_generation;
 }
 
 std::string
@@ -1488,6 +1603,28 @@ SGPropertyNode::getDoubleValue () const
   }
 }
 
+const double *
+SGPropertyNode::getDoublePointer () const
+{
+  const SGRawValue<double>* raw = getDoubleRawValue();
+  if (raw)
+    return raw->getPointer();
+
+  if ((_attr & (READ|TRACE_READ)) != READ || _type != props::DOUBLE || _tied)
+    return nullptr;
+
+  return &_local_val.double_val;
+}
+
+const SGRawValue<double> *
+SGPropertyNode::getDoubleRawValue () const
+{
+  if ((_attr & (READ|TRACE_READ)) != READ || _type != props::DOUBLE || !_tied)
+    return nullptr;
+
+  return static_cast<const SGRawValue<double>*>(_value.val);
+}
+
 const char *
 SGPropertyNode::getStringValue () const
 {
@@ -2070,9 +2207,37 @@ SGPropertyNode *
 SGPropertyNode::getNode (const char * relative_path, bool create)
 {
 #if PROPS_STANDALONE
+  unsigned int generation = getRootNode()->_generation;
+  std::string_view path(relative_path);
+
+  if (!_path_cache) {
+    _path_cache = new PathCache;
+    _path_cache->generation = generation;
+  } else if (_path_cache->generation != generation) {
+    _path_cache->nodes.clear();
+    _path_cache->paths.clear();
+    _path_cache->generation = generation;
+  } else {
+    auto it = _path_cache->nodes.find(path);
+    if (it != _path_cache->nodes.end())
+      return it->second;
+  }
+
   vector<PathComponent> components;
   parse_path(relative_path, components);
-  return find_node(this, components, 0, create);
+  SGPropertyNode* node = find_node(this, components, 0, create);
+
+  // Only the nodes which exist are cached, so that a path which is not found
+  // is looked up again after it has been created.
+  if (node) {
+    if (_path_cache->nodes.size() >= PATH_CACHE_MAX_SIZE) {
+      _path_cache->nodes.clear();
+      _path_cache->paths.clear();
+    }
+    _path_cache->paths.emplace_back(path);
+    _path_cache->nodes[_path_cache->paths.back()] = node;
+  }
+  return node;
 
 #else
   using namespace boost;
@@ -2495,11 +2660,15 @@ SGPropertyNode::eraseChild(simgear::PropertyList::iterator child)
 {
   SGPropertyNode_ptr node = *child;
   node->_parent = nullptr;
+  node->_generation = ++last_generation;
   node->setAttribute(REMOVED, true);
   node->clearValue();
   fireChildRemoved(node);
 
   _children.erase(child);
+  if (_child_index)
+    _child_index->remove(node);
+  getRootNode()->_generation = ++last_generation;
   return node;
 }
 
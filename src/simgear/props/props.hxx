@@ -366,6 +366,33 @@ public:
   virtual bool setValue (T value) = 0;
 
 
+  /**
+   * Function that reads the underlying value of a raw value.
+   */
+  typedef T (*reader_t)(const SGRawValue<T>*);
+
+
+  /**
+   * Return the address of the underlying value.
+   *
+   * @return The address of the variable to which this raw value is bound,
+   * or nullptr if the value can only be read with getValue().
+   */
+  virtual const T* getPointer () const { return nullptr; }
+
+
+  /**
+   * Return a function that reads the underlying value.
+   *
+   * Unlike getValue(), the function can be called without the dispatch of
+   * a virtual call.
+   *
+   * @return The function, or nullptr if the value can only be read with
+   * getValue().
+   */
+  virtual reader_t getReader () const { return nullptr; }
+
+
   /**
    * Return the type tag for this raw value type.
    */
@@ -438,6 +465,11 @@ public:
    */
   virtual bool setValue (T value) { *_ptr = value; return true; }
 
+  /**
+   * Get the address of the variable.
+   */
+  virtual const T* getPointer () const { return _ptr; }
+
   /**
    * Create a copy of this raw value.
    *
@@ -588,6 +620,13 @@ public:
     if (_setter) { (_obj.*_setter)(value); return true; }
     else return false;
   }
+  virtual typename SGRawValue<T>::reader_t getReader () const {
+    if (!_getter) return nullptr;
+    return [](const SGRawValue<T>* raw) -> T {
+      auto self = static_cast<const SGRawValueMethods*>(raw);
+      return (self->_obj.*(self->_getter))();
+    };
+  }
   virtual SGRaw* clone () const {
     return new SGRawValueMethods(_obj, _getter, _setter);
   }
@@ -1048,6 +1087,10 @@ public:
 
   /**
    * Get a pointer to another node by relative path.
+   *
+   * The nodes found are cached by the node from which the lookup starts, so
+   * this lookup (and its const versions) modifies the node: a tree must not
+   * be searched by several threads at the same time.
    */
   SGPropertyNode * getNode (const char * relative_path, bool create = false);
 
@@ -1130,6 +1173,7 @@ public:
    */
   void setAttribute (Attribute attr, bool state) {
     (state ? _attr |= attr : _attr &= ~attr);
+    _serial++;
   }
 
 
@@ -1142,7 +1186,7 @@ public:
   /**
    * Set all of the mode attributes for the property node.
    */
-  void setAttributes (int attr) { _attr = attr; }
+  void setAttributes (int attr) { _attr = attr; _serial++; }
 
 
   //
@@ -1186,6 +1230,38 @@ public:
   double getDoubleValue () const;
 
 
+  /**
+   * Get the address of the double value for this node.
+   *
+   * @return The address of the value, or nullptr if the value cannot be
+   * read directly (not a double, not readable, traced or tied to something
+   * else than a pointer). The address is valid until the storage serial
+   * number of the node changes.
+   */
+  const double * getDoublePointer () const;
+
+
+  /**
+   * Get the raw value to which the double value for this node is tied.
+   *
+   * @return The raw value, or nullptr if the value is not a tied double
+   * that can be read directly. The raw value is valid until the storage
+   * serial number of the node changes.
+   */
+  const SGRawValue<double> * getDoubleRawValue () const;
+
+
+  /**
+   * Get the storage serial number for this node.
+   *
+   * The serial number changes each time the node is tied, untied, aliased,
+   * changes type or has its attributes modified. It allows the users of
+   * getDoublePointer() and getDoubleRawValue() to detect that their result
+   * is no longer valid.
+   */
+  unsigned int getStorageSerial () const { return _serial; }
+
+
   /**
    * Get a string value for this node.
    */
@@ -1795,6 +1871,7 @@ private:
   simgear::props::Type _type;
   bool _tied;
   int _attr;
+  unsigned int _serial;
 
   // The right kind of pointer...
   union {
@@ -1813,12 +1890,25 @@ private:
 
   std::vector<SGPropertyChangeListener *> * _listeners;
 
+  // Hash table of the children, built when there are enough of them.
+  struct ChildIndex;
+  ChildIndex * _child_index;
+  // Nodes found by getNode() from this node, indexed by their path.
+  struct PathCache;
+  PathCache * _path_cache;
+  // Generation of the tree of which this node is the root. It is modified
+  // each time nodes are detached from the tree so that the path caches of its
+  // nodes are only invalidated by the changes of their own tree.
+  unsigned int _generation;
+
   // Pass name as a pair of iterators
   template<typename Itr>
   SGPropertyNode * getChildImpl (Itr begin, Itr end, int index = 0, bool create = false);
   // very internal method
   template<typename Itr>
-  SGPropertyNode* getExistingChild (Itr begin, Itr end, int index);
+  SGPropertyNode* getExistingChild (Itr begin, Itr end, int index) const;
+  // Add a node to the children and to their hash table.
+  void appendChild (SGPropertyNode * node);
   // very internal path parsing function
   template<typename SplitItr>
   friend SGPropertyNode* find_node_aux(SGPropertyNode * current, SplitItr& itr,
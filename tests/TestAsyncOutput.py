@@ -0,0 +1,158 @@
+# TestAsyncOutput.py
+#
+# Check that the outputs written from a background thread contain the same data
+# as the synchronous outputs.
+#
+# Copyright (c) 2026 The JSBSim team
+#
+# This program is free software; you can redistribute it and/or modify it under
+# the terms of the GNU General Public License as published by the Free Software
+# Foundation; either version 3 of the License, or (at your option) any later
+# version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+# FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+# details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program; if not, see <http://www.gnu.org/licenses/>
+#
+
+import xml.etree.ElementTree as et
+import pandas as pd
+import numpy as np
+from JSBSim_utils import JSBSimTestCase, ExecuteUntil, RunTest
+from jsbsim import binary_output
+
+
+class TestAsyncOutput(JSBSimTestCase):
+    def add_output(self, root, name, output_type, **attrib):
+        output_tag = et.SubElement(root, 'output')
+        output_tag.attrib['name'] = name
+        output_tag.attrib['type'] = output_type
+        output_tag.attrib['rate'] = '120'
+        output_tag.attrib.update(attrib)
+        for prop in ('position/h-sl-ft', 'attitude/theta-rad',
+                     'velocities/vc-kts', 'aero/alpha-deg'):
+            property_tag = et.SubElement(output_tag, 'property')
+            property_tag.text = prop
+        function_tag = et.SubElement(output_tag, 'function')
+        # The function names must be unique.
+        function_tag.attrib['name'] = 'test/qbar-area-' + name.replace('.', '-')
+        product_tag = et.SubElement(function_tag, 'product')
+        et.SubElement(product_tag, 'property').text = 'aero/qbar-psf'
+        et.SubElement(product_tag, 'property').text = 'metrics/Sw-sqft'
+
+    def run_script(self, outputs, end_time=20.):
+        script_path = self.sandbox.path_to_jsbsim_file('scripts', 'c1722.xml')
+        tree = et.parse(script_path)
+        for name, output_type, attrib in outputs:
+            self.add_output(tree.getroot(), name, output_type, **attrib)
+        tree.write('c1722_0.xml')
+
+        fdm = self.create_fdm()
+        fdm.load_script('c1722_0.xml')
+        fdm.run_ic()
+        ExecuteUntil(fdm, end_time)
+        return fdm
+
+    def test_async_block(self):
+        fdm = self.run_script([('sync.csv', 'CSV', {}),
+                               ('async.csv', 'CSV', {'async': 'block',
+                                                     'buffer_size': '16'}),
+                               ('sync.bin', 'BINARY', {}),
+                               ('async.bin', 'BINARY', {'async': 'block'})])
+
+        # The output 0 is defined by the aircraft.
+        pm = fdm.get_property_manager()
+        self.assertFalse(pm.hasNode('simulation/output[1]/async/overruns'))
+        self.assertTrue(pm.hasNode('simulation/output[2]/async/overruns'))
+        self.assertLessEqual(fdm['simulation/output[2]/async/queued-frames'], 16)
+        # Close the output files.
+        del fdm
+        self.delete_fdm()
+
+        sync_csv = pd.read_csv('sync.csv', index_col=0,
+                               float_precision='round_trip')
+        async_csv = pd.read_csv('async.csv', index_col=0,
+                                float_precision='round_trip')
+        self.assertEqual(len(async_csv), len(sync_csv))
+        np.testing.assert_array_equal(async_csv.index, sync_csv.index)
+        np.testing.assert_array_equal(async_csv.to_numpy(),
+                                      sync_csv.to_numpy())
+
+        sync_bin = binary_output.read('sync.bin')
+        async_bin = binary_output.read('async.bin')
+        self.assertEqual(len(async_bin), len(sync_bin))
+        np.testing.assert_array_equal(async_bin.data, sync_bin.data)
+
+    def test_async_drop(self):
+        fdm = self.run_script([('sync.csv', 'CSV', {}),
+                               ('async.csv', 'CSV', {'async': 'drop',
+                                                     'buffer_size': '1'})])
+        overruns = int(fdm['simulation/output[2]/async/overruns'])
+        del fdm
+        self.delete_fdm()
+
+        sync_csv = pd.read_csv('sync.csv', index_col=0,
+                               float_precision='round_trip')
+        async_csv = pd.read_csv('async.csv', index_col=0,
+                                float_precision='round_trip')
+        # Each frame is either written or counted as an overrun.
+        self.assertEqual(len(async_csv) + overruns, len(sync_csv))
+        # The frames that have been written are identical.
+        sync_rows = sync_csv.loc[async_csv.index]
+        np.testing.assert_array_equal(async_csv.to_numpy(),
+                                      sync_rows.to_numpy())
+
+    def test_subsystems(self):
+        # The subsystems can not be written from the background thread so the
+        # output is synchronous.
+        script_path = self.sandbox.path_to_jsbsim_file('scripts', 'c1722.xml')
+        tree = et.parse(script_path)
+        for name, attrib in (('sync.csv', {}), ('async.csv', {'async': 'drop',
+                                                              'buffer_size': '1'})):
+            output_tag = et.SubElement(tree.getroot(), 'output')
+            output_tag.attrib.update({'name': name, 'type': 'CSV',
+                                      'rate': '120', **attrib})
+            et.SubElement(output_tag, 'rates').text = 'ON'
+            et.SubElement(output_tag, 'property').text = 'position/h-sl-ft'
+        tree.write('c1722_0.xml')
+
+        fdm = self.create_fdm()
+        fdm.load_script('c1722_0.xml')
+        fdm.run_ic()
+        ExecuteUntil(fdm, 5.)
+        self.assertEqual(fdm['simulation/output[2]/async/overruns'], 0)
+        self.assertEqual(fdm['simulation/output[2]/async/queued-frames'], 0)
+        del fdm
+        self.delete_fdm()
+
+        sync_csv = pd.read_csv('sync.csv', index_col=0)
+        async_csv = pd.read_csv('async.csv', index_col=0)
+        pd.testing.assert_frame_equal(async_csv, sync_csv)
+
+    def test_new_output(self):
+        # The frames queued before a reset are written to the previous file.
+        fdm = self.run_script([('sync.csv', 'CSV', {}),
+                               ('async.csv', 'CSV', {'async': 'block'})], 5.)
+        fdm.reset_to_initial_conditions(1)
+        ExecuteUntil(fdm, 5.)
+        del fdm
+        self.delete_fdm()
+
+        for prefix in ('sync', 'async'):
+            self.assertTrue(self.sandbox.exists(f'{prefix}_0.csv'))
+
+        for sync_name, async_name in (('sync.csv', 'async.csv'),
+                                      ('sync_0.csv', 'async_0.csv')):
+            sync_csv = pd.read_csv(sync_name, index_col=0,
+                                   float_precision='round_trip')
+            async_csv = pd.read_csv(async_name, index_col=0,
+                                    float_precision='round_trip')
+            np.testing.assert_array_equal(async_csv.to_numpy(),
+                                          sync_csv.to_numpy())
+
+
+RunTest(TestAsyncOutput)
@@ -0,0 +1,140 @@
+# TestBatchRunner.py
+#
+# Check that the cases run concurrently by FGBatchRunner give the same results
+# as sequential runs.
+#
+# Copyright (c) 2026 The JSBSim team
+#
+# This program is free software; you can redistribute it and/or modify it under
+# the terms of the GNU General Public License as published by the Free Software
+# Foundation; either version 3 of the License, or (at your option) any later
+# version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+# FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+# details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program; if not, see <http://www.gnu.org/licenses/>
+#
+
+import math
+import os
+
+from JSBSim_utils import JSBSimTestCase, RunTest
+
+import jsbsim
+
+END_TIME = 2.0
+RESULTS = ['position/h-sl-ft', 'atmosphere/total-wind-north-fps',
+           'atmosphere/total-wind-east-fps', 'atmosphere/total-wind-down-fps']
+TURBULENCE = {'atmosphere/turb-type': 3,
+              'atmosphere/turbulence/milspec/windspeed_at_20ft_AGL-fps': 75,
+              'atmosphere/turbulence/milspec/severity': 6}
+
+
+class TestBatchRunner(JSBSimTestCase):
+    def create_runner(self, threads):
+        runner = jsbsim.FGBatchRunner(self.sandbox.path_to_jsbsim_file(),
+                                      threads)
+        runner.set_output_path(os.path.abspath('.'))
+        for prop in RESULTS:
+            runner.add_result_property(prop)
+        for seed in range(1, 9):
+            runner.add_case(f'seed{seed}', aircraft='ball', initfile='reset01',
+                            end_time=END_TIME, seed=seed,
+                            output=f'ball{seed}.csv', properties=TURBULENCE)
+        return runner
+
+    def run_sequentially(self, seed):
+        fdm = self.create_fdm()
+        fdm.load_model('ball')
+        fdm.load_ic('reset01', True)
+        fdm.set_output_filename(0, f'seq{seed}.csv')
+        fdm['simulation/randomseed'] = seed
+        for prop, value in TURBULENCE.items():
+            fdm[prop] = value
+        fdm.run_ic()
+
+        while fdm.run() and fdm.get_sim_time() <= END_TIME:
+            pass
+
+        values = {prop: fdm[prop] for prop in RESULTS}
+        self.delete_fdm()
+        return values
+
+    def test_concurrent_runs(self):
+        results = self.create_runner(4).run()
+        reference = self.create_runner(1).run()
+
+        self.assertEqual(len(results), 8)
+        for result, ref in zip(results, reference):
+            self.assertTrue(result['success'], msg=result['message'])
+            self.assertEqual(result['name'], ref['name'])
+            self.assertEqual(result['frames'], ref['frames'])
+            self.assertEqual(result['values'], ref['values'])
+            self.assertTrue(self.sandbox.exists(result['name'].replace('seed', 'ball')+'.csv'))
+
+        for seed in (1, 5):
+            values = self.run_sequentially(seed)
+            for prop in RESULTS:
+                self.assertEqual(results[seed-1]['values'][prop], values[prop])
+
+        # The seeds must give different turbulence histories.
+        winds = {r['values']['atmosphere/total-wind-north-fps'] for r in results}
+        self.assertEqual(len(winds), len(results))
+
+    def test_errors(self):
+        runner = jsbsim.FGBatchRunner(self.sandbox.path_to_jsbsim_file(), 2)
+        runner.set_output_path(os.path.abspath('.'))
+        runner.add_result_property('position/h-sl-ft')
+        runner.add_result_property('dummy/property')
+        runner.add_case('ok', aircraft='ball', initfile='reset01',
+                        end_time=0.1)
+        runner.add_case('bad_property', aircraft='ball', initfile='reset01',
+                        end_time=0.1, properties={'dummy/property': 1.0})
+        runner.add_case('no_end_time', aircraft='ball', initfile='reset01')
+        results = runner.run()
+
+        self.assertTrue(results[0]['success'])
+        self.assertTrue(math.isnan(results[0]['values']['dummy/property']))
+        self.assertFalse(results[1]['success'])
+        self.assertIn('dummy/property', results[1]['message'])
+        self.assertFalse(results[2]['success'])
+
+    def test_load(self):
+        batch_file = os.path.abspath('batch.xml')
+        with open(batch_file, 'w') as f:
+            f.write(f"""<?xml version="1.0"?>
+<batch>
+  <results>
+    <property> position/h-sl-ft </property>
+  </results>
+  <case name="first" seed="3" end="{END_TIME}">
+    <aircraft> ball </aircraft>
+    <initfile> reset01 </initfile>
+    <output> first.csv </output>
+    <property value="3"> atmosphere/turb-type </property>
+  </case>
+  <case end="{END_TIME}" dt="0.01">
+    <aircraft> ball </aircraft>
+    <initfile> reset01 </initfile>
+    <output> second.csv </output>
+  </case>
+</batch>""")
+
+        runner = jsbsim.FGBatchRunner(self.sandbox.path_to_jsbsim_file(), 2)
+        runner.set_output_path(os.path.abspath('.'))
+        self.assertTrue(runner.load(batch_file))
+        self.assertEqual(runner.get_num_cases(), 2)
+        self.assertEqual(runner.get_result_properties(), ['position/h-sl-ft'])
+
+        results = runner.run()
+        self.assertEqual([r['name'] for r in results], ['first', 'case1'])
+        for result in results:
+            self.assertTrue(result['success'], msg=result['message'])
+        self.assertGreater(results[1]['sim_time'], END_TIME)
+
+
+RunTest(TestBatchRunner)
@@ -0,0 +1,92 @@
+# TestBinaryOutput.py
+#
+# Check that the binary output contains the same data as the CSV output.
+#
+# Copyright (c) 2026 The JSBSim team
+#
+# This program is free software; you can redistribute it and/or modify it under
+# the terms of the GNU General Public License as published by the Free Software
+# Foundation; either version 3 of the License, or (at your option) any later
+# version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+# FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+# details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program; if not, see <http://www.gnu.org/licenses/>
+#
+
+import xml.etree.ElementTree as et
+import pandas as pd
+import numpy as np
+from JSBSim_utils import JSBSimTestCase, ExecuteUntil, RunTest
+from jsbsim import binary_output
+
+
+class TestBinaryOutput(JSBSimTestCase):
+    def add_output(self, root, name, output_type):
+        output_tag = et.SubElement(root, 'output')
+        output_tag.attrib['name'] = name
+        output_tag.attrib['type'] = output_type
+        output_tag.attrib['rate'] = '120'
+        for prop in ('position/h-sl-ft', 'attitude/theta-rad',
+                     'velocities/vc-kts', 'fcs/throttle-cmd-norm'):
+            property_tag = et.SubElement(output_tag, 'property')
+            property_tag.text = prop
+        property_tag = et.SubElement(output_tag, 'property')
+        property_tag.attrib['caption'] = 'alpha'
+        property_tag.text = 'aero/alpha-deg'
+        function_tag = et.SubElement(output_tag, 'function')
+        # The function names must be unique.
+        function_tag.attrib['name'] = 'test/qbar-area-' + output_type.lower()
+        product_tag = et.SubElement(function_tag, 'product')
+        et.SubElement(product_tag, 'property').text = 'aero/qbar-psf'
+        et.SubElement(product_tag, 'property').text = 'metrics/Sw-sqft'
+
+    def test_binary_output(self):
+        script_path = self.sandbox.path_to_jsbsim_file('scripts', 'c1722.xml')
+        tree = et.parse(script_path)
+        self.add_output(tree.getroot(), 'test.csv', 'CSV')
+        self.add_output(tree.getroot(), 'test.bin', 'BINARY')
+        tree.write('c1722_0.xml')
+
+        fdm = self.create_fdm()
+        fdm.load_script('c1722_0.xml')
+        fdm.run_ic()
+        ExecuteUntil(fdm, 20.)
+        # Close the output files.
+        del fdm
+        self.delete_fdm()
+
+        csv = pd.read_csv('test.csv', index_col=0,
+                          float_precision='round_trip')
+        log = binary_output.read('test.bin')
+
+        self.assertEqual(log.names, ['Time'] + list(csv.columns[:-1])
+                         + ['test/qbar-area-binary'])
+        self.assertEqual(log.units, ['sec', 'ft', 'rad', 'kts', 'norm', 'deg',
+                                     ''])
+        # Several blocks, the last one being incomplete.
+        self.assertGreater(len(log), 2*1024)
+        self.assertNotEqual(len(log) % 1024, 0)
+        self.assertEqual(len(log), len(csv))
+
+        # The time is written with 10 significant digits in the CSV file.
+        np.testing.assert_allclose(log['Time'], csv.index, rtol=1E-9)
+        np.testing.assert_array_equal(log.data[:, 1:], csv.to_numpy())
+
+        df = log.to_dataframe()
+        self.assertEqual(list(df.columns), log.names[1:])
+        np.testing.assert_array_equal(df.to_numpy(), csv.to_numpy())
+        np.testing.assert_array_equal(df.index, log['Time'])
+
+    def test_not_binary(self):
+        with open('not_binary.bin', 'w') as f:
+            f.write('Time,position/h-sl-ft\n0.0,1.0\n')
+        with self.assertRaises(ValueError):
+            binary_output.read('not_binary.bin')
+
+
+RunTest(TestBinaryOutput)
@@ -0,0 +1,61 @@
+# TestBytecode.py
+#
+# Check that the functions evaluated by their bytecode return the same results
+# as the functions evaluated by their tree of parameters.
+#
+# Copyright (c) 2026 The JSBSim team
+#
+# This program is free software; you can redistribute it and/or modify it under
+# the terms of the GNU General Public License as published by the Free Software
+# Foundation; either version 3 of the License, or (at your option) any later
+# version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+# FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+# details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program; if not, see <http://www.gnu.org/licenses/>
+#
+
+import os
+
+from JSBSim_utils import JSBSimTestCase, RunTest
+
+PROPERTIES = ['position/h-sl-ft', 'position/lat-geod-rad',
+              'position/long-gc-rad', 'velocities/u-fps', 'velocities/v-fps',
+              'velocities/w-fps', 'velocities/p-rad_sec',
+              'velocities/q-rad_sec', 'velocities/r-rad_sec',
+              'attitude/phi-rad', 'attitude/theta-rad', 'attitude/psi-rad',
+              'aero/alpha-rad', 'aero/beta-rad']
+
+
+class TestBytecode(JSBSimTestCase):
+    def tearDown(self):
+        os.environ.pop('JSBSIM_NO_BYTECODE', None)
+        JSBSimTestCase.tearDown(self)
+
+    def run_script(self, script, duration):
+        fdm = self.create_fdm()
+        self.load_script(script)
+        fdm.run_ic()
+        history = []
+        while fdm.get_sim_time() <= duration:
+            fdm.run()
+            history.append([fdm.get_sim_time()] +
+                           [fdm[prop] for prop in PROPERTIES])
+        self.delete_fdm()
+        return history
+
+    def test_identical_results(self):
+        for script in ('c1723.xml', 'B747_script1.xml', 'x153.xml',
+                       'f16_test.xml'):
+            os.environ.pop('JSBSIM_NO_BYTECODE', None)
+            bytecode = self.run_script(script, 10.0)
+            os.environ['JSBSIM_NO_BYTECODE'] = '1'
+            tree = self.run_script(script, 10.0)
+            self.assertEqual(bytecode, tree, msg=script)
+
+
+RunTest(TestBytecode)
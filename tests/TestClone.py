@@ -0,0 +1,104 @@
+# TestClone.py
+#
+# Check that the clones of an executive run the same simulation as the
+# original one.
+#
+# Copyright (c) 2026 The JSBSim team
+#
+# This program is free software; you can redistribute it and/or modify it under
+# the terms of the GNU General Public License as published by the Free Software
+# Foundation; either version 3 of the License, or (at your option) any later
+# version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+# FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+# details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program; if not, see <http://www.gnu.org/licenses/>
+#
+
+from JSBSim_utils import JSBSimTestCase, RunTest, ExecuteUntil
+
+import jsbsim
+
+PROPERTIES = ['position/h-sl-ft', 'position/lat-geod-rad',
+              'position/long-gc-rad', 'velocities/u-fps', 'velocities/v-fps',
+              'velocities/w-fps', 'velocities/p-rad_sec',
+              'velocities/q-rad_sec', 'velocities/r-rad_sec',
+              'attitude/phi-rad', 'attitude/theta-rad', 'attitude/psi-rad',
+              'propulsion/engine/engine-rpm', 'propulsion/tank/contents-lbs',
+              'fcs/throttle-pos-norm', 'fcs/left-aileron-pos-rad',
+              'gear/unit/compression-ft', 'atmosphere/total-wind-north-fps']
+
+
+class TestClone(JSBSimTestCase):
+    def record(self, fdm, duration):
+        end_time = fdm.get_sim_time() + duration
+        history = []
+        while fdm.get_sim_time() <= end_time:
+            fdm.run()
+            history.append([fdm.get_sim_time()] +
+                           [fdm[prop] for prop in PROPERTIES])
+        return history
+
+    def test_clone_running_fdm(self):
+        fdm = self.create_fdm()
+        self.load_script('c1723.xml')
+        fdm.run_ic()
+        fdm['atmosphere/turb-type'] = 3
+        fdm['atmosphere/turbulence/milspec/windspeed_at_20ft_AGL-fps'] = 30
+        fdm['atmosphere/turbulence/milspec/severity'] = 4
+        fdm['fcs/aileron-cmd-norm'] = 0.2
+        ExecuteUntil(fdm, 15.0)
+
+        clone = fdm.clone()
+        self.assertIsInstance(clone, jsbsim.FGFDMExec)
+        self.assertEqual(clone.get_sim_time(), fdm.get_sim_time())
+        self.assertEqual(clone.get_delta_t(), fdm.get_delta_t())
+        self.assertEqual(clone['fcs/aileron-cmd-norm'], 0.2)
+
+        # The script is not cloned so the clones are compared to each other.
+        reference = self.record(clone, 10.0)
+
+        # The clones do not share any state with the original executive.
+        other = fdm.clone()
+        other['fcs/aileron-cmd-norm'] = -0.2
+        self.record(other, 5.0)
+        self.assertEqual(clone['fcs/aileron-cmd-norm'], 0.2)
+
+        del other
+        self.assertEqual(self.record(fdm.clone(), 10.0), reference)
+
+    def test_clone_initial_conditions(self):
+        fdm = self.create_fdm()
+        fdm.load_model('c172x')
+        fdm.load_ic('reset01', True)
+
+        clone = fdm.clone()
+        for prop in ('ic/h-sl-ft', 'ic/vc-kts', 'ic/psi-true-deg',
+                     'ic/lat-geod-deg', 'ic/long-gc-deg'):
+            self.assertEqual(clone[prop], fdm[prop])
+
+        clone.run_ic()
+        fdm.run_ic()
+        self.assertEqual(self.record(clone, 5.0), self.record(fdm, 5.0))
+
+        # A clone resumes the simulation where the original was cloned.
+        other = fdm.clone()
+        self.assertEqual(self.record(other, 5.0), self.record(fdm, 5.0))
+
+        # The clone remains usable after the original executive is deleted.
+        clone.reset_to_initial_conditions(0)
+        self.delete_fdm()
+        self.assertEqual(clone.get_sim_time(), 0.0)
+        clone.run()
+
+    def test_clone_before_loading(self):
+        fdm = self.create_fdm()
+        with self.assertRaises(jsbsim.BaseError):
+            fdm.clone()
+
+
+RunTest(TestClone)
@@ -0,0 +1,61 @@
+# TestDocumentStore.py
+#
+# Check that the XML files shared by several executives are parsed again when
+# they are modified.
+#
+# Copyright (c) 2026 The JSBSim team
+#
+# This program is free software; you can redistribute it and/or modify it under
+# the terms of the GNU General Public License as published by the Free Software
+# Foundation; either version 3 of the License, or (at your option) any later
+# version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+# FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+# details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program; if not, see <http://www.gnu.org/licenses/>
+#
+
+import os, time
+from JSBSim_utils import JSBSimTestCase, CopyAircraftDef, RunTest
+
+
+class TestDocumentStore(JSBSimTestCase):
+    def load_aircraft(self):
+        fdm = self.create_fdm()
+        fdm.set_aircraft_path('aircraft')
+        fdm.load_model(self.aircraft_name)
+        wing_area = fdm['metrics/Sw-sqft']
+        self.delete_fdm()
+        return wing_area
+
+    def test_modified_file(self):
+        script_path = self.sandbox.path_to_jsbsim_file('scripts', 'c1722.xml')
+        tree, self.aircraft_name, _ = CopyAircraftDef(script_path,
+                                                      self.sandbox)
+        aircraft_file = os.path.join('aircraft', self.aircraft_name,
+                                     self.aircraft_name+'.xml')
+        tree.write(aircraft_file)
+        wing_area = float(tree.getroot().find('metrics/wingarea').text)
+
+        # Let the modification time of the file be older than the time at which
+        # it is parsed so that the document can be reused.
+        time.sleep(1.1)
+        fdm = self.create_fdm()
+        fdm.set_aircraft_path('aircraft')
+        fdm.load_model(self.aircraft_name)
+        self.assertAlmostEqual(fdm['metrics/Sw-sqft'], wing_area)
+        # The documents are kept in the store while the first executive uses
+        # them: the second executive is built from a copy of them.
+        self.assertAlmostEqual(self.load_aircraft(), wing_area)
+        del fdm
+
+        tree.getroot().find('metrics/wingarea').text = str(2.0*wing_area)
+        tree.write(aircraft_file)
+        self.assertAlmostEqual(self.load_aircraft(), 2.0*wing_area)
+
+
+RunTest(TestDocumentStore)
@@ -0,0 +1,145 @@
+# TestEnvelopeSweep.py
+#
+# Check that the trim and linearization of a grid of flight conditions by
+# FGEnvelopeSweep do not depend on the number of threads and match the trims
+# made one by one.
+#
+# Copyright (c) 2026 The JSBSim team
+#
+# This program is free software; you can redistribute it and/or modify it under
+# the terms of the GNU General Public License as published by the Free Software
+# Foundation; either version 3 of the License, or (at your option) any later
+# version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+# FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+# details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program; if not, see <http://www.gnu.org/licenses/>
+#
+
+import os
+
+import numpy as np
+
+from JSBSim_utils import JSBSimTestCase, RunTest
+
+import jsbsim
+from jsbsim import envelope_sweep
+
+SPEEDS = [70.0, 90.0, 110.0]
+WEIGHTS = [0.0, 120.0]
+RUNNING = 'propulsion/engine[0]/set-running'
+LUGGAGE = 'inertia/pointmass-weight-lbs[4]'
+
+
+class TestEnvelopeSweep(JSBSimTestCase):
+    def create_sweep(self, threads):
+        sweep = jsbsim.FGEnvelopeSweep(self.sandbox.path_to_jsbsim_file(),
+                                       threads)
+        sweep.set_aircraft('c172x')
+        sweep.set_init_file('reset01')
+        sweep.add_axis('ic/vc-kts', SPEEDS)
+        sweep.add_axis(LUGGAGE, WEIGHTS)
+        sweep.add_property(RUNNING, 1)
+        return sweep
+
+    def test_sweep(self):
+        sweep = self.create_sweep(3)
+        self.assertEqual(sweep.get_num_points(), 6)
+        results = sweep.run()
+        reference = self.create_sweep(1).run()
+
+        self.assertEqual(len(results), 6)
+        self.assertEqual(sweep.control_names,
+                         ('Angle of Attack', 'Throttle', 'Pitch Trim'))
+        self.assertEqual(sweep.x_names[:4], ('Vt', 'Alpha', 'Theta', 'Q'))
+
+        # The points are warm started from their neighbor along the first
+        # axis which index is not zero.
+        self.assertEqual([r['donor'] for r in results], [-1, 0, 0, 1, 2, 3])
+
+        for result, ref in zip(results, reference):
+            self.assertTrue(result['success'], msg=result['message'])
+            self.assertEqual(result['values'], ref['values'])
+            self.assertEqual(result['donor'], ref['donor'])
+            for name in ('controls', 'x0', 'u0', 'A', 'B', 'C', 'D'):
+                np.testing.assert_array_equal(result[name], ref[name])
+
+        # The warm started trims must converge to the same solution as the
+        # trims made from scratch.
+        for i, (speed, weight) in enumerate(((90.0, 0.0), (110.0, 120.0))):
+            fdm = self.create_fdm()
+            fdm.load_model('c172x')
+            fdm.load_ic('reset01', True)
+            fdm[RUNNING] = 1
+            fdm['ic/vc-kts'] = speed
+            fdm[LUGGAGE] = weight
+            fdm.run_ic()
+            fdm['simulation/do_simple_trim'] = 0
+
+            result = results[2+3*i]
+            self.assertAlmostEqual(result['controls'][0],
+                                   fdm['aero/alpha-rad'], delta=1E-4)
+            self.assertAlmostEqual(result['controls'][1],
+                                   fdm['fcs/throttle-cmd-norm'], delta=1E-3)
+            self.assertAlmostEqual(result['x0'][0], fdm['velocities/vt-fps'],
+                                   delta=1E-3)
+            self.delete_fdm()
+
+        # The heavier the aircraft, the higher the angle of attack.
+        self.assertGreater(results[1]['controls'][0], results[0]['controls'][0])
+
+        self.assertTrue(sweep.write('sweep.bin'))
+        data = envelope_sweep.read('sweep.bin')
+        self.assertEqual(data.shape, (3, 2))
+        np.testing.assert_array_equal(data.axes['ic/vc-kts'], SPEEDS)
+        np.testing.assert_array_equal(data.axes[LUGGAGE], WEIGHTS)
+        self.assertEqual(tuple(data.control_names), sweep.control_names)
+        self.assertEqual(tuple(data.state_names), sweep.x_names)
+        self.assertTrue(data.success.all())
+        np.testing.assert_array_equal(data.A[2, 1], results[5]['A'])
+        np.testing.assert_array_equal(data.controls[1, 0],
+                                      results[2]['controls'])
+
+    def test_load(self):
+        spec = os.path.abspath('sweep.xml')
+        with open(spec, 'w') as f:
+            f.write(f"""<?xml version="1.0"?>
+<sweep>
+  <aircraft> c172x </aircraft>
+  <initfile> reset01 </initfile>
+  <linearize> 0 </linearize>
+  <axis property="ic/vc-kts" min="80" max="100" points="3"/>
+  <axis property="ic/h-sl-ft"> 2000 6000 </axis>
+  <property value="1"> {RUNNING} </property>
+</sweep>""")
+
+        sweep = jsbsim.FGEnvelopeSweep(self.sandbox.path_to_jsbsim_file(), 2)
+        self.assertTrue(sweep.load(spec))
+        self.assertEqual(sweep.get_num_axes(), 2)
+        self.assertEqual(sweep.get_num_points(), 6)
+
+        results = sweep.run()
+        self.assertEqual([r['values'] for r in results],
+                         [[80.0, 2000.0], [80.0, 6000.0], [90.0, 2000.0],
+                          [90.0, 6000.0], [100.0, 2000.0], [100.0, 6000.0]])
+        for result in results:
+            self.assertTrue(result['success'], msg=result['message'])
+            self.assertEqual(len(result['controls']), 3)
+            self.assertEqual(len(result['A']), 0)
+
+    def test_errors(self):
+        sweep = self.create_sweep(2)
+        sweep.add_property('dummy/property', 1.0)
+        results = sweep.run()
+
+        self.assertEqual(len(results), 6)
+        for result in results:
+            self.assertFalse(result['success'])
+            self.assertIn('dummy/property', result['message'])
+
+
+RunTest(TestEnvelopeSweep)
@@ -213,7 +213,10 @@ class TestInputSocket(JSBSimTestCase):
                     out.strip().splitlines()[2:],
                 )
             ),
-            ["get", "help", "hold", "info", "iterate", "quit", "resume", "set"],
+            [
+                "get", "help", "hold", "info", "iterate", "quit", "resume", "set",
+                "subscribe", "unsubscribe",
+            ],
         )
 
     async def run_test(self, port, shell):
@@ -0,0 +1,99 @@
+# TestIntegratorsHistory.py
+#
+# Check that each rigid body integrator gives the same results as the reference
+# values computed before the history of the derivatives was stored in ring
+# buffers.
+#
+# Copyright (c) 2026 The JSBSim team
+#
+# This program is free software; you can redistribute it and/or modify it under
+# the terms of the GNU General Public License as published by the Free Software
+# Foundation; either version 3 of the License, or (at your option) any later
+# version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+# FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+# details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program; if not, see <http://www.gnu.org/licenses/>
+#
+
+from JSBSim_utils import JSBSimTestCase, CreateFDM, RunTest
+
+RECT_EULER = 1
+TRAPEZOIDAL = 2
+ADAMS_BASHFORTH2 = 3
+ADAMS_BASHFORTH3 = 4
+ADAMS_BASHFORTH4 = 5
+ADAMS_BASHFORTH5 = 9
+
+PROPERTIES = ['position/lat-geod-rad', 'position/long-gc-rad',
+              'position/h-sl-ft', 'attitude/phi-rad', 'attitude/theta-rad',
+              'attitude/psi-rad', 'velocities/u-fps', 'velocities/v-fps',
+              'velocities/w-fps', 'velocities/p-rad_sec',
+              'velocities/q-rad_sec', 'velocities/r-rad_sec']
+
+# State of the c172x after 200 frames. The values of 2 different methods differ
+# by more than 1E-7 (relative) so the tolerance below can tell them apart
+# while allowing for the round-off differences between compilers and
+# platforms.
+REFERENCE = {
+    RECT_EULER: [
+        0.491468721928314, -1.5708017295160654, 4026.7853482589126,
+        0.27140647811522156, 0.28771866658715267, 3.5600436555502495,
+        162.752147952578, 2.27865466644516, 10.042379538186836,
+        0.16050588552505374, 0.15500266475027677, 0.03534941510289802],
+    TRAPEZOIDAL: [
+        0.49146871646444085, -1.5708017253835107, 4026.56372898072,
+        0.27148448691508753, 0.2876407626718994, 3.55964097402312,
+        162.81750457253995, 2.2637997795213813, 10.045082813039642,
+        0.16073079416396915, 0.155200517276747, 0.034859997239676935],
+    ADAMS_BASHFORTH2: [
+        0.49146872739791175, -1.5708017336489957, 4027.006168384105,
+        0.27133305309248684, 0.2877958730362122, 3.56044813313651,
+        162.6872865921738, 2.2928959785522878, 10.040227656699088,
+        0.16029971815494495, 0.15477691060875112, 0.03582338255707881],
+    ADAMS_BASHFORTH3: [
+        0.4914687274517682, -1.5708017336802167, 4027.006530635059,
+        0.2713303383047019, 0.2877912330688919, 3.5604519742321625,
+        162.68702101827353, 2.292301321059128, 10.040257229007722,
+        0.16030525226312567, 0.15477925930795047, 0.035825033628028934],
+    ADAMS_BASHFORTH4: [
+        0.4914687274515676, -1.5708017336799829, 4027.006514750421,
+        0.2713303886229464, 0.2877911954094743, 3.5604519664291954,
+        162.68702859592884, 2.2922961239379447, 10.040262231944126,
+        0.1603053869159641, 0.1547791112368867, 0.03582488603966451],
+    ADAMS_BASHFORTH5: [
+        0.49146872745185954, -1.570801733679833, 4027.0065195932984,
+        0.27133038588224623, 0.2877912117697337, 3.5604519650863686,
+        162.68702439060957, 2.292295891439359, 10.04026177646287,
+        0.16030538729105026, 0.15477909907040985, 0.03582489548237034]
+}
+
+
+class TestIntegratorsHistory(JSBSimTestCase):
+    def test_reference_values(self):
+        for method, values in REFERENCE.items():
+            fdm = CreateFDM(self.sandbox)
+            fdm.load_model('c172x')
+            fdm.load_ic('reset01', True)
+            fdm.run_ic()
+
+            for integrator in ['rate/rotational', 'rate/translational',
+                               'position/rotational', 'position/translational']:
+                fdm[f'simulation/integrator/{integrator}'] = method
+
+            for _ in range(200):
+                fdm.run()
+
+            for name, value in zip(PROPERTIES, values):
+                self.assertAlmostEqual(fdm[name], value,
+                                       delta=1E-8*max(1.0, abs(value)),
+                                       msg=f'{name} with integrator {method}')
+
+            del fdm
+
+
+RunTest(TestIntegratorsHistory)
@@ -1,4 +1,5 @@
 import xml.etree.ElementTree as et
+import numpy as np
 
 from JSBSim_utils import JSBSimTestCase, RunTest, CopyAircraftDef
 import jsbsim
@@ -48,5 +49,27 @@ class TestLinearization(JSBSimTestCase):
         self.assertEqual(linearization.y_units, ('ft/s', 'rad', 'rad', 'rad/s', 'rad', 'rad', 'rad/s',
                                                  'rad', 'rad/s', 'rad', 'rad', 'ft'))
 
+    def test_parallel_linearization(self):
+        script_path = self.sandbox.path_to_jsbsim_file('scripts',
+                                                       '737_cruise.xml')
+
+        fdm = self.create_fdm()
+        fdm.load_script(script_path)
+        fdm.run_ic()
+        fdm['propulsion/engine[0]/set-running'] = 1
+        fdm['propulsion/engine[1]/set-running'] = 1
+        fdm.run()
+        fdm['simulation/do_simple_trim'] = 1
+
+        serial = jsbsim.FGLinearization(fdm)
+        parallel = jsbsim.FGLinearization(fdm, 4)
+
+        # The columns are computed on clones of the executive from the same
+        # state so the matrices must be identical.
+        for s, p in zip(serial.state_space, parallel.state_space):
+            np.testing.assert_array_equal(s, p)
+        np.testing.assert_array_equal(serial.x0, parallel.x0)
+        np.testing.assert_array_equal(serial.u0, parallel.u0)
+
 
 RunTest(TestLinearization)
@@ -0,0 +1,85 @@
+# TestModelCache.py
+#
+# Check that the models read from the on-disk cache of the parsed XML files
+# behave the same as the models parsed from the XML files.
+#
+# Copyright (c) 2026 The JSBSim team
+#
+# This program is free software; you can redistribute it and/or modify it under
+# the terms of the GNU General Public License as published by the Free Software
+# Foundation; either version 3 of the License, or (at your option) any later
+# version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+# FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+# details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program; if not, see <http://www.gnu.org/licenses/>
+#
+
+import os
+from JSBSim_utils import JSBSimTestCase, RunTest
+
+PROPERTIES = ('position/h-sl-ft', 'velocities/vc-kts', 'attitude/phi-rad',
+              'attitude/theta-rad', 'propulsion/engine/engine-rpm')
+
+
+class TestModelCache(JSBSimTestCase):
+    def run_script(self, cache_dir=None):
+        fdm = self.create_fdm()
+        if cache_dir:
+            fdm.set_model_cache_path(cache_dir)
+        fdm.load_script(self.sandbox.path_to_jsbsim_file('scripts',
+                                                         'c1722.xml'))
+        fdm.run_ic()
+        for _ in range(1000):
+            fdm.run()
+        values = [fdm[name] for name in PROPERTIES]
+        self.delete_fdm()
+        return values
+
+    def cache_files(self, cache_dir):
+        return {f: os.path.getmtime(os.path.join(cache_dir, f))
+                for f in os.listdir(cache_dir) if f.endswith('.jsbc')}
+
+    def cache_sizes(self, cache_dir):
+        return {f: os.path.getsize(os.path.join(cache_dir, f))
+                for f in self.cache_files(cache_dir)}
+
+    def test_cache(self):
+        cache_dir = os.path.abspath(self.sandbox('cache'))
+        os.mkdir(cache_dir)
+        ref = self.run_script()
+
+        # First run: the files are parsed and written to the cache.
+        self.assertEqual(self.run_script(cache_dir), ref)
+        files = self.cache_files(cache_dir)
+        self.assertGreater(len(files), 1)
+
+        # Second run: the files are read from the cache which is not modified.
+        self.assertEqual(self.run_script(cache_dir), ref)
+        self.assertEqual(self.cache_files(cache_dir), files)
+
+    def test_corrupted_cache(self):
+        cache_dir = os.path.abspath(self.sandbox('cache'))
+        os.mkdir(cache_dir)
+        ref = self.run_script(cache_dir)
+        sizes = self.cache_sizes(cache_dir)
+
+        # Truncated cache files are ignored and written again.
+        for f, size in sizes.items():
+            with open(os.path.join(cache_dir, f), 'r+b') as cache_file:
+                cache_file.truncate(size // 2)
+
+        self.assertEqual(self.run_script(cache_dir), ref)
+        self.assertEqual(self.cache_sizes(cache_dir), sizes)
+
+    def test_missing_cache_dir(self):
+        # The files are parsed when the cache directory does not exist.
+        ref = self.run_script()
+        self.assertEqual(self.run_script(self.sandbox('no_cache')), ref)
+
+
+RunTest(TestModelCache)
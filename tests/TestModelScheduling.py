@@ -0,0 +1,105 @@
+# TestModelScheduling.py
+#
+# Check that the models run at the rate and phase they are scheduled at and
+# that the default schedule does not alter the results.
+#
+# Copyright (c) 2026 The JSBSim team
+#
+# This program is free software; you can redistribute it and/or modify it under
+# the terms of the GNU General Public License as published by the Free Software
+# Foundation; either version 3 of the License, or (at your option) any later
+# version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+# FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+# details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program; if not, see <http://www.gnu.org/licenses/>
+#
+
+from JSBSim_utils import JSBSimTestCase, CreateFDM, RunTest
+
+MODELS = ['propagate', 'input', 'inertial', 'atmosphere', 'winds', 'systems',
+          'mass-balance', 'auxiliary', 'propulsion', 'aerodynamics',
+          'ground-reactions', 'external-reactions', 'buoyant-forces',
+          'aircraft', 'accelerations', 'output']
+
+
+class TestModelScheduling(JSBSimTestCase):
+    def load_c172(self, properties={}):
+        fdm = CreateFDM(self.sandbox)
+        fdm.load_script(self.sandbox.path_to_jsbsim_file('scripts',
+                                                         'c1721.xml'))
+        for name, value in properties.items():
+            fdm[name] = value
+        fdm.run_ic()
+        return fdm
+
+    def test_default_schedule(self):
+        fdm = self.load_c172()
+        for model in MODELS:
+            self.assertEqual(fdm[f'simulation/models/{model}/rate'], 1)
+            self.assertEqual(fdm[f'simulation/models/{model}/phase'], 0)
+
+        # Setting explicitly the default rates does not alter the results.
+        ref = self.load_c172({f'simulation/models/{model}/rate': 1
+                              for model in MODELS})
+        for _ in range(500):
+            fdm.run()
+            ref.run()
+            self.assertEqual(fdm['position/h-sl-ft'], ref['position/h-sl-ft'])
+            self.assertEqual(fdm['attitude/theta-rad'],
+                             ref['attitude/theta-rad'])
+
+    def calls(self, fdm, model):
+        return fdm[f'simulation/profile/models/{model}/calls']
+
+    def test_rate_and_phase(self):
+        fdm = self.load_c172({'simulation/models/mass-balance/rate': 4,
+                              'simulation/models/mass-balance/phase': 1,
+                              'simulation/models/aerodynamics/rate': 3,
+                              'simulation/models/timing': 1})
+        # RunIC() executes the models twice
+        cycle = 2
+
+        for _ in range(60):
+            mass_balance = self.calls(fdm, 'mass-balance')
+            aerodynamics = self.calls(fdm, 'aerodynamics')
+            propagate = self.calls(fdm, 'propagate')
+            fdm.run()
+
+            self.assertEqual(self.calls(fdm, 'mass-balance') - mass_balance,
+                             1 if cycle % 4 == 1 else 0)
+            self.assertEqual(self.calls(fdm, 'aerodynamics') - aerodynamics,
+                             1 if cycle % 3 == 0 else 0)
+            self.assertEqual(self.calls(fdm, 'propagate') - propagate, 1)
+            cycle += 1
+
+    def test_disabled_model(self):
+        fdm = self.load_c172({'simulation/models/timing': 1})
+        fdm['simulation/models/aerodynamics/rate'] = 0
+        calls = self.calls(fdm, 'aerodynamics')
+
+        for _ in range(10):
+            fdm.run()
+
+        self.assertEqual(self.calls(fdm, 'aerodynamics'), calls)
+
+    def test_disabled_model_substeps(self):
+        # A disabled model is not run at the sub-steps either: the gear forces
+        # of the aircraft standing on the runway must remain constant.
+        fdm = self.load_c172()
+        fdm['simulation/models/ground-reactions/rate'] = 0
+        fdm['simulation/integrator/substeps'] = 4
+        fbz = fdm['forces/fbz-gear-lbs']
+        self.assertNotEqual(fbz, 0.0)
+
+        for _ in range(20):
+            fdm.run()
+
+        self.assertEqual(fdm['forces/fbz-gear-lbs'], fbz)
+
+
+RunTest(TestModelScheduling)
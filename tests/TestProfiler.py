@@ -0,0 +1,70 @@
+# TestProfiler.py
+#
+# Check that the profiler measures the models, the FCS channels and components
+# and the aerodynamic functions only when it is enabled.
+#
+# Copyright (c) 2026 The JSBSim team
+#
+# This program is free software; you can redistribute it and/or modify it under
+# the terms of the GNU General Public License as published by the Free Software
+# Foundation; either version 3 of the License, or (at your option) any later
+# version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+# FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+# details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program; if not, see <http://www.gnu.org/licenses/>
+#
+
+from JSBSim_utils import JSBSimTestCase, CreateFDM, RunTest
+
+ENTRIES = ['frame', 'models/propagate', 'models/systems',
+           'systems/pitch-altitude-hold',
+           'systems/pitch-altitude-hold/fcs/altitude-hold-pid',
+           'aerodynamics/aero/coefficient/CDo']
+
+
+class TestProfiler(JSBSimTestCase):
+    def load_c172(self):
+        fdm = CreateFDM(self.sandbox)
+        fdm.load_script(self.sandbox.path_to_jsbsim_file('scripts',
+                                                         'c1722.xml'))
+        fdm.run_ic()
+        return fdm
+
+    def test_disabled(self):
+        fdm = self.load_c172()
+        self.assertFalse(fdm['simulation/profile/enabled'])
+
+        for _ in range(10):
+            fdm.run()
+
+        for entry in ENTRIES:
+            self.assertEqual(fdm[f'simulation/profile/{entry}/calls'], 0)
+            self.assertEqual(fdm[f'simulation/profile/{entry}/total-sec'], 0.0)
+
+    def test_enabled(self):
+        fdm = self.load_c172()
+        fdm['simulation/profile/enabled'] = 1
+
+        for _ in range(10):
+            fdm.run()
+
+        for entry in ENTRIES:
+            self.assertEqual(fdm[f'simulation/profile/{entry}/calls'], 10)
+            total = fdm[f'simulation/profile/{entry}/total-sec']
+            self.assertGreater(total, 0.0)
+            self.assertLessEqual(total, fdm['simulation/profile/frame/total-sec'])
+            self.assertLessEqual(fdm[f'simulation/profile/{entry}/max-us'],
+                                 total*1E6)
+
+        # The measurements stop when the profiler is disabled.
+        fdm['simulation/profile/enabled'] = 0
+        fdm.run()
+        self.assertEqual(fdm['simulation/profile/frame/calls'], 10)
+
+
+RunTest(TestProfiler)
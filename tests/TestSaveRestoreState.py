@@ -0,0 +1,96 @@
+# TestSaveRestoreState.py
+#
+# Check that a simulation restored from a state saved by FGFDMExec::SaveState()
+# continues exactly as the original simulation.
+#
+# Copyright (c) 2026 The JSBSim team
+#
+# This program is free software; you can redistribute it and/or modify it under
+# the terms of the GNU General Public License as published by the Free Software
+# Foundation; either version 3 of the License, or (at your option) any later
+# version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+# FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+# details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program; if not, see <http://www.gnu.org/licenses/>
+#
+
+from JSBSim_utils import JSBSimTestCase, RunTest, ExecuteUntil
+
+import jsbsim
+
+PROPERTIES = ['position/h-sl-ft', 'position/lat-geod-rad',
+              'position/long-gc-rad', 'velocities/u-fps', 'velocities/v-fps',
+              'velocities/w-fps', 'velocities/p-rad_sec',
+              'velocities/q-rad_sec', 'velocities/r-rad_sec',
+              'attitude/phi-rad', 'attitude/theta-rad', 'attitude/psi-rad',
+              'propulsion/engine/engine-rpm', 'propulsion/tank/contents-lbs',
+              'fcs/throttle-pos-norm', 'fcs/aileron-cmd-norm',
+              'fcs/left-aileron-pos-rad', 'gear/unit/compression-ft',
+              'gear/unit[1]/compression-ft', 'atmosphere/total-wind-north-fps',
+              'atmosphere/total-wind-east-fps',
+              'atmosphere/total-wind-down-fps']
+
+
+class TestSaveRestoreState(JSBSimTestCase):
+    def setUp(self):
+        JSBSimTestCase.setUp(self)
+        self.fdm = self.create_fdm()
+        self.load_script('c1723.xml')
+        self.fdm.run_ic()
+        self.fdm['atmosphere/turb-type'] = 3
+        self.fdm['atmosphere/turbulence/milspec/windspeed_at_20ft_AGL-fps'] = 30
+        self.fdm['atmosphere/turbulence/milspec/severity'] = 4
+        ExecuteUntil(self.fdm, 15.0)
+
+    def record(self, fdm, duration):
+        end_time = fdm.get_sim_time() + duration
+        history = []
+        while fdm.get_sim_time() <= end_time:
+            fdm.run()
+            history.append([fdm.get_sim_time()] +
+                           [fdm[prop] for prop in PROPERTIES])
+        return history
+
+    def test_restore_in_same_fdm(self):
+        state = self.fdm.save_state()
+        self.assertIsInstance(state, bytes)
+
+        reference = self.record(self.fdm, 10.0)
+        self.fdm.restore_state(state)
+        self.assertEqual(self.record(self.fdm, 10.0), reference)
+
+        # A state can be restored more than once.
+        self.fdm.restore_state(state)
+        self.assertEqual(self.record(self.fdm, 10.0), reference)
+
+    def test_restore_in_new_fdm(self):
+        state = self.fdm.save_state()
+        reference = self.record(self.fdm, 10.0)
+
+        fdm = self.create_fdm()
+        fdm.load_script(self.sandbox.path_to_jsbsim_file('scripts',
+                                                         'c1723.xml'))
+        fdm.run_ic()
+        fdm.restore_state(state)
+        self.assertEqual(self.record(fdm, 10.0), reference)
+
+    def test_invalid_state(self):
+        state = self.fdm.save_state()
+
+        with self.assertRaises(jsbsim.BaseError):
+            self.fdm.restore_state(state[:len(state)//2])
+        with self.assertRaises(jsbsim.BaseError):
+            self.fdm.restore_state(b'Not a state')
+
+        fdm = self.create_fdm()
+        fdm.load_model('ball')
+        with self.assertRaises(jsbsim.BaseError):
+            fdm.restore_state(state)
+
+
+RunTest(TestSaveRestoreState)
@@ -0,0 +1,168 @@
+# TestSharedMemory.py
+#
+# Check the input and output of properties through shared memory segments.
+#
+# Copyright (c) 2026 The JSBSim team
+#
+# This program is free software; you can redistribute it and/or modify it under
+# the terms of the GNU General Public License as published by the Free Software
+# Foundation; either version 3 of the License, or (at your option) any later
+# version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+# FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+# details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program; if not, see <http://www.gnu.org/licenses/>
+#
+
+import mmap
+import os
+import struct
+import unittest
+import xml.etree.ElementTree as et
+from JSBSim_utils import JSBSimTestCase, RunTest
+
+# Layout of the header defined in jsbsim_shm.h
+HEADER = struct.Struct('=IHHIIIIQ')
+SEQUENCE_OFFSET = 24
+MAGIC = 0x4d42534a
+SHM_DIR = '/dev/shm'
+
+
+class Segment:
+    def __init__(self, name):
+        with open(os.path.join(SHM_DIR, name), 'r+b') as f:
+            self.map = mmap.mmap(f.fileno(), 0)
+        (self.magic, self.version, self.direction, self.num_values,
+         self.values_offset, names_offset, names_size,
+         _) = HEADER.unpack_from(self.map)
+        names = self.map[names_offset:names_offset+names_size]
+        self.names = names.decode().split('\0')[:-1]
+
+    def close(self):
+        self.map.close()
+
+    @property
+    def sequence(self):
+        return struct.unpack_from('=Q', self.map, SEQUENCE_OFFSET)[0]
+
+    @sequence.setter
+    def sequence(self, value):
+        struct.pack_into('=Q', self.map, SEQUENCE_OFFSET, value)
+
+    @property
+    def values(self):
+        return struct.unpack_from(f'={self.num_values}d', self.map,
+                                  self.values_offset)
+
+    @values.setter
+    def values(self, values):
+        struct.pack_into(f'={self.num_values}d', self.map, self.values_offset,
+                         *values)
+
+    def write(self, values):
+        # Same protocol as jsbsim_shm_write()
+        sequence = self.sequence
+        self.sequence = sequence + 1
+        self.values = values
+        self.sequence = sequence + 2
+
+
+@unittest.skipUnless(os.path.isdir(SHM_DIR),
+                     'POSIX shared memory is not available')
+class TestSharedMemory(JSBSimTestCase):
+    def load(self, io, name, properties, **attrib):
+        script_path = self.sandbox.path_to_jsbsim_file('scripts', 'c1722.xml')
+        tree = et.parse(script_path)
+        tag = et.SubElement(tree.getroot(), io)
+        tag.attrib.update({'type': 'SHM', 'name': name, **attrib})
+        for name in properties:
+            property_tag = et.SubElement(tag, 'property')
+            property_tag.text = name
+        tree.write('c1722_0.xml')
+
+        fdm = self.create_fdm()
+        # The input properties must exist before the script is loaded.
+        if io == 'input':
+            for name in properties:
+                fdm[name] = 0.0
+        fdm.load_script('c1722_0.xml')
+        fdm.run_ic()
+        return fdm
+
+    def test_output(self):
+        properties = ('position/h-sl-ft', 'velocities/vc-kts')
+        fdm = self.load('output', 'jsbsim_test_out', properties, rate='120')
+        segment = Segment('jsbsim_test_out')
+
+        self.assertEqual(segment.magic, MAGIC)
+        self.assertEqual(segment.version, 1)
+        self.assertEqual(segment.direction, 0)
+        self.assertEqual(segment.names,
+                         ['Time'] + [f'/fdm/jsbsim/{p}' for p in properties])
+
+        for _ in range(10):
+            fdm.run()
+            sequence = segment.sequence
+            self.assertEqual(sequence % 2, 0)
+            values = segment.values
+            self.assertEqual(values[0], fdm.get_sim_time())
+            for name, value in zip(properties, values[1:]):
+                self.assertEqual(value, fdm[name])
+            fdm.run()
+            self.assertEqual(segment.sequence, sequence + 2)
+
+        segment.close()
+        del fdm
+        self.delete_fdm()
+        self.assertFalse(os.path.exists(os.path.join(SHM_DIR,
+                                                     'jsbsim_test_out')))
+
+    def test_input(self):
+        properties = ('test/a', 'test/b')
+        fdm = self.load('input', 'jsbsim_test_in', properties)
+        segment = Segment('jsbsim_test_in')
+
+        self.assertEqual(segment.magic, MAGIC)
+        self.assertEqual(segment.direction, 1)
+        self.assertEqual(segment.names, list(properties))
+        self.assertEqual(segment.sequence, 0)
+
+        # The properties are not modified until a record has been written.
+        fdm['test/a'] = 5.0
+        fdm.run()
+        self.assertEqual(fdm['test/a'], 5.0)
+
+        segment.write((1.5, -2.0))
+        fdm.run()
+        self.assertEqual(fdm['test/a'], 1.5)
+        self.assertEqual(fdm['test/b'], -2.0)
+
+        # The same record is only applied once.
+        fdm['test/a'] = 5.0
+        fdm.run()
+        self.assertEqual(fdm['test/a'], 5.0)
+
+        # A record that is being written is ignored.
+        segment.sequence += 1
+        segment.values = (3.0, 4.0)
+        fdm.run()
+        self.assertEqual(fdm['test/a'], 5.0)
+        segment.sequence += 1
+        fdm.run()
+        self.assertEqual(fdm['test/a'], 3.0)
+        self.assertEqual(fdm['test/b'], 4.0)
+
+        # The segment survives a reset of the simulation.
+        fdm.reset_to_initial_conditions(0)
+        segment.write((7.0, 8.0))
+        fdm.run()
+        self.assertEqual(fdm['test/a'], 7.0)
+
+        segment.close()
+
+
+RunTest(TestSharedMemory)
@@ -0,0 +1,88 @@
+# TestSocketOutput.py
+#
+# Check the records sent by the socket output.
+#
+# Copyright (c) 2026 The JSBSim team
+#
+# This program is free software; you can redistribute it and/or modify it under
+# the terms of the GNU General Public License as published by the Free Software
+# Foundation; either version 3 of the License, or (at your option) any later
+# version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+# FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+# details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program; if not, see <http://www.gnu.org/licenses/>
+#
+
+import socket
+import xml.etree.ElementTree as et
+from JSBSim_utils import JSBSimTestCase, RunTest
+
+PROPERTIES = ('position/h-sl-ft', 'velocities/vc-kts', 'attitude/phi-rad')
+
+
+class TestSocketOutput(JSBSimTestCase):
+    def setUp(self, *args):
+        super().setUp(*args)
+        self.sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+        self.sock.settimeout(5.0)
+
+    def tearDown(self):
+        self.sock.close()
+        super().tearDown()
+
+    def load(self, port, **attrib):
+        self.sock.bind(('127.0.0.1', port))
+        script_path = self.sandbox.path_to_jsbsim_file('scripts', 'c1722.xml')
+        tree = et.parse(script_path)
+        output_tag = et.SubElement(tree.getroot(), 'output')
+        output_tag.attrib.update({'type': 'SOCKET', 'name': '127.0.0.1',
+                                  'port': str(port), 'protocol': 'UDP',
+                                  'rate': '120', **attrib})
+        for name in PROPERTIES:
+            property_tag = et.SubElement(output_tag, 'property')
+            property_tag.text = name
+        tree.write('c1722_0.xml')
+
+        fdm = self.create_fdm()
+        fdm.load_script('c1722_0.xml')
+        fdm.run_ic()
+        return fdm
+
+    def receive(self):
+        data = self.sock.recv(65536).decode()
+        self.assertEqual(data[-1], '\n')
+        return data[:-1].split(',')
+
+    def check_records(self, fdm, precision):
+        labels = self.receive()
+        self.assertEqual(labels[0], '<LABELS> ')
+        self.assertEqual(labels[1], 'Time')
+        self.assertEqual(len(labels), len(PROPERTIES) + 2)
+
+        # The first record is sent by run_ic().
+        for i in range(20):
+            if i > 0:
+                fdm.run()
+            fields = self.receive()
+            values = [fdm.get_sim_time()] + [fdm[name] for name in PROPERTIES]
+            self.assertEqual(len(fields), len(values))
+            # The values are right aligned on 12 characters with the requested
+            # number of significant digits.
+            for field, value in zip(fields, values):
+                self.assertEqual(field, '%12.*g' % (precision, value))
+
+    def test_default_precision(self):
+        fdm = self.load(5151)
+        self.check_records(fdm, 7)
+
+    def test_precision(self):
+        fdm = self.load(5152, precision='15')
+        self.check_records(fdm, 15)
+
+
+RunTest(TestSocketOutput)
@@ -0,0 +1,187 @@
+# TestSocketServer.py
+#
+# Check that several clients can be connected to the input socket at the same
+# time and that the properties can be streamed to them.
+#
+# Copyright (c) 2026 The JSBSim team
+#
+# This program is free software; you can redistribute it and/or modify it under
+# the terms of the GNU General Public License as published by the Free Software
+# Foundation; either version 3 of the License, or (at your option) any later
+# version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+# FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+# details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program; if not, see <http://www.gnu.org/licenses/>
+#
+
+import socket
+import xml.etree.ElementTree as et
+from JSBSim_utils import JSBSimTestCase, RunTest
+
+PROMPT = b'JSBSim> '
+
+
+class Client:
+    def __init__(self, fdm, port):
+        self.fdm = fdm
+        self.sock = socket.create_connection(('127.0.0.1', port))
+        self.sock.setblocking(False)
+        self.buffer = b''
+
+    def close(self):
+        self.sock.close()
+
+    def receive(self, until, max_steps=200):
+        # The server is only polled when the simulation runs so the FDM must be
+        # stepped until the expected data is received.
+        for _ in range(max_steps):
+            if until in self.buffer:
+                break
+            self.fdm.run()
+            try:
+                self.buffer += self.sock.recv(65536)
+            except BlockingIOError:
+                pass
+        pos = self.buffer.find(until)
+        assert pos >= 0, f'Timeout while waiting for {until}'
+        pos += len(until)
+        data, self.buffer = self.buffer[:pos], self.buffer[pos:]
+        return data.decode()
+
+    def command(self, line):
+        self.sock.sendall(line.encode() + b'\r\n')
+        return self.receive(PROMPT)[:-len(PROMPT)].strip()
+
+
+class TestSocketServer(JSBSimTestCase):
+    def load(self, port):
+        script_path = self.sandbox.path_to_jsbsim_file('scripts', 'c1722.xml')
+        tree = et.parse(script_path)
+        input_tag = et.SubElement(tree.getroot(), 'input')
+        input_tag.attrib['port'] = str(port)
+        tree.write('c1722_0.xml')
+
+        fdm = self.create_fdm()
+        for name in ('test/value', 'test/a', 'test/b'):
+            fdm[name] = 0.0
+        fdm.load_script('c1722_0.xml')
+        fdm.run_ic()
+        return fdm
+
+    def connect(self, fdm, port):
+        client = Client(fdm, port)
+        self.assertEqual(client.receive(PROMPT),
+                         'Connected to JSBSim server\r\nJSBSim> ')
+        return client
+
+    def test_multiple_clients(self):
+        fdm = self.load(1141)
+        first = self.connect(fdm, 1141)
+        second = self.connect(fdm, 1141)
+
+        self.assertEqual(first.command('set test/value 3.5'), 'set successful')
+        self.assertEqual(float(second.command('get test/value').split('=')[1]),
+                         3.5)
+        self.assertEqual(fdm['test/value'], 3.5)
+        self.assertEqual(second.command('set test/value -2'), 'set successful')
+        self.assertEqual(float(first.command('get test/value').split('=')[1]),
+                         -2.0)
+
+        # Both commands are executed during the same frame.
+        first.sock.sendall(b'set test/a 1\r\n')
+        second.sock.sendall(b'set test/b 2\r\n')
+        fdm.run()
+        self.assertEqual(fdm['test/a'], 1.0)
+        self.assertEqual(fdm['test/b'], 2.0)
+        first.receive(PROMPT)
+        second.receive(PROMPT)
+
+        # A client quitting does not disconnect the others.
+        first.sock.sendall(b'quit\r\n')
+        self.assertEqual(first.receive(b'\r\n').strip(), 'Closing connection')
+        first.close()
+        self.assertEqual(second.command('get test/a').split('=')[0].strip(),
+                         'test/a')
+        second.close()
+
+    def test_subscribe(self):
+        fdm = self.load(1142)
+        client = self.connect(fdm, 1142)
+        dt = fdm.get_delta_t()
+
+        self.assertEqual(client.command('subscribe 0 position/h-sl-ft'),
+                         'The rate must be a positive number.')
+        self.assertEqual(client.command('subscribe 10 position/unknown'),
+                         'Unknown property')
+        self.assertEqual(
+            client.command('subscribe 10 position/h-sl-ft velocities/vc-kts'),
+            'Subscription 0: time,position/h-sl-ft,velocities/vc-kts')
+
+        times = []
+        for _ in range(5):
+            line = client.receive(b'\r\n').strip()
+            fields = line.split(' ', 2)
+            self.assertEqual(fields[:2], ['DATA', '0'])
+            values = [float(v) for v in fields[2].split(',')]
+            self.assertEqual(len(values), 3)
+            times.append(values[0])
+
+        # The samples are sent at 10 Hz of simulation time.
+        for t0, t1 in zip(times, times[1:]):
+            self.assertAlmostEqual(t1 - t0, 0.1, delta=dt*1.01)
+
+        self.assertEqual(client.command('unsubscribe 3'),
+                         'Unknown subscription')
+        client.sock.sendall(b'unsubscribe 0\r\n')
+        client.receive(b'Unsubscribed\r\nJSBSim> ')
+        client.buffer = b''
+        for _ in range(120):
+            fdm.run()
+        self.assertEqual(client.command('info').splitlines()[0].split(':')[0],
+                         'JSBSim version')
+        self.assertNotIn(b'DATA', client.buffer)
+        client.close()
+
+
+    def test_client_closing(self):
+        fdm = self.load(1143)
+        client = self.connect(fdm, 1143)
+
+        # The commands sent just before the client disconnects are executed.
+        client.sock.sendall(b'set test/a 1\r\nset test/b 2\r\n')
+        client.close()
+        fdm.run()
+        self.assertEqual(fdm['test/a'], 1.0)
+        self.assertEqual(fdm['test/b'], 2.0)
+
+    def test_input_overflow(self):
+        fdm = self.load(1144)
+        client = self.connect(fdm, 1144)
+        other = self.connect(fdm, 1144)
+
+        # A client sending a line which never ends is disconnected.
+        client.sock.setblocking(True)
+        data = b'x' * 65536
+        try:
+            for _ in range(32):
+                client.sock.sendall(data)
+                fdm.run()
+        except (BrokenPipeError, ConnectionResetError):
+            pass
+        client.sock.settimeout(10.0)
+        try:
+            self.assertEqual(client.sock.recv(1024), b'')
+        except ConnectionResetError:
+            pass
+        client.close()
+
+        self.assertEqual(other.command('set test/value 1'), 'set successful')
+        other.close()
+
+
+RunTest(TestSocketServer)
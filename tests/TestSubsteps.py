@@ -0,0 +1,83 @@
+# TestSubsteps.py
+#
+# Check that sub-stepping the rigid body integration (fixed or adaptive)
+# improves the accuracy of a landing gear impact without changing the default
+# behavior.
+#
+# Copyright (c) 2026 The JSBSim team
+#
+# This program is free software; you can redistribute it and/or modify it under
+# the terms of the GNU General Public License as published by the Free Software
+# Foundation; either version 3 of the License, or (at your option) any later
+# version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+# FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+# details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program; if not, see <http://www.gnu.org/licenses/>
+#
+
+from JSBSim_utils import JSBSimTestCase, CreateFDM, RunTest
+
+
+class TestSubsteps(JSBSimTestCase):
+    def drop(self, dt, properties={}):
+        # Drop the aircraft from 2ft above the runway and return the height of
+        # its CG every 1/120s.
+        fdm = CreateFDM(self.sandbox)
+        fdm.load_model('c172x')
+        fdm['ic/h-agl-ft'] = 2.0
+        fdm['ic/theta-deg'] = 3.0
+        fdm['ic/vg-kts'] = 40.0
+        fdm.set_dt(dt)
+        for name, value in properties.items():
+            fdm[name] = value
+        fdm.run_ic()
+
+        every = round(1.0/(120.*dt))
+        heights = []
+        for frame in range(1, 240*every+1):
+            fdm.run()
+            if frame % every == 0:
+                heights.append(fdm['position/h-agl-ft'])
+
+        return heights, fdm
+
+    def max_error(self, heights, reference):
+        return max(abs(h-r) for h, r in zip(heights, reference))
+
+    def test_default(self):
+        heights, fdm = self.drop(1./120.)
+        self.assertEqual(fdm['simulation/integrator/substeps'], 1)
+        self.assertEqual(fdm['simulation/integrator/adaptive'], 0)
+        self.assertEqual(fdm['simulation/integrator/steps'], 1)
+
+        # Setting explicitly the default values does not alter the results.
+        same, _ = self.drop(1./120., {'simulation/integrator/substeps': 1,
+                                     'simulation/integrator/adaptive': 0})
+        self.assertEqual(heights, same)
+
+    def test_fixed_substeps(self):
+        reference, _ = self.drop(1./4800.)
+        heights, _ = self.drop(1./120.)
+        substeps, fdm = self.drop(1./120., {'simulation/integrator/substeps': 8})
+
+        self.assertEqual(fdm['simulation/integrator/steps'], 8)
+        self.assertLess(self.max_error(substeps, reference),
+                        0.2*self.max_error(heights, reference))
+
+    def test_adaptive(self):
+        reference, _ = self.drop(1./4800.)
+        heights, _ = self.drop(1./120.)
+        adaptive, fdm = self.drop(1./120., {'simulation/integrator/adaptive': 1,
+                                            'simulation/integrator/tolerance': 1E-6})
+
+        self.assertGreaterEqual(fdm['simulation/integrator/steps'], 1)
+        self.assertLess(self.max_error(adaptive, reference),
+                        0.2*self.max_error(heights, reference))
+
+
+RunTest(TestSubsteps)
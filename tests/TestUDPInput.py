@@ -0,0 +1,109 @@
+# TestUDPInput.py
+#
+# Check that the UDP input socket decodes the text and binary datagrams.
+#
+# Copyright (c) 2026 The JSBSim team
+#
+# This program is free software; you can redistribute it and/or modify it under
+# the terms of the GNU General Public License as published by the Free Software
+# Foundation; either version 3 of the License, or (at your option) any later
+# version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+# FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+# details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program; if not, see <http://www.gnu.org/licenses/>
+#
+
+import socket
+import struct
+import xml.etree.ElementTree as et
+from JSBSim_utils import JSBSimTestCase, RunTest
+
+PROPERTIES = (('test/double', 'double'), ('test/float', 'float'),
+              ('test/int16', 'int16'), ('test/uint8', 'uint8'),
+              ('test/int32', 'int32'))
+
+
+class TestUDPInput(JSBSimTestCase):
+    def setUp(self, *args):
+        super().setUp(*args)
+        self.sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+
+    def tearDown(self):
+        self.sock.close()
+        super().tearDown()
+
+    def load(self, port, **attrib):
+        script_path = self.sandbox.path_to_jsbsim_file('scripts', 'c1722.xml')
+        tree = et.parse(script_path)
+        input_tag = et.SubElement(tree.getroot(), 'input')
+        input_tag.attrib.update({'type': 'UDP', 'port': str(port),
+                                 'rate': '120', **attrib})
+        for name, field_type in PROPERTIES:
+            property_tag = et.SubElement(input_tag, 'property')
+            property_tag.text = name
+            property_tag.attrib['type'] = field_type
+        tree.write('c1722_0.xml')
+
+        fdm = self.create_fdm()
+        # The input properties must exist before the script is loaded.
+        for name, _ in PROPERTIES:
+            fdm[name] = 0.0
+        fdm.load_script('c1722_0.xml')
+        fdm.run_ic()
+        self.port = port
+        return fdm
+
+    def send(self, fdm, data):
+        self.sock.sendto(data, ('127.0.0.1', self.port))
+        fdm.run()
+
+    def check_values(self, fdm, values):
+        for (name, _), value in zip(PROPERTIES, values):
+            self.assertEqual(fdm[name], value, msg=name)
+
+    def test_text_input(self):
+        fdm = self.load(5141)
+        self.send(fdm, b'1.0,3.25,0.5,-300,200,-70000')
+        self.check_values(fdm, (3.25, 0.5, -300, 200, -70000))
+
+    def test_binary_input(self):
+        fdm = self.load(5142, format='binary')
+        values = (3.25, 0.5, -300, 200, -70000)
+        self.send(fdm, struct.pack('<ddfhBi', 1.0, *values))
+        self.check_values(fdm, values)
+
+        # Records with the wrong size are ignored.
+        self.send(fdm, struct.pack('<ddfhBi', 2.0, *values)[:-1])
+        self.send(fdm, struct.pack('<ddfhBib', 2.0, *values, 0))
+        self.check_values(fdm, values)
+
+        # Records older than the previous one are ignored.
+        self.send(fdm, struct.pack('<ddfhBi', 0.5, -1.0, -1.0, -1, 1, -1))
+        self.check_values(fdm, values)
+
+        values = (-1.5, 0.125, 32767, 255, 2**31-1)
+        self.send(fdm, struct.pack('<ddfhBi', 2.0, *values))
+        self.check_values(fdm, values)
+
+    def test_binary_input_drain(self):
+        fdm = self.load(5144, format='binary')
+        # All the pending records are read and only the newest is applied.
+        for t in range(1, 4):
+            self.sock.sendto(struct.pack('<ddfhBi', t, t, t, t, t, t),
+                             ('127.0.0.1', self.port))
+        self.send(fdm, struct.pack('<ddfhBi', 4.0, 4.0, 4.0, 4, 4, 4)[:-1])
+        self.check_values(fdm, (3.0, 3.0, 3, 3, 3))
+
+    def test_big_endian_input(self):
+        fdm = self.load(5143, format='binary', byte_order='big')
+        values = (-7.75, 1.5, -2, 17, 123456789)
+        self.send(fdm, struct.pack('>ddfhBi', 1.0, *values))
+        self.check_values(fdm, values)
+
+
+RunTest(TestUDPInput)
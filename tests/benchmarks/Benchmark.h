@@ -0,0 +1,224 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Header:       Benchmark.h
+ Author:       The JSBSim team
+ Date started: 10/16/26
+
+ ------------- Copyright (C) 2026 The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc., 59
+ Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/16/26         Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+SENTRY
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <ctime>
+#include <functional>
+#include <iomanip>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DOCUMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/** A minimal micro-benchmark harness.
+    A benchmark is a function that executes n iterations of the code to measure
+    and returns a value computed from their results so that the compiler cannot
+    optimize the work away. An optional reset function is called before each
+    batch of iterations and is not timed.
+
+    The number of iterations of a batch is calibrated so that it lasts about
+    MinTime seconds, then Repetitions batches are timed. The results are the
+    statistics of the time per iteration over the repetitions. They can be
+    printed as a table or written in JSON.
+
+    @author The JSBSim team
+*/
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DECLARATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace JSBSimBenchmark {
+
+struct Result {
+  std::string name;
+  size_t iterations = 0;
+  // Time per iteration of each repetition in nanoseconds.
+  std::vector<double> samples;
+
+  double Min(void) const { return *std::min_element(samples.begin(), samples.end()); }
+  double Mean(void) const {
+    double sum = 0.0;
+    for (double s: samples) sum += s;
+    return sum / samples.size();
+  }
+  double Median(void) const {
+    std::vector<double> sorted(samples);
+    std::sort(sorted.begin(), sorted.end());
+    size_t n = sorted.size();
+    return n % 2 ? sorted[n/2] : 0.5*(sorted[n/2-1] + sorted[n/2]);
+  }
+  double StdDev(void) const {
+    if (samples.size() < 2) return 0.0;
+    double mean = Mean(), sum = 0.0;
+    for (double s: samples) sum += (s - mean)*(s - mean);
+    return std::sqrt(sum / (samples.size() - 1));
+  }
+};
+
+class Suite {
+public:
+  using Body = std::function<double(size_t)>;
+
+  double MinTime = 0.1;
+  unsigned int Repetitions = 5;
+  std::string Filter;
+
+  void Add(const std::string& name, Body body,
+           std::function<void(void)> reset = nullptr)
+  {
+    Benchmarks.push_back({name, body, reset});
+  }
+
+  std::vector<std::string> GetNames(void) const {
+    std::vector<std::string> names;
+    for (auto& b: Benchmarks) names.push_back(b.name);
+    return names;
+  }
+
+  /// Runs the benchmarks which name contains Filter and prints their results.
+  std::vector<Result> Run(std::ostream& out) {
+    std::vector<Result> results;
+
+    out << std::left << std::setw(40) << "benchmark" << std::right
+        << std::setw(12) << "iterations" << std::setw(14) << "median (ns)"
+        << std::setw(14) << "min (ns)" << std::setw(12) << "stddev %" << std::endl;
+
+    for (auto& b: Benchmarks) {
+      if (b.name.find(Filter) == std::string::npos) continue;
+
+      Result result;
+      result.name = b.name;
+      result.iterations = Calibrate(b);
+      for (unsigned int i=0; i<Repetitions; i++)
+        result.samples.push_back(Time(b, result.iterations) * 1E9 / result.iterations);
+
+      double median = result.Median();
+      std::ios_base::fmtflags flags = out.flags();
+      out << std::left << std::setw(40) << result.name << std::right
+          << std::setw(12) << result.iterations << std::fixed
+          << std::setprecision(1) << std::setw(14) << median
+          << std::setw(14) << result.Min() << std::setw(12)
+          << (median > 0.0 ? 100.*result.StdDev()/median : 0.0) << std::endl;
+      out.flags(flags);
+
+      results.push_back(result);
+    }
+
+    return results;
+  }
+
+private:
+  struct Benchmark {
+    std::string name;
+    Body body;
+    std::function<void(void)> reset;
+  };
+  std::vector<Benchmark> Benchmarks;
+  // Keeps the values returned by the benchmarks alive.
+  volatile double sink = 0.0;
+
+  double Time(Benchmark& b, size_t n) {
+    if (b.reset) b.reset();
+    auto start = std::chrono::steady_clock::now();
+    sink = sink + b.body(n);
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count();
+  }
+
+  size_t Calibrate(Benchmark& b) {
+    size_t n = 1;
+    double elapsed = Time(b, n);
+    while (elapsed < 0.1*MinTime) {
+      n *= 10;
+      elapsed = Time(b, n);
+    }
+    return std::max<size_t>(1, n * MinTime / elapsed);
+  }
+};
+
+/// Writes the results in JSON.
+inline void WriteJSON(std::ostream& out, const std::vector<Result>& results,
+                      const std::string& version)
+{
+  char date[32];
+  std::time_t now = std::time(nullptr);
+  std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", std::localtime(&now));
+
+  out << "{" << std::endl
+      << "  \"context\": {" << std::endl
+      << "    \"date\": \"" << date << "\"," << std::endl
+      << "    \"jsbsim_version\": \"" << version << "\"," << std::endl
+      << "    \"num_cpus\": " << std::thread::hardware_concurrency() << std::endl
+      << "  }," << std::endl
+      << "  \"benchmarks\": [";
+
+  std::ios_base::fmtflags flags = out.flags();
+  std::streamsize precision = out.precision();
+  out << std::fixed << std::setprecision(3);
+
+  for (size_t i=0; i<results.size(); i++) {
+    const Result& r = results[i];
+    out << (i ? "," : "") << std::endl
+        << "    {" << std::endl
+        << "      \"name\": \"" << r.name << "\"," << std::endl
+        << "      \"iterations\": " << r.iterations << "," << std::endl
+        << "      \"repetitions\": " << r.samples.size() << "," << std::endl
+        << "      \"time_unit\": \"ns\"," << std::endl
+        << "      \"median\": " << r.Median() << "," << std::endl
+        << "      \"mean\": " << r.Mean() << "," << std::endl
+        << "      \"min\": " << r.Min() << "," << std::endl
+        << "      \"stddev\": " << r.StdDev() << std::endl
+        << "    }";
+  }
+  out << std::endl << "  ]" << std::endl << "}" << std::endl;
+
+  out.flags(flags);
+  out.precision(precision);
+}
+}
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+#endif
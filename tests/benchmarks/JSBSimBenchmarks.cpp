@@ -0,0 +1,682 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       JSBSimBenchmarks.cpp
+ Author:       The JSBSim team
+ Date started: 10/16/26
+ Purpose:      Micro-benchmarks of the core math and lookup kernels
+
+ ------------- Copyright (C) 2026 The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc., 59
+ Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+FUNCTIONAL DESCRIPTION
+--------------------------------------------------------------------------------
+Measures the time spent in the table lookups, the parsing of the table data,
+the functions evaluation, the geodetic conversions, the quaternion and matrix
+operations, the property reads and a complete frame of the c172x, 737 and f16
+models.
+
+Usage: JSBSimBenchmarks [--filter=<text>] [--min-time=<seconds>]
+                        [--repetitions=<number>] [--json=<filename>]
+                        [--root=<path>] [--list]
+
+The results can be written to a JSON file and compared to a previous run with
+compare_benchmarks.py to track the performance regressions.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/16/26         Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <sstream>
+
+#include "Benchmark.h"
+#include "FGFDMExec.h"
+#include "initialization/FGInitialCondition.h"
+#include "input_output/FGLog.h"
+#include "input_output/FGXMLFileRead.h"
+#include "input_output/FGXMLParse.h"
+#include "input_output/string_utilities.h"
+#include "math/FGFunction.h"
+#include "math/FGLocation.h"
+#include "math/FGMatrix33.h"
+#include "math/FGPropertyValue.h"
+#include "math/FGQuaternion.h"
+#include "math/FGTable.h"
+#include "models/FGPropulsion.h"
+
+using namespace std;
+using namespace JSBSim;
+using JSBSimBenchmark::Suite;
+
+#ifndef JSBSIM_ROOT_DIR
+#define JSBSIM_ROOT_DIR "."
+#endif
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+HELPER FUNCTIONS
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace {
+
+// The inputs of the benchmarks are cycled through NumSamples precomputed
+// values so that the caches and the branch predictors do not see a constant.
+constexpr size_t NumSamples = 1024;
+
+// Deterministic pseudo-random numbers so that the runs are comparable.
+class Random {
+public:
+  double operator()(double min, double max) {
+    state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+    return min + (max - min) * (state >> 11) * (1.0 / 9007199254740992.0);
+  }
+private:
+  uint64_t state = 0x853c49e6748fea9bULL;
+};
+
+Element_ptr readFromXML(const string& XML)
+{
+  istringstream data(XML);
+  FGXMLParse parser;
+  readXML(data, parser);
+  return parser.GetDocument();
+}
+
+// Breakpoints of an axis: 0, 1, ..., n-1 or a grid refined around 0.
+double Breakpoint(unsigned int i, unsigned int n, bool uniform)
+{
+  if (uniform) return i;
+  double x = double(i) / (n - 1);
+  return (n - 1) * x * x;
+}
+
+// Writes the data of the table axes [0, dim) at the position given by index.
+void WriteTableData(ostringstream& xml, const vector<unsigned int>& sizes,
+                    unsigned int dim, vector<unsigned int>& index, bool uniform)
+{
+  if (dim == 0) {
+    // 1D table: one key and one value per line.
+    for (unsigned int i=0; i<sizes[0]; i++) {
+      index[0] = i;
+      xml << Breakpoint(i, sizes[0], uniform) << " " << sin(i + 0.1*index[1])
+          << "\n";
+    }
+  } else if (dim == 1) {
+    // 2D table: the column keys, then the row key and its values on each line.
+    for (unsigned int j=0; j<sizes[1]; j++)
+      xml << " " << Breakpoint(j, sizes[1], uniform);
+    xml << "\n";
+    for (unsigned int i=0; i<sizes[0]; i++) {
+      xml << Breakpoint(i, sizes[0], uniform);
+      for (unsigned int j=0; j<sizes[1]; j++) {
+        double sum = 0.0;
+        for (unsigned int k=2; k<index.size(); k++) sum += index[k];
+        xml << " " << sin(i + 0.5*j + 0.25*sum);
+      }
+      xml << "\n";
+    }
+  } else {
+    for (unsigned int k=0; k<sizes[dim]; k++) {
+      index[dim] = k;
+      xml << "<tableData breakPoint=\"" << Breakpoint(k, sizes[dim], uniform)
+          << "\">\n";
+      WriteTableData(xml, sizes, dim-1, index, uniform);
+      xml << "</tableData>\n";
+    }
+  }
+}
+
+// Builds a table which axis i has sizes[i] breakpoints.
+unique_ptr<FGTable> MakeTable(shared_ptr<FGPropertyManager> pm,
+                              const vector<unsigned int>& sizes, bool uniform)
+{
+  ostringstream xml;
+  vector<unsigned int> index(max<size_t>(sizes.size(), 2), 0);
+
+  xml << "<dummy><table>\n";
+  for (unsigned int i=0; i<sizes.size(); i++) {
+    xml << "<independentVar lookup=\"axis" << i+1 << "\">x" << i+1
+        << "</independentVar>\n";
+    pm->GetNode("x" + to_string(i+1), true);
+  }
+  if (sizes.size() < 3) {
+    xml << "<tableData>\n";
+    WriteTableData(xml, sizes, sizes.size()-1, index, uniform);
+    xml << "</tableData>\n";
+  } else
+    WriteTableData(xml, sizes, sizes.size()-1, index, uniform);
+  xml << "</table></dummy>";
+
+  Element_ptr el = readFromXML(xml.str());
+  return make_unique<FGTable>(pm, el->FindElement("table"));
+}
+
+// Returns the first table of the function named name in the document el.
+Element* FindFunctionTable(Element* el, const string& name, bool found=false)
+{
+  if (found && el->GetName() == "table") return el;
+  found = found || (el->GetName() == "function"
+                    && el->GetAttributeValue("name") == name);
+
+  for (unsigned int i=0; i<el->GetNumElements(); i++) {
+    Element* table = FindFunctionTable(el->GetElement(i), name, found);
+    if (table) return table;
+  }
+  return nullptr;
+}
+
+string TableName(const vector<unsigned int>& sizes, bool uniform)
+{
+  string name = "table/" + to_string(sizes.size()) + "d/";
+  for (unsigned int i=0; i<sizes.size(); i++)
+    name += (i ? "x" : "") + to_string(sizes[i]);
+  return name + (uniform ? "/uniform" : "/nonuniform");
+}
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+BENCHMARKS
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+void AddTableBenchmarks(Suite& suite)
+{
+  const vector<vector<unsigned int>> configurations = {
+    {8}, {64}, {512}, {8, 8}, {32, 32}, {128, 128}, {4, 4, 4}, {16, 16, 16},
+    {4, 4, 4, 4}, {8, 8, 8, 8}
+  };
+  auto pm = make_shared<FGPropertyManager>();
+
+  for (bool uniform: {true, false}) {
+    for (auto& sizes: configurations) {
+      shared_ptr<FGTable> table = MakeTable(pm, sizes, uniform);
+      // The keys slightly overflow the breakpoints to exercise the clamping.
+      auto keys = make_shared<vector<vector<double>>>(NumSamples);
+      Random random;
+      for (auto& k: *keys)
+        for (unsigned int n: sizes)
+          k.push_back(random(-0.5, Breakpoint(n-1, n, uniform) + 0.5));
+
+      Suite::Body body;
+      switch (sizes.size()) {
+      case 1:
+        body = [table, keys](size_t n) {
+          double sum = 0.0;
+          for (size_t i=0; i<n; i++)
+            sum += table->GetValue((*keys)[i % NumSamples][0]);
+          return sum;
+        };
+        break;
+      case 2:
+        body = [table, keys](size_t n) {
+          double sum = 0.0;
+          for (size_t i=0; i<n; i++) {
+            const vector<double>& k = (*keys)[i % NumSamples];
+            sum += table->GetValue(k[0], k[1]);
+          }
+          return sum;
+        };
+        break;
+      case 3:
+        body = [table, keys](size_t n) {
+          double sum = 0.0;
+          for (size_t i=0; i<n; i++) {
+            const vector<double>& k = (*keys)[i % NumSamples];
+            sum += table->GetValue(k[0], k[1], k[2]);
+          }
+          return sum;
+        };
+        break;
+      default:
+        body = [table, keys](size_t n) {
+          double sum = 0.0;
+          for (size_t i=0; i<n; i++)
+            sum += table->GetValue((*keys)[i % NumSamples]);
+          return sum;
+        };
+      }
+      suite.Add(TableName(sizes, uniform), body);
+    }
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void AddTableParsingBenchmarks(Suite& suite, const SGPath& root)
+{
+  // The largest tables shipped with JSBSim: the 3D lift coefficient of the
+  // c172x and the 3D augmented thrust of the Olympus engine.
+  const vector<vector<string>> tables = {
+    {"c172x/CLalpha", "aircraft/c172x/c172x.xml", "aero/coefficient/CLalpha"},
+    {"Olympus593Mrk610/AugThrust", "engine/Olympus593Mrk610.xml", "AugThrust"}
+  };
+
+  for (auto& t: tables) {
+    FGXMLFileRead reader;
+    Element_ptr document = reader.LoadXMLDocument(root/t[1], false);
+    Element_ptr table = document ? FindFunctionTable(document, t[2]) : nullptr;
+    if (!table) {
+      cerr << "Could not find the table " << t[2] << " in " << t[1]
+           << " - skipping its benchmark" << endl;
+      continue;
+    }
+
+    auto pm = make_shared<FGPropertyManager>();
+    Element* var = table->FindElement("independentVar");
+    while (var) {
+      pm->GetNode(var->GetDataLine(), true);
+      var = table->FindNextElement("independentVar");
+    }
+
+    auto lines = make_shared<vector<string>>();
+    Element* tableData = table->FindElement("tableData");
+    while (tableData) {
+      for (unsigned int i=0; i<tableData->GetNumDataLines(); i++)
+        lines->push_back(tableData->GetDataLine(i));
+      tableData = table->FindNextElement("tableData");
+    }
+
+    suite.Add("parse/numbers/" + t[0],
+              [lines](size_t n) {
+                vector<double> values;
+                double sum = 0.0;
+                for (size_t i=0; i<n; i++) {
+                  values.clear();
+                  for (const string& line: *lines)
+                    read_numbers_locale_c(line, values);
+                  sum += values.back();
+                }
+                return sum;
+              });
+
+    // The document is captured to keep the table element alive.
+    suite.Add("parse/table/" + t[0],
+              [pm, document, table](size_t n) {
+                double sum = 0.0;
+                for (size_t i=0; i<n; i++) {
+                  FGTable parsed(pm, table);
+                  sum += parsed.GetNumRows();
+                }
+                return sum;
+              });
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void AddFunctionBenchmarks(Suite& suite, shared_ptr<FGFDMExec> fdmex)
+{
+  // Aerodynamic coefficients modeled after the c172x: a 2D table scaled by the
+  // dynamic pressure, a damping derivative and a drag term in the absolute
+  // value of the sideslip.
+  const vector<pair<string, string>> functions = {
+    {"CLwbh",
+     "<product>"
+     "  <property>aero/qbar-psf</property>"
+     "  <property>metrics/Sw-sqft</property>"
+     "  <table>"
+     "    <independentVar lookup=\"row\">aero/alpha-rad</independentVar>"
+     "    <independentVar lookup=\"column\">fcs/flap-pos-deg</independentVar>"
+     "    <tableData>"
+     "                0.0     10.0    20.0    30.0\n"
+     "      -0.0900  -0.2200 -0.1200 -0.0200  0.0300\n"
+     "       0.0000   0.2500  0.3500  0.4500  0.5000\n"
+     "       0.0900   0.7300  0.8300  0.9300  0.9800\n"
+     "       0.1000   0.8300  0.9300  1.0300  1.0800\n"
+     "       0.1200   0.9200  1.0200  1.1200  1.1700\n"
+     "       0.1400   1.0200  1.1200  1.2200  1.2700\n"
+     "       0.1600   1.0800  1.1800  1.2800  1.3300\n"
+     "       0.1700   1.1300  1.2300  1.3300  1.3800\n"
+     "       0.1900   1.1900  1.2900  1.3900  1.4400\n"
+     "       0.2100   1.2500  1.3500  1.4500  1.5000\n"
+     "       0.2400   1.3500  1.4500  1.5500  1.6000\n"
+     "       0.2600   1.4400  1.5400  1.6400  1.6900\n"
+     "       0.2800   1.4700  1.5700  1.6700  1.7200\n"
+     "       0.3000   1.4300  1.5300  1.6300  1.6800\n"
+     "       0.3200   1.3800  1.4800  1.5800  1.6300\n"
+     "       0.3400   1.3000  1.4000  1.5000  1.5500\n"
+     "       0.3600   1.1500  1.2500  1.3500  1.4000\n"
+     "    </tableData>"
+     "  </table>"
+     "</product>"},
+    {"Cmq",
+     "<product>"
+     "  <property>aero/qbar-psf</property>"
+     "  <property>metrics/Sw-sqft</property>"
+     "  <property>metrics/cbarw-ft</property>"
+     "  <property>aero/ci2vel</property>"
+     "  <property>velocities/q-aero-rad_sec</property>"
+     "  <value>-12.4</value>"
+     "</product>"},
+    {"CDbeta",
+     "<product>"
+     "  <property>aero/qbar-psf</property>"
+     "  <property>metrics/Sw-sqft</property>"
+     "  <abs><property>aero/beta-rad</property></abs>"
+     "  <value>0.17</value>"
+     "</product>"},
+  };
+
+  auto pm = fdmex->GetPropertyManager();
+  auto alpha = pm->GetNode("aero/alpha-rad", true);
+  auto beta = pm->GetNode("aero/beta-rad", true);
+  auto q = pm->GetNode("velocities/q-aero-rad_sec", true);
+  pm->GetNode("fcs/flap-pos-deg", true)->setDoubleValue(10.0);
+  pm->GetNode("aero/qbar-psf", true)->setDoubleValue(50.0);
+  pm->GetNode("metrics/Sw-sqft", true)->setDoubleValue(174.0);
+  pm->GetNode("metrics/cbarw-ft", true)->setDoubleValue(4.9);
+  pm->GetNode("aero/ci2vel", true)->setDoubleValue(0.02);
+
+  auto inputs = make_shared<vector<FGColumnVector3>>(NumSamples);
+  Random random;
+  for (auto& in: *inputs)
+    in = {random(-0.1, 0.4), random(-0.2, 0.2), random(-0.5, 0.5)};
+
+  for (auto& f: functions) {
+    Element_ptr el = readFromXML("<function>" + f.second + "</function>");
+    shared_ptr<FGFunction> function = make_shared<FGFunction>(fdmex.get(), el);
+
+    // The inputs change at each iteration otherwise the function would return
+    // its cached value.
+    suite.Add("function/" + f.first,
+              [=](size_t n) {
+                double sum = 0.0;
+                for (size_t i=0; i<n; i++) {
+                  const FGColumnVector3& in = (*inputs)[i % NumSamples];
+                  alpha->setDoubleValue(in(1));
+                  beta->setDoubleValue(in(2));
+                  q->setDoubleValue(in(3));
+                  sum += function->GetValue();
+                }
+                return sum;
+              });
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void AddLocationBenchmarks(Suite& suite)
+{
+  // WGS84 ellipsoid in feet
+  const double a = 20925646.32546, b = 20855486.5951;
+  auto geodetic = make_shared<vector<FGColumnVector3>>(NumSamples);
+  auto ecef = make_shared<vector<FGColumnVector3>>(NumSamples);
+  Random random;
+
+  for (size_t i=0; i<NumSamples; i++) {
+    FGLocation l;
+    l.SetEllipse(a, b);
+    (*geodetic)[i] = {random(-M_PI, M_PI), random(-0.5*M_PI, 0.5*M_PI),
+                      random(-1000.0, 60000.0)};
+    l.SetPositionGeodetic((*geodetic)[i](1), (*geodetic)[i](2),
+                          (*geodetic)[i](3));
+    (*ecef)[i] = l;
+  }
+
+  suite.Add("location/geodetic-to-ecef",
+            [=](size_t n) {
+              FGLocation l;
+              double sum = 0.0;
+              l.SetEllipse(a, b);
+              for (size_t i=0; i<n; i++) {
+                const FGColumnVector3& g = (*geodetic)[i % NumSamples];
+                l.SetPositionGeodetic(g(1), g(2), g(3));
+                sum += l(1);
+              }
+              return sum;
+            });
+
+  suite.Add("location/ecef-to-geodetic",
+            [=](size_t n) {
+              FGLocation l;
+              double sum = 0.0;
+              l.SetEllipse(a, b);
+              for (size_t i=0; i<n; i++) {
+                l = (*ecef)[i % NumSamples];
+                sum += l.GetGeodLatitudeRad() + l.GetGeodAltitude();
+              }
+              return sum;
+            });
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void AddRotationBenchmarks(Suite& suite)
+{
+  auto euler = make_shared<vector<FGColumnVector3>>(NumSamples);
+  auto quaternions = make_shared<vector<FGQuaternion>>();
+  auto matrices = make_shared<vector<FGMatrix33>>();
+  Random random;
+
+  for (auto& e: *euler) {
+    e = {random(-M_PI, M_PI), random(-0.5*M_PI, 0.5*M_PI), random(-M_PI, M_PI)};
+    quaternions->push_back(FGQuaternion(e(1), e(2), e(3)));
+    // Copies of the quaternions have not computed their derived values.
+    matrices->push_back(FGQuaternion(e(1), e(2), e(3)).GetT());
+  }
+
+  suite.Add("quaternion/from-euler",
+            [=](size_t n) {
+              double sum = 0.0;
+              for (size_t i=0; i<n; i++) {
+                const FGColumnVector3& e = (*euler)[i % NumSamples];
+                FGQuaternion q(e(1), e(2), e(3));
+                sum += q(1);
+              }
+              return sum;
+            });
+
+  suite.Add("quaternion/to-matrix",
+            [=](size_t n) {
+              double sum = 0.0;
+              for (size_t i=0; i<n; i++) {
+                FGQuaternion q((*quaternions)[i % NumSamples]);
+                sum += q.GetT()(1,1);
+              }
+              return sum;
+            });
+
+  suite.Add("quaternion/product",
+            [=](size_t n) {
+              FGQuaternion q;
+              for (size_t i=0; i<n; i++) {
+                q *= (*quaternions)[i % NumSamples];
+                if (i % NumSamples == 0) q.Normalize();
+              }
+              return q(1);
+            });
+
+  suite.Add("quaternion/derivative",
+            [=](size_t n) {
+              double sum = 0.0;
+              for (size_t i=0; i<n; i++) {
+                const FGQuaternion& q = (*quaternions)[i % NumSamples];
+                sum += q.GetQDot((*euler)[(i + 1) % NumSamples])(1);
+              }
+              return sum;
+            });
+
+  suite.Add("matrix33/product",
+            [=](size_t n) {
+              double sum = 0.0;
+              for (size_t i=0; i<n; i++) {
+                const FGMatrix33& m = (*matrices)[i % NumSamples];
+                sum += (m * (*matrices)[(i + 1) % NumSamples])(1,1);
+              }
+              return sum;
+            });
+
+  suite.Add("matrix33/vector-product",
+            [=](size_t n) {
+              double sum = 0.0;
+              for (size_t i=0; i<n; i++) {
+                const FGMatrix33& m = (*matrices)[i % NumSamples];
+                sum += (m * (*euler)[i % NumSamples])(1);
+              }
+              return sum;
+            });
+
+  suite.Add("matrix33/inverse",
+            [=](size_t n) {
+              double sum = 0.0;
+              for (size_t i=0; i<n; i++)
+                sum += (*matrices)[i % NumSamples].Inverse()(1,1);
+              return sum;
+            });
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+struct TiedValue {
+  double value = 1.0;
+  double GetValue(void) const { return value; }
+};
+
+void AddPropertyBenchmarks(Suite& suite)
+{
+  auto pm = make_shared<FGPropertyManager>();
+  auto tied = make_shared<TiedValue>();
+  pm->GetNode("benchmark/untied", true)->setDoubleValue(1.0);
+  pm->Tie("benchmark/tied", tied.get(), &TiedValue::GetValue);
+
+  for (string name: {"untied", "tied"}) {
+    auto value = make_shared<FGPropertyValue>(pm->GetNode("benchmark/" + name));
+    // The property manager is captured to keep the nodes alive.
+    suite.Add("property/read/" + name,
+              [pm, tied, value](size_t n) {
+                double sum = 0.0;
+                for (size_t i=0; i<n; i++)
+                  sum += value->GetValue();
+                return sum;
+              });
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void AddFrameBenchmarks(Suite& suite, const SGPath& root)
+{
+  const vector<pair<string, string>> aircraft = {
+    {"c172x", "reset01"}, {"737", "cruise_init"}, {"f16", "reset00"}
+  };
+
+  for (auto& a: aircraft) {
+    auto fdmex = make_shared<FGFDMExec>();
+    fdmex->SetDebugLevel(0);
+    fdmex->SetRootDir(root);
+    fdmex->SetAircraftPath(SGPath("aircraft"));
+    fdmex->SetEnginePath(SGPath("engine"));
+    fdmex->SetSystemsPath(SGPath("systems"));
+
+    if (!fdmex->LoadModel(a.first) ||
+        !fdmex->GetIC()->Load(SGPath(a.second))) {
+      cerr << "Could not load the aircraft " << a.first
+           << " - skipping its benchmark" << endl;
+      continue;
+    }
+    fdmex->DisableOutput();
+    fdmex->RunIC();
+    fdmex->GetPropulsion()->InitRunning(-1);
+    auto state = make_shared<string>(fdmex->SaveState());
+
+    // The initial state is restored before each batch of frames so that every
+    // batch flies the same trajectory.
+    suite.Add("frame/" + a.first,
+              [fdmex](size_t n) {
+                for (size_t i=0; i<n; i++)
+                  fdmex->Run();
+                return fdmex->GetSimTime();
+              },
+              [fdmex, state]() { fdmex->RestoreState(*state); });
+  }
+}
+
+}
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+MAIN
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+int main(int argc, char* argv[])
+{
+  Suite suite;
+  SGPath root(JSBSIM_ROOT_DIR);
+  string json;
+  bool list = false;
+
+  for (int i=1; i<argc; i++) {
+    string arg = argv[i];
+    string value = arg.substr(arg.find('=') + 1);
+
+    if (arg.rfind("--filter=", 0) == 0)
+      suite.Filter = value;
+    else if (arg.rfind("--min-time=", 0) == 0)
+      suite.MinTime = atof(value.c_str());
+    else if (arg.rfind("--repetitions=", 0) == 0)
+      suite.Repetitions = max(1, atoi(value.c_str()));
+    else if (arg.rfind("--json=", 0) == 0)
+      json = value;
+    else if (arg.rfind("--root=", 0) == 0)
+      root = SGPath(value);
+    else if (arg == "--list")
+      list = true;
+    else {
+      cerr << "Usage: " << argv[0] << " [--filter=<text>] [--min-time=<seconds>]"
+           << " [--repetitions=<number>] [--json=<filename>] [--root=<path>]"
+           << " [--list]" << endl;
+      return 1;
+    }
+  }
+
+  // Only the errors are reported: the models loading is quite verbose.
+  auto logger = make_shared<FGLogConsole>();
+  logger->SetMinLevel(LogLevel::ERROR);
+  SetLogger(logger);
+
+  auto fdmex = make_shared<FGFDMExec>();
+  AddTableBenchmarks(suite);
+  AddTableParsingBenchmarks(suite, root);
+  AddFunctionBenchmarks(suite, fdmex);
+  AddLocationBenchmarks(suite);
+  AddRotationBenchmarks(suite);
+  AddPropertyBenchmarks(suite);
+  AddFrameBenchmarks(suite, root);
+
+  if (list) {
+    for (auto& name: suite.GetNames()) cout << name << endl;
+    return 0;
+  }
+
+  auto results = suite.Run(cout);
+
+  if (!json.empty()) {
+    ofstream out(json);
+    if (!out) {
+      cerr << "Could not open " << json << endl;
+      return 1;
+    }
+    JSBSimBenchmark::WriteJSON(out, results, FGJSBBase::GetVersion());
+  }
+
+  return 0;
+}
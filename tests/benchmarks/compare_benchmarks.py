@@ -0,0 +1,68 @@
+# compare_benchmarks.py
+#
+# Compare the results of two runs of JSBSimBenchmarks.
+#
+# Copyright (c) 2026 The JSBSim team
+#
+# This program is free software; you can redistribute it and/or modify it under
+# the terms of the GNU General Public License as published by the Free Software
+# Foundation; either version 3 of the License, or (at your option) any later
+# version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+# FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+# details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program; if not, see <http://www.gnu.org/licenses/>
+#
+
+"""Compares the JSON results of two runs of JSBSimBenchmarks.
+
+The median time of each benchmark of the current run is compared to the one of
+the baseline. The script exits with a non-zero status when a benchmark is
+slower than the baseline by more than the threshold::
+
+    python compare_benchmarks.py baseline.json current.json --threshold 0.1
+"""
+
+import argparse
+import json
+import sys
+
+
+def load(filename):
+    with open(filename) as f:
+        return {b['name']: b for b in json.load(f)['benchmarks']}
+
+
+parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+parser.add_argument('baseline', help='results of the reference run')
+parser.add_argument('current', help='results of the run to check')
+parser.add_argument('--threshold', type=float, default=0.1,
+                    help='relative slow down reported as a regression '
+                    '(default: 0.1)')
+args = parser.parse_args()
+
+baseline = load(args.baseline)
+current = load(args.current)
+regressions = []
+
+print(f'{"benchmark":40}{"baseline (ns)":>15}{"current (ns)":>15}{"change":>10}')
+for name, result in current.items():
+    if name not in baseline:
+        print(f'{name:40}{"-":>15}{result["median"]:>15.1f}{"new":>10}')
+        continue
+
+    ref = baseline[name]['median']
+    change = result['median'] / ref - 1.0 if ref > 0.0 else 0.0
+    flag = ' *' if change > args.threshold else ''
+    print(f'{name:40}{ref:>15.1f}{result["median"]:>15.1f}{change:>+10.1%}{flag}')
+    if flag:
+        regressions.append(name)
+
+if regressions:
+    print(f'\n{len(regressions)} benchmark(s) slower than the baseline by more '
+          f'than {args.threshold:.0%}: {", ".join(regressions)}')
+    sys.exit(1)
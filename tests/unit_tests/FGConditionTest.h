@@ -2,6 +2,7 @@
 
 #include <cxxtest/TestSuite.h>
 #include <math/FGCondition.h>
+#include <math/FGConditionProgram.h>
 #include "TestUtilities.h"
 
 using namespace JSBSim;
@@ -696,4 +697,73 @@ public:
     Element_ptr elm = readFromXML("<dummy> on-off # 0.0 </dummy>");
     TS_ASSERT_THROWS(FGCondition cond(elm, pm), BaseException&);
   }
+
+  void testCompiledNested() {
+    auto pm = std::make_shared<FGPropertyManager>();
+    auto on_off = pm->GetNode("on-off", true);
+    auto x = pm->GetNode("x", true);
+    auto y = pm->GetNode("y", true);
+    Element_ptr elm = readFromXML("<dummy>"
+                                  "  on-off == 1"
+                                  "  <dummy logic=\"OR\">"
+                                  "    x GE y\n"
+                                  "    -x GT 2.0"
+                                  "  </dummy>"
+                                  "</dummy>");
+    FGCondition cond(elm, pm);
+    FGConditionProgram program;
+    unsigned int entry = cond.Compile(program);
+
+    // x and -x are distinct inputs.
+    TS_ASSERT_EQUALS(program.GetNumInputs(), 4);
+    TS_ASSERT_EQUALS(program.GetInputs(entry).size(), 4);
+
+    for (double v1: {0.0, 1.0}) {
+      for (double v2: {-3.0, 0.0, 1.0}) {
+        for (double v3: {-1.0, 0.0, 1.0}) {
+          on_off->setDoubleValue(v1);
+          x->setDoubleValue(v2);
+          y->setDoubleValue(v3);
+          for (unsigned int i=0; i<program.GetNumInputs(); ++i)
+            program.UpdateInput(i);
+          TS_ASSERT_EQUALS(program.Evaluate(entry), cond.Evaluate());
+        }
+      }
+    }
+  }
+
+  void testCompiledSharedInputs() {
+    auto pm = std::make_shared<FGPropertyManager>();
+    auto x = pm->GetNode("x", true);
+    auto y = pm->GetNode("y", true);
+    FGCondition cond1("x GT 1.0", pm, nullptr);
+    FGCondition cond2("x LE y", pm, nullptr);
+    FGCondition cond3("y EQ 0.0", pm, nullptr);
+    FGConditionProgram program;
+    unsigned int entry1 = cond1.Compile(program);
+    unsigned int entry2 = cond2.Compile(program);
+    unsigned int entry3 = cond3.Compile(program);
+
+    // x and y are only read once.
+    TS_ASSERT_EQUALS(program.GetNumInputs(), 2);
+    TS_ASSERT_EQUALS(program.GetInputs(entry1), std::vector<unsigned int>{0});
+    TS_ASSERT_EQUALS(program.GetInputs(entry2), (std::vector<unsigned int>{0, 1}));
+    TS_ASSERT_EQUALS(program.GetInputs(entry3), std::vector<unsigned int>{1});
+
+    x->setDoubleValue(2.0);
+    y->setDoubleValue(0.0);
+    TS_ASSERT(program.UpdateInput(0));
+    TS_ASSERT(!program.UpdateInput(1));
+    TS_ASSERT(program.Evaluate(entry1));
+    TS_ASSERT(!program.Evaluate(entry2));
+    TS_ASSERT(program.Evaluate(entry3));
+
+    // The inputs are only read by UpdateInput()
+    y->setDoubleValue(3.0);
+    TS_ASSERT(!program.Evaluate(entry2));
+    TS_ASSERT(!program.UpdateInput(0));
+    TS_ASSERT(program.UpdateInput(1));
+    TS_ASSERT(program.Evaluate(entry2));
+    TS_ASSERT(!program.Evaluate(entry3));
+  }
 };
@@ -0,0 +1,253 @@
+#include <cmath>
+#include <array>
+
+#include <cxxtest/TestSuite.h>
+#include <FGFDMExec.h>
+#include <math/FGFunction.h>
+#include "TestUtilities.h"
+
+using namespace JSBSim;
+
+// Gives access to the evaluation of the tree of parameters.
+class TreeFunction : public FGFunction
+{
+public:
+  TreeFunction(FGFDMExec* fdmex, Element* el) : FGFunction(fdmex, el) {}
+  bool IsCompiled(void) const { return Bytecode != nullptr; }
+  double GetTreeValue(void) const { return Parameters[0]->GetValue(); }
+};
+
+// Counts the number of times a property is read.
+class Counter
+{
+public:
+  double value = 0.0;
+  mutable unsigned int reads = 0;
+  double GetValue(void) const { ++reads; return value; }
+};
+
+const std::array<double, 9> values{-2.5, -1.0, -0.3, 0.0, 0.49, 0.5, 1.0, 1.7,
+                                   4.0};
+
+class FGFunctionTest : public CxxTest::TestSuite
+{
+public:
+  FGFDMExec fdmex;
+  SGPropertyNode_ptr x, y, z;
+
+  FGFunctionTest() {
+    auto pm = fdmex.GetPropertyManager();
+    x = pm->GetNode("x", true);
+    y = pm->GetNode("y", true);
+    z = pm->GetNode("z", true);
+  }
+
+  // Checks that the bytecode and the tree of parameters return identical
+  // results (including NaNs and exceptions) for all the values of x and y.
+  void CheckFunction(const std::string& XML) {
+    Element_ptr elm = readFromXML("<function>" + XML + "</function>");
+    TreeFunction f(&fdmex, elm);
+    TS_ASSERT(f.IsCompiled());
+
+    for (double vx: values) {
+      for (double vy: values) {
+        x->setDoubleValue(vx);
+        y->setDoubleValue(vy);
+        bool treeThrows = false, bytecodeThrows = false;
+        double expected = 0.0, result = 0.0;
+
+        try {
+          expected = f.GetTreeValue();
+        } catch (BaseException&) {
+          treeThrows = true;
+        }
+        try {
+          result = f.GetValue();
+        } catch (BaseException&) {
+          bytecodeThrows = true;
+        }
+
+        TS_ASSERT_EQUALS(bytecodeThrows, treeThrows);
+        if (std::isnan(expected))
+          TS_ASSERT(std::isnan(result));
+        else
+          TS_ASSERT_EQUALS(result, expected);
+      }
+    }
+  }
+
+  void testVariadicFunctions() {
+    for (const std::string op: {"sum", "product", "difference", "avg", "min",
+                                "max"}) {
+      CheckFunction("<" + op + "><p>x</p><p>y</p><v>0.25</v></" + op + ">");
+      CheckFunction("<" + op + "><p>x</p><p>y</p></" + op + ">");
+    }
+  }
+
+  void testUnaryFunctions() {
+    for (const std::string op: {"toradians", "todegrees", "sqrt", "log2", "ln",
+                                "log10", "sign", "exp", "abs", "sin", "cos",
+                                "tan", "asin", "acos", "atan", "floor", "ceil",
+                                "roundmultiple", "fraction", "integer"})
+      CheckFunction("<" + op + "><product><p>x</p><p>y</p></product></" + op
+                    + ">");
+  }
+
+  void testBinaryFunctions() {
+    for (const std::string op: {"quotient", "pow", "fmod", "roundmultiple",
+                                "atan2", "lt", "le", "gt", "ge", "eq", "nq"})
+      CheckFunction("<" + op + "><p>x</p><p>y</p></" + op + ">");
+    // The integer division by zero is not checked by <mod>.
+    CheckFunction("<mod><p>x</p><sum><p>y</p><v>10</v></sum></mod>");
+  }
+
+  void testLogicalFunctions() {
+    CheckFunction("<not><p>x</p></not>");
+    CheckFunction("<and><p>x</p><p>y</p></and>");
+    CheckFunction("<or><p>x</p><p>y</p></or>");
+    CheckFunction("<and><gt><p>x</p><v>0</v></gt><lt><p>y</p><v>1</v></lt>"
+                  "<p>z</p></and>");
+    CheckFunction("<or><gt><p>x</p><v>0</v></gt><lt><p>y</p><v>1</v></lt>"
+                  "<p>z</p></or>");
+  }
+
+  void testShortCircuit() {
+    // The property y is not a boolean so reading it raises an exception. It
+    // must therefore not be evaluated when the result is known from x.
+    Element_ptr elm = readFromXML("<function><and><p>x</p><p>y</p></and>"
+                                  "</function>");
+    TreeFunction And(&fdmex, elm);
+    elm = readFromXML("<function><or><p>x</p><p>y</p></or></function>");
+    TreeFunction Or(&fdmex, elm);
+    y->setDoubleValue(2.0);
+
+    x->setDoubleValue(0.0);
+    TS_ASSERT_EQUALS(And.GetValue(), 0.0);
+    TS_ASSERT_THROWS(Or.GetValue(), BaseException&);
+    x->setDoubleValue(1.0);
+    TS_ASSERT_THROWS(And.GetValue(), BaseException&);
+    TS_ASSERT_EQUALS(Or.GetValue(), 1.0);
+  }
+
+  void testConditionalFunctions() {
+    CheckFunction("<ifthen><p>x</p><p>y</p><quotient><v>1</v><p>y</p>"
+                  "</quotient></ifthen>");
+    CheckFunction("<ifthen><lt><p>x</p><p>y</p></lt><p>y</p><p>x</p>"
+                  "</ifthen>");
+    CheckFunction("<switch><p>x</p><v>10</v><p>y</p><sum><p>x</p><p>y</p>"
+                  "</sum></switch>");
+    CheckFunction("<switch><abs><p>x</p></abs><v>10</v><p>y</p><sum><p>x</p>"
+                  "<p>y</p></sum><v>-3</v></switch>");
+  }
+
+  void testNestedFunctions() {
+    CheckFunction("<sum><v>3.14159</v><product><p>x</p><v>0.125</v></product>"
+                  "<quotient><p>y</p><sum><p>x</p><v>3</v></sum></quotient>"
+                  "<max><p>x</p><min><p>y</p><v>0.5</v><p>x</p></min></max>"
+                  "<pow><abs><p>x</p></abs><difference><p>y</p><v>1</v>"
+                  "<p>x</p></difference></pow></sum>");
+    CheckFunction("<product><table><independentVar>x</independentVar>"
+                  "<tableData> -1.0 0.5\n 0.0 1.0\n 2.0 -1.0 </tableData>"
+                  "</table><p>y</p></product>");
+    CheckFunction("<interpolate1d><p>x</p><v>-1</v><p>y</p><v>0</v><v>1</v>"
+                  "<v>1</v><sum><p>x</p><p>y</p></sum></interpolate1d>");
+  }
+
+  void testConstantFolding() {
+    Element_ptr elm = readFromXML("<function><sum><p>x</p><product><v>2</v>"
+                                  "<v>3</v></product></sum></function>");
+    TreeFunction f(&fdmex, elm);
+    x->setDoubleValue(0.5);
+    TS_ASSERT_EQUALS(f.GetValue(), 6.5);
+    TS_ASSERT_EQUALS(f.GetTreeValue(), 6.5);
+  }
+
+  void testLazyEvaluation() {
+    auto pm = fdmex.GetPropertyManager();
+    Counter c;
+    pm->Tie("counter", &c, &Counter::GetValue);
+
+    // The property is read once to check if it has changed and once more by
+    // <interpolate1d> when the function is recomputed.
+    Element_ptr elm = readFromXML("<function><product><p>x</p><interpolate1d>"
+                                  "<p>counter</p><v>0</v><v>1</v><v>2</v><v>3</v>"
+                                  "<v>4</v><v>-1</v></interpolate1d></product>"
+                                  "</function>");
+    TreeFunction f(&fdmex, elm);
+    x->setDoubleValue(2.0);
+    c.value = 1.0;
+    TS_ASSERT_EQUALS(f.GetValue(), 4.0);
+    TS_ASSERT_EQUALS(c.reads, 2u);
+    TS_ASSERT_EQUALS(f.GetValue(), 4.0);
+    TS_ASSERT_EQUALS(c.reads, 3u);
+    x->setDoubleValue(-1.0);
+    TS_ASSERT_EQUALS(f.GetValue(), -2.0);
+    TS_ASSERT_EQUALS(c.reads, 5u);
+    c.value = 3.0;
+    TS_ASSERT_EQUALS(f.GetValue(), -1.0);
+    TS_ASSERT_EQUALS(c.reads, 7u);
+    TS_ASSERT_EQUALS(f.GetValue(), -1.0);
+    TS_ASSERT_EQUALS(c.reads, 8u);
+
+    pm->Untie("counter");
+  }
+
+  void testLazyEvaluationSignedZero() {
+    Element_ptr elm = readFromXML("<function><atan2><v>0</v><p>x</p></atan2>"
+                                  "</function>");
+    FGFunction f(&fdmex, elm);
+    x->setDoubleValue(-0.0);
+    TS_ASSERT_EQUALS(f.GetValue(), M_PI);
+    x->setDoubleValue(0.0);
+    TS_ASSERT_EQUALS(f.GetValue(), 0.0);
+  }
+
+  void testLazyEvaluationRandom() {
+    // Functions that use random numbers must be recomputed at each call.
+    Element_ptr elm = readFromXML("<function><sum><p>x</p><urandom/></sum>"
+                                  "</function>");
+    FGFunction f(&fdmex, elm);
+    x->setDoubleValue(1.0);
+    double value = f.GetValue();
+    bool changed = false;
+    for (int i=0; i<10; ++i)
+      changed |= f.GetValue() != value;
+    TS_ASSERT(changed);
+  }
+
+  void testLazyEvaluationLateBinding() {
+    Element_ptr elm = readFromXML("<function><ifthen><p>x</p><p>late</p>"
+                                  "<p>y</p></ifthen></function>");
+    FGFunction f(&fdmex, elm);
+    x->setDoubleValue(0.0);
+    y->setDoubleValue(3.0);
+    // The property "late" does not exist yet but it is not read.
+    TS_ASSERT_EQUALS(f.GetValue(), 3.0);
+    y->setDoubleValue(5.0);
+    TS_ASSERT_EQUALS(f.GetValue(), 5.0);
+
+    auto late = fdmex.GetPropertyManager()->GetNode("late", true);
+    late->setDoubleValue(-1.0);
+    x->setDoubleValue(1.0);
+    TS_ASSERT_EQUALS(f.GetValue(), -1.0);
+    late->setDoubleValue(-2.0);
+    TS_ASSERT_EQUALS(f.GetValue(), -2.0);
+    x->setDoubleValue(0.0);
+    TS_ASSERT_EQUALS(f.GetValue(), 5.0);
+  }
+
+  void testCopyTo() {
+    Element_ptr elm = readFromXML("<function copyto=\"z\"><sum><p>x</p><p>y</p>"
+                                  "</sum></function>");
+    FGFunction f(&fdmex, elm);
+    x->setDoubleValue(1.0);
+    y->setDoubleValue(2.0);
+    TS_ASSERT_EQUALS(f.GetValue(), 3.0);
+    TS_ASSERT_EQUALS(z->getDoubleValue(), 3.0);
+
+    // The property is updated even if the function has not been recomputed.
+    z->setDoubleValue(0.0);
+    TS_ASSERT_EQUALS(f.GetValue(), 3.0);
+    TS_ASSERT_EQUALS(z->getDoubleValue(), 3.0);
+  }
+};
@@ -1,4 +1,6 @@
 #include <memory>
+#include <string>
+#include <vector>
 
 #include <cxxtest/TestSuite.h>
 #include <input_output/FGPropertyManager.h>
@@ -16,4 +18,107 @@ public:
     TS_ASSERT_EQUALS(root->getNameString(), "");
     TS_ASSERT_EQUALS(GetFullyQualifiedName(root), "/");
   }
+
+  void testWideTree() {
+    // Enough children to have them looked up in a hash table.
+    auto pm = std::make_shared<FGPropertyManager>();
+    auto root = pm->GetNode();
+    std::vector<SGPropertyNode*> nodes;
+
+    for (int i=0; i<20; ++i) {
+      for (int j=0; j<5; ++j) {
+        std::string name = "engine" + std::to_string(j) + "/thrust";
+        nodes.push_back(pm->GetNode(name, i, true));
+        TS_ASSERT_EQUALS(nodes.back()->getIndex(), i);
+      }
+    }
+
+    size_t n = 0;
+    for (int i=0; i<20; ++i) {
+      for (int j=0; j<5; ++j, ++n) {
+        std::string path = "engine" + std::to_string(j) + "/thrust["
+                         + std::to_string(i) + "]";
+        TS_ASSERT_EQUALS(pm->GetNode(path), nodes[n]);
+        TS_ASSERT_EQUALS(pm->GetNode("/" + path), nodes[n]);
+        TS_ASSERT_EQUALS(root->getNode(path.c_str()), nodes[n]);
+        TS_ASSERT_EQUALS(nodes[n]->getParent()->getChild("thrust", i),
+                         nodes[n]);
+      }
+    }
+    TS_ASSERT(!pm->GetNode("engine0/thrust[20]"));
+    TS_ASSERT(!pm->GetNode("engine0/thrust[20]"));
+    TS_ASSERT(pm->GetNode("engine0/thrust[20]", true));
+    TS_ASSERT(pm->GetNode("engine0/thrust[20]"));
+  }
+
+  void testRemovedNodes() {
+    auto pm = std::make_shared<FGPropertyManager>();
+    auto root = pm->GetNode();
+    auto engine = pm->GetNode("engine", true);
+
+    for (int i=0; i<10; ++i)
+      engine->getChild("n", i, true)->setDoubleValue(i);
+
+    SGPropertyNode_ptr n5 = pm->GetNode("engine/n[5]");
+    TS_ASSERT_EQUALS(n5->getDoubleValue(), 5.0);
+    TS_ASSERT_EQUALS(engine->getNode("../engine/n[5]"), n5);
+
+    // The cached paths must not return the removed nodes.
+    TS_ASSERT_EQUALS(engine->removeChild("n", 5), n5);
+    TS_ASSERT(!pm->GetNode("engine/n[5]"));
+    TS_ASSERT(!engine->getNode("../engine/n[5]"));
+    TS_ASSERT(!engine->getChild("n", 5));
+    TS_ASSERT_EQUALS(pm->GetNode("engine/n[6]")->getDoubleValue(), 6.0);
+
+    auto new_n5 = pm->GetNode("engine/n[5]", true);
+    TS_ASSERT_DIFFERS(new_n5, n5.ptr());
+    TS_ASSERT_EQUALS(engine->getChild("n", 5), new_n5);
+
+    root->removeChild("engine", 0);
+    TS_ASSERT(!pm->GetNode("engine/n[6]"));
+    TS_ASSERT(!pm->HasNode("engine/n[6]"));
+  }
+
+  void testDetachedNodes() {
+    auto pm = std::make_shared<FGPropertyManager>();
+    auto engine = pm->GetNode("engine", true);
+
+    for (int i=0; i<10; ++i)
+      engine->getChild("n", i, true);
+
+    SGPropertyNode_ptr n5 = engine->getChild("n", 5);
+    TS_ASSERT_EQUALS(n5->getNode("../n[6]"), engine->getChild("n", 6));
+    TS_ASSERT_EQUALS(n5->getNode("/engine"), engine);
+
+    // The detached node is the root of its own tree: it must not find the
+    // nodes of its former tree from its cache.
+    engine->removeChild("n", 5);
+    TS_ASSERT(!n5->getNode("/engine"));
+
+    // Another tree is not affected by the removal.
+    auto pm2 = std::make_shared<FGPropertyManager>();
+    auto node = pm2->GetNode("a/b", true);
+    TS_ASSERT_EQUALS(pm2->GetNode("a/b"), node);
+    pm->GetNode()->removeChild("engine", 0);
+    TS_ASSERT_EQUALS(pm2->GetNode("a/b"), node);
+  }
+
+  void testManyPaths() {
+    // More distinct paths than the path cache holds.
+    auto pm = std::make_shared<FGPropertyManager>();
+    auto root = pm->GetNode();
+    std::vector<SGPropertyNode*> nodes;
+
+    for (int i=0; i<3000; ++i) {
+      std::string path = "data/value[" + std::to_string(i) + "]";
+      nodes.push_back(root->getNode(path.c_str(), true));
+    }
+
+    for (int pass=0; pass<2; ++pass) {
+      for (int i=0; i<3000; ++i) {
+        std::string path = "data/value[" + std::to_string(i) + "]";
+        TS_ASSERT_EQUALS(root->getNode(path.c_str()), nodes[i]);
+      }
+    }
+  }
 };
@@ -3,6 +3,13 @@
 
 using namespace JSBSim;
 
+class DummyValue
+{
+public:
+  double value = 0.0;
+  double GetValue(void) const { return value; }
+};
+
 class FGPropertyValueTest : public CxxTest::TestSuite
 {
 public:
@@ -139,4 +146,103 @@ public:
     node->setDoubleValue(1.234);
     TS_ASSERT_EQUALS(property.GetValue(), -1.234);
   }
+
+  void testStorageChanges() {
+    // The value must be read correctly whatever the way the property is
+    // stored and after each change of the storage.
+    auto pm = std::make_shared<FGPropertyManager>();
+    SGPropertyNode_ptr node = pm->GetNode("x", true);
+    FGPropertyValue property(node);
+    double value = 2.0;
+    DummyValue dummy;
+
+    node->setDoubleValue(1.0);
+    TS_ASSERT_EQUALS(property.GetValue(), 1.0);
+
+    pm->Tie("x", &value);
+    TS_ASSERT_EQUALS(property.GetValue(), 2.0);
+    value = -3.0;
+    TS_ASSERT_EQUALS(property.GetValue(), -3.0);
+    node->setDoubleValue(4.0);
+    TS_ASSERT_EQUALS(value, 4.0);
+    TS_ASSERT_EQUALS(property.GetValue(), 4.0);
+    pm->Untie("x");
+    value = 5.0;
+    TS_ASSERT_EQUALS(property.GetValue(), 4.0);
+
+    dummy.value = 6.0;
+    pm->Tie("x", &dummy, &DummyValue::GetValue);
+    TS_ASSERT_EQUALS(property.GetValue(), 6.0);
+    dummy.value = -7.0;
+    TS_ASSERT_EQUALS(property.GetValue(), -7.0);
+    pm->Untie("x");
+    dummy.value = 8.0;
+    TS_ASSERT_EQUALS(property.GetValue(), -7.0);
+
+    // Change the type of the property.
+    node->clearValue();
+    node->setStringValue("9.5");
+    TS_ASSERT_EQUALS(property.GetValue(), 9.5);
+    node->clearValue();
+    node->setBoolValue(true);
+    TS_ASSERT_EQUALS(property.GetValue(), 1.0);
+    node->clearValue();
+    node->setDoubleValue(10.0);
+    TS_ASSERT_EQUALS(property.GetValue(), 10.0);
+
+    // Change the attributes of the property.
+    node->setAttribute(SGPropertyNode::READ, false);
+    TS_ASSERT_EQUALS(property.GetValue(), 0.0);
+    node->setAttribute(SGPropertyNode::READ, true);
+    TS_ASSERT_EQUALS(property.GetValue(), 10.0);
+
+    // Alias the property.
+    SGPropertyNode_ptr target = pm->GetNode("y", true);
+    target->setDoubleValue(11.0);
+    node->alias(target);
+    TS_ASSERT_EQUALS(property.GetValue(), 11.0);
+    node->unalias();
+    node->setDoubleValue(12.0);
+    TS_ASSERT_EQUALS(property.GetValue(), 12.0);
+  }
+
+  void testPropertyHandle() {
+    SGPropertyNode root;
+    SGPropertyNode_ptr node = root.getNode("x", true);
+    double value = 1.0;
+    DummyValue dummy;
+
+    node->setDoubleValue(-1.0);
+    FGPropertyHandle handle(node);
+    TS_ASSERT_EQUALS(handle.GetNode(), node.ptr());
+    TS_ASSERT_EQUALS(node->getDoublePointer(), node->getDoublePointer());
+    TS_ASSERT(node->getDoublePointer());
+    TS_ASSERT(!node->getDoubleRawValue());
+    TS_ASSERT_EQUALS(handle.getDoubleValue(), -1.0);
+
+    unsigned int serial = node->getStorageSerial();
+    node->tie(SGRawValuePointer<double>(&value));
+    TS_ASSERT_DIFFERS(node->getStorageSerial(), serial);
+    TS_ASSERT_EQUALS(node->getDoublePointer(), &value);
+    // The variable has been initialized with the value of the property.
+    TS_ASSERT_EQUALS(handle.getDoubleValue(), -1.0);
+    value = 1.0;
+    TS_ASSERT_EQUALS(handle.getDoubleValue(), 1.0);
+    node->untie();
+
+    dummy.value = 2.0;
+    node->tie(SGRawValueMethods<DummyValue, double>(dummy,
+                                                    &DummyValue::GetValue));
+    TS_ASSERT(!node->getDoublePointer());
+    TS_ASSERT(node->getDoubleRawValue());
+    TS_ASSERT(node->getDoubleRawValue()->getReader());
+    TS_ASSERT_EQUALS(handle.getDoubleValue(), 2.0);
+
+    // Traced properties are read through SGPropertyNode::getDoubleValue()
+    node->setAttribute(SGPropertyNode::TRACE_READ, true);
+    TS_ASSERT(!node->getDoubleRawValue());
+    node->setAttribute(SGPropertyNode::TRACE_READ, false);
+    node->untie();
+    TS_ASSERT_EQUALS(handle.getDoubleValue(), 2.0);
+  }
 };
@@ -1,5 +1,6 @@
 #include <sstream>
 #include <limits>
+#include <vector>
 
 #include <cxxtest/TestSuite.h>
 #include <math/FGTable.h>
@@ -121,6 +122,24 @@ public:
     TS_ASSERT_EQUALS(t.GetValue(),  1.5);
   }
 
+  void testLookupPropertyUnchanged() {
+    auto pm = std::make_shared<FGPropertyManager>();
+    auto node = pm->GetNode("x", true);
+    FGTable t(2);
+    t << 1.0 << -1.0
+      << 2.0 << 1.5;
+    t.SetRowIndexProperty(node);
+
+    node->setDoubleValue(1.5);
+    TS_ASSERT_EQUALS(t.GetValue(), 0.25);
+    TS_ASSERT_EQUALS(t.GetValue(), 0.25);
+    node->setDoubleValue(1.25);
+    TS_ASSERT_EQUALS(t.GetValue(), -0.375);
+    TS_ASSERT_EQUALS(t.GetValue(), -0.375);
+    node->setDoubleValue(1.5);
+    TS_ASSERT_EQUALS(t.GetValue(), 0.25);
+  }
+
   void testMinValue() {
     FGTable t1(1);
     t1 << 0.0 << 1.0;
@@ -384,6 +403,66 @@ public:
 
     TS_ASSERT_THROWS(FGTable t_3x1(pm, el_table), BaseException&);
   }
+
+  void testBreakpointLookup() {
+    // Checks the lookup against a linear search for uniformly and non
+    // uniformly spaced breakpoints, with keys moving back and forth.
+    for (bool uniform: {true, false}) {
+      const unsigned int n = 50;
+      FGTable t(n);
+      std::vector<double> x, y;
+      for (unsigned int i=0; i<n; ++i) {
+        x.push_back(uniform ? 0.1*i - 1.0 : 0.01*i*i - 1.0);
+        y.push_back(sin(0.3*i));
+        t << x.back() << y.back();
+      }
+
+      std::vector<double> keys;
+      for (double k=-1.5; k<25.0; k+=0.013) keys.push_back(k);
+      for (double k=25.0; k>-1.5; k-=0.37) keys.push_back(k);
+      for (unsigned int i=0; i<n; ++i) keys.push_back(x[(7*i) % n]);
+
+      for (double key: keys) {
+        double expected;
+        if (key <= x[0])
+          expected = y[0];
+        else if (key >= x[n-1])
+          expected = y[n-1];
+        else {
+          unsigned int r = 1;
+          while (x[r] < key) r++;
+          double factor = (key - x[r-1]) / (x[r] - x[r-1]);
+          expected = factor*(y[r] - y[r-1]) + y[r-1];
+        }
+        TS_ASSERT_EQUALS(t.GetValue(key), expected);
+      }
+    }
+  }
+
+  void testUniformBreakpointsFromXML() {
+    auto pm = std::make_shared<FGPropertyManager>();
+    Element_ptr elm = readFromXML("<dummy>"
+                                  "  <table type=\"internal\">"
+                                  "    <tableData>"
+                                  "      -1.0  1.0\n"
+                                  "      -0.5  2.0\n"
+                                  "       0.0 -1.0\n"
+                                  "       0.5  0.5\n"
+                                  "       1.0  4.0\n"
+                                  "    </tableData>"
+                                  "  </table>"
+                                  "</dummy>");
+    FGTable t(pm, elm->FindElement("table"));
+
+    TS_ASSERT_EQUALS(t.GetValue(-2.0), 1.0);
+    TS_ASSERT_EQUALS(t.GetValue(1.5), 4.0);
+    TS_ASSERT_EQUALS(t.GetValue(-0.75), 1.5);
+    TS_ASSERT_EQUALS(t.GetValue(-0.5), 2.0);
+    TS_ASSERT_EQUALS(t.GetValue(0.25), -0.25);
+    TS_ASSERT_EQUALS(t.GetValue(0.5), 0.5);
+    TS_ASSERT_EQUALS(t.GetValue(0.75), 2.25);
+    TS_ASSERT_EQUALS(t.GetValue(-0.25), 0.5);
+  }
 };
 
 
@@ -1191,6 +1270,45 @@ public:
 
     TS_ASSERT_THROWS(FGTable t_2x3(pm, el_table), BaseException&);
   }
+
+  void testBreakpointLookup() {
+    // Checks the lookup against a linear search, with keys moving back and
+    // forth along both axes.
+    const unsigned int nr = 20, nc = 15;
+    FGTable t(nr, nc);
+    std::vector<double> r, c;
+    for (unsigned int j=0; j<nc; ++j) {
+      c.push_back(0.05*j*j - 2.0);
+      t << c.back();
+    }
+    for (unsigned int i=0; i<nr; ++i) {
+      r.push_back(0.5*i - 3.0);
+      t << r.back();
+      for (unsigned int j=0; j<nc; ++j)
+        t << cos(0.2*i + 0.7*j);
+    }
+
+    auto search = [](const std::vector<double>& x, double key) {
+                    size_t k = 1;
+                    while (x[k] < key && k < x.size()-1) k++;
+                    return k;
+                  };
+
+    for (double rowKey=-4.0; rowKey<8.0; rowKey+=0.7) {
+      for (double colKey: {-3.0, 9.0, -1.0, 0.0, 1.8, 5.0, 2.45, 11.0, 3.2}) {
+        size_t j = search(c, colKey);
+        double cFactor = FGJSBBase::Constrain(0.0, (colKey - c[j-1])
+                                              / (c[j] - c[j-1]), 1.0);
+        size_t i = search(r, rowKey);
+        double rFactor = FGJSBBase::Constrain(0.0, (rowKey - r[i-1])
+                                              / (r[i] - r[i-1]), 1.0);
+        double col1 = rFactor*t(i+1, j) + (1.0-rFactor)*t(i, j);
+        double col2 = rFactor*t(i+1, j+1) + (1.0-rFactor)*t(i, j+1);
+        TS_ASSERT_EQUALS(t.GetValue(rowKey, colKey),
+                         cFactor*(col2-col1)+col1);
+      }
+    }
+  }
 };
 
 class FGTable3DTest : public CxxTest::TestSuite
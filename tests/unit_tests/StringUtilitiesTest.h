@@ -158,6 +158,37 @@ public:
     TS_ASSERT_THROWS(atof_locale_c(" "), InvalidNumber&);
   }
 
+  void testReadNumbersLocaleC() {
+    std::vector<double> values;
+
+    read_numbers_locale_c("", values);
+    TS_ASSERT(values.empty());
+    read_numbers_locale_c(" \t ", values);
+    TS_ASSERT(values.empty());
+
+    read_numbers_locale_c(" 0.0\t-1 +.25  3.14e2 1E-999\n", values);
+    TS_ASSERT_EQUALS(values.size(), 5);
+    TS_ASSERT_EQUALS(values[0], 0.0);
+    TS_ASSERT_EQUALS(values[1], -1.0);
+    TS_ASSERT_EQUALS(values[2], 0.25);
+    TS_ASSERT_EQUALS(values[3], 314.0);
+    TS_ASSERT_EQUALS(values[4], 0.0);
+
+    // The numbers are appended to the vector
+    read_numbers_locale_c("1.e1", values);
+    TS_ASSERT_EQUALS(values.size(), 6);
+    TS_ASSERT_EQUALS(values[5], 10.0);
+
+    // Test invalid numbers
+    TS_ASSERT_THROWS(read_numbers_locale_c("1.0 1E+999", values), InvalidNumber&);
+    TS_ASSERT_THROWS(read_numbers_locale_c("1.0 invalid", values), InvalidNumber&);
+    TS_ASSERT_THROWS(read_numbers_locale_c("1.0.0", values), InvalidNumber&);
+    TS_ASSERT_THROWS(read_numbers_locale_c("1.0-2.0", values), InvalidNumber&);
+    TS_ASSERT_THROWS(read_numbers_locale_c("1.2E 3", values), InvalidNumber&);
+    TS_ASSERT_THROWS(read_numbers_locale_c("--1", values), InvalidNumber&);
+    TS_ASSERT_THROWS(read_numbers_locale_c(". 1", values), InvalidNumber&);
+  }
+
 private:
   std::string empty;
 };
@@ -15,6 +15,8 @@
  *                                                                         *
  ***************************************************************************/
 
+#include <cstring>
+
 #include "datafile.h"
 
 DataFile::DataFile() {
@@ -30,10 +32,7 @@ DataFile::~DataFile() {
 /** This overloaded constructor opens the requested file. */
 
 DataFile::DataFile(string fname) {
-  int count=0;
-  unsigned short start, end;
-  string var;
-
+  fname_str = fname;
   f.open(fname.c_str());
   f.setf(ios::skipws);
   if ( !f ) {
@@ -43,6 +42,40 @@ DataFile::DataFile(string fname) {
     cout << "File " << fname << " successfully opened." << endl;
   }
 
+  if (IsBinary())
+    ReadBinary();
+  else
+    ReadText();
+
+  for (int i=0;i<GetNumFields();i++) {
+    Max.push_back(0.0);
+    Min.push_back(0.0);
+  }
+
+  for (int fld=0; fld<GetNumFields(); fld++) {
+    Max[fld] = Data[0][fld];
+    Min[fld] = Data[0][fld];
+    for (int rec=1;rec<GetNumRecords();rec++) {
+      if (Data[rec][fld] > Max[fld]) Max[fld] = Data[rec][fld];
+      else if (Data[rec][fld] < Min[fld]) Min[fld] = Data[rec][fld];
+    }
+  }
+
+  StartIdx = 0;
+  EndIdx = GetNumRecords()-1;
+
+  cout << endl << "Done Reading data ..." << endl;
+
+}
+
+
+/** Reads a comma separated file. */
+
+void DataFile::ReadText(void) {
+  int count=0;
+  unsigned short start, end;
+  string var;
+
   getline(f, data_str);
   end = 0;
 
@@ -85,25 +118,95 @@ DataFile::DataFile(string fname) {
     if (f.eof()) break;
   }
 
-  for (int i=0;i<GetNumFields();i++) {
-    Max.push_back(0.0);
-    Min.push_back(0.0);
-  }
+}
 
-  for (int fld=0; fld<GetNumFields(); fld++) {
-    Max[fld] = Data[0][fld];
-    Min[fld] = Data[0][fld];
-    for (int rec=1;rec<GetNumRecords();rec++) {
-      if (Data[rec][fld] > Max[fld]) Max[fld] = Data[rec][fld];
-      else if (Data[rec][fld] < Min[fld]) Min[fld] = Data[rec][fld];
-    }
+
+/** Checks if the file has been written by the BINARY output type of JSBSim. */
+
+bool DataFile::IsBinary(void) {
+  char magic[8];
+
+  f.read(magic, sizeof(magic));
+  bool binary = f.gcount() == sizeof(magic) && string(magic, 8) == "JSBSIMBO";
+  f.clear();
+  f.seekg(0);
+  return binary;
+}
+
+
+static unsigned long ReadUInt(ifstream& f, int size) {
+  unsigned char bytes[4] = {0, 0, 0, 0};
+  unsigned long value = 0;
+
+  f.read((char*)bytes, size);
+  for (int i=size-1; i>=0; i--) value = (value << 8) | bytes[i];
+  return value;
+}
+
+
+static string ReadString(ifstream& f) {
+  unsigned long length = ReadUInt(f, 2);
+  string str(length, ' ');
+  f.read(&str[0], length);
+  return str;
+}
+
+
+static double ReadDouble(ifstream& f) {
+  unsigned char bytes[8];
+  unsigned long long bits = 0;
+  double value;
+
+  f.read((char*)bytes, 8);
+  for (int i=7; i>=0; i--) bits = (bits << 8) | bytes[i];
+  memcpy(&value, &bits, 8);
+  return value;
+}
+
+
+/** Reads a file written by the BINARY output type of JSBSim: a header with
+    the names of the columns followed by blocks of little-endian doubles stored
+    column after column. */
+
+void DataFile::ReadBinary(void) {
+  f.close();
+  f.open(fname_str.c_str(), ios::in | ios::binary);
+  f.seekg(8);
+
+  unsigned long version = ReadUInt(f, 4);
+  unsigned long count = ReadUInt(f, 4);
+  unsigned long block_size = ReadUInt(f, 4);
+
+  if (version != 1) {
+    cout << "Unsupported binary format version " << version << endl << endl;
+    exit(-1);
   }
 
-  StartIdx = 0;
-  EndIdx = GetNumRecords()-1;
+  for (unsigned long i=0; i<count; i++) {
+    f.get();                    // column type: always a double
+    string name = ReadString(f);
+    string unit = ReadString(f);
+    if (!unit.empty()) name += " (" + unit + ")";
+    names.push_back(name);
+  }
 
-  cout << endl << "Done Reading data ..." << endl;
+  cout << "Done parsing names. Reading data ..." << endl;
 
+  while (1) {
+    unsigned long frames = ReadUInt(f, 4);
+    if (!f || frames == 0 || frames > block_size) break;
+
+    size_t first = Data.size();
+    Data.resize(first + frames, Row(count));
+    for (unsigned long column=0; column<count; column++) {
+      for (unsigned long row=0; row<frames; row++)
+        Data[first+row][column] = ReadDouble(f);
+    }
+    if (!f) {             // Incomplete block
+      Data.resize(first);
+      break;
+    }
+  }
 }
 
 
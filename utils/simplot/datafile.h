@@ -57,8 +57,14 @@ public:
   int GetStartIdx(void)       {return StartIdx;}
   int GetEndIdx(void)         {return EndIdx;}
 
+private: // Private methods
+  void ReadText(void);
+  bool IsBinary(void);
+  void ReadBinary(void);
+
 private: // Private attributes
   string buff_str;
+  string fname_str;
   ifstream f;
   Row Max;
   Row Min;